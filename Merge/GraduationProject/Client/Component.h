@@ -4,6 +4,7 @@
 #include "stdafx.h"
 #include "Info.h"
 #include "FbxExtractor.h"
+#include "../Common/AnimationClips.h"
 
 class Object;
 
@@ -52,11 +53,12 @@ struct Texture : public Component
 struct Animation : public Component
 {
 	Animation() = default;
-	Animation(unordered_map<string, SkinnedData>& animData, Object* root) : Component{ root }, mAnimData{ &animData }, mAnimationTime{ 0.f }, mSleepTime{ 0.f }, mCurrentFileName{} {}
+	Animation(unordered_map<string, SkinnedData>& animData, array<SkinnedData*, ANIM_CLIP_COUNT>& animClips, Object* root) : Component{ root }, mAnimData{ &animData }, mAnimClips{ &animClips }, mAnimationTime{ 0.f }, mSleepTime{ 0.f }, mCurrentClip{ ANIM_CLIP_NONE } {}
 	unordered_map<string, SkinnedData>* mAnimData;
+	array<SkinnedData*, ANIM_CLIP_COUNT>* mAnimClips;	// 클립 ID -> 애니메이션 데이터 (문자열 해시 없이 조회)
 	float mAnimationTime;
 	float mSleepTime;
-	string mCurrentFileName;
+	AnimationClipID mCurrentClip;	// 현재 재생 중인 클립 (네트워크로 그대로 전송)
 };
 
 struct Position : public Component, public NeedVector
@@ -6,6 +6,7 @@
 #include <ctime>
 #include <cstdio>
 #include <mutex>
+#include <algorithm>
 
 std::ofstream NetworkManager::m_logFile;
 std::mutex NetworkManager::m_logMutex;
@@ -81,26 +82,39 @@ bool NetworkManager::Initialize(const char* serverIP, int port, Scene* scene) {
         return false;
     }
 
-    sock = socket(AF_INET, SOCK_STREAM, 0);
-    if (sock == INVALID_SOCKET) {
-        LogToFile("[Error] Socket creation failed");
-        return false;
-    }
-
     SOCKADDR_IN serverAddr = { 0 };
     serverAddr.sin_family = AF_INET;
     inet_pton(AF_INET, serverIP, &serverAddr.sin_addr);
     serverAddr.sin_port = htons(port);
 
-    if (connect(sock, (SOCKADDR*)&serverAddr, sizeof(serverAddr)) == SOCKET_ERROR) {
-        LogToFile("[Error] Connection failed");
-        return false;
+    if (m_udpOnly) {
+        // TCP 연결 없이 UDP 소켓 하나로 (로그인/스폰은 신뢰 채널, 위치/스냅샷은 비신뢰)
+        if (!OpenUdpSocket(serverAddr)) {
+            return false;
+        }
+        m_udpToken = 0;   // LOGIN_RESPONSE 를 받기 전까지는 서버가 보낸 주소로 세션을 찾음
+        m_myClientID = 0;
+    }
+    else {
+        sock = socket(AF_INET, SOCK_STREAM, 0);
+        if (sock == INVALID_SOCKET) {
+            LogToFile("[Error] Socket creation failed");
+            return false;
+        }
+
+        if (connect(sock, (SOCKADDR*)&serverAddr, sizeof(serverAddr)) == SOCKET_ERROR) {
+            LogToFile("[Error] Connection failed");
+            return false;
+        }
     }
 
-    // recv 버퍼 초기화
-    memset(m_recvBuffer, 0, sizeof(m_recvBuffer));
-    memset(m_packetBuffer, 0, sizeof(m_packetBuffer));
-    m_packetBufferSize = 0;
+    // 수신 링 초기화 (처음 한 번만 매핑하고 재접속 시에는 비우기만 함)
+    if (!m_recvRing.IsCreated() && !m_recvRing.Create()) {
+        LogToFile("[Error] Failed to create receive ring");
+        return false;
+    }
+    m_recvRing.Reset();
+    m_decompressor.Reset();
 
     m_isRunning = true;
     m_networkThread = CreateThread(NULL, 0, NetworkThread, this, 0, NULL);
@@ -125,8 +139,7 @@ void NetworkManager::SendLoginRequest(const std::string& username) {
         pkt.header.type = PACKET_LOGIN_REQUEST;
         strncpy_s(pkt.username, username.c_str(), sizeof(pkt.username) - 1);
 
-        int sendResult = send(sock, (char*)&pkt, sizeof(pkt), 0);
-        if (sendResult == SOCKET_ERROR) {
+        if (!SendReliable(&pkt, sizeof(pkt))) {
             int error = WSAGetLastError();
             HandleError("Login request failed: " + std::to_string(error));
         } else {
@@ -148,7 +161,8 @@ void NetworkManager::SendPlayerDisconnect() {
         pkt.playerID = m_myClientID;
         strncpy_s(pkt.username, m_username.c_str(), sizeof(pkt.username) - 1);
 
-        send(sock, (char*)&pkt, sizeof(pkt), 0);
+        SendReliable(&pkt, sizeof(pkt));
+        FlushDatagrams();  // 곧 종료하므로 다음 주기를 기다리지 않고 바로 전송
         LogToFile("[Disconnect] Sent disconnect packet for user: " + m_username);
     }
     catch (const std::exception& e) {
@@ -177,13 +191,20 @@ DWORD WINAPI NetworkManager::NetworkThread(LPVOID arg) {
         try {
             fd_set readSet;
             FD_ZERO(&readSet);
-            FD_SET(network->sock, &readSet);
+            if (network->sock != INVALID_SOCKET) {
+                FD_SET(network->sock, &readSet);
+            }
+            SOCKET udpSocket = network->m_udpSocket;
+            if (udpSocket != INVALID_SOCKET) {
+                FD_SET(udpSocket, &readSet);
+            }
             
             timeval timeout;
             timeout.tv_sec = 0;
             timeout.tv_usec = 50000;  // 50ms (더 짧은 타임아웃)
             
             int selectResult = select(0, &readSet, nullptr, nullptr, &timeout);
+            network->FlushDatagrams();  // 신뢰 채널 전송/재전송/ack (최대 50ms 간격)
             if (selectResult == SOCKET_ERROR) {
                 int error = WSAGetLastError();
                 if (error == WSAEWOULDBLOCK) {
@@ -200,7 +221,14 @@ DWORD WINAPI NetworkManager::NetworkThread(LPVOID arg) {
             
             if (selectResult == 0) continue;  // 타임아웃
 
-            int recvBytes = recv(network->sock, network->m_recvBuffer, sizeof(network->m_recvBuffer), 0);
+            if (udpSocket != INVALID_SOCKET && FD_ISSET(udpSocket, &readSet)) {
+                network->ReceiveDatagrams();
+            }
+            if (network->sock == INVALID_SOCKET || !FD_ISSET(network->sock, &readSet)) continue;
+
+            // 링에 바로 수신 (중간 버퍼 복사 없음)
+            RecvRing& ring = network->m_recvRing;
+            int recvBytes = recv(network->sock, ring.WritePtr(), static_cast<int>(ring.Writable()), 0);
             if (recvBytes <= 0) {
                 int error = WSAGetLastError();
                 if (error == WSAEWOULDBLOCK) {
@@ -225,32 +253,19 @@ DWORD WINAPI NetworkManager::NetworkThread(LPVOID arg) {
                 network->LogToFile("[Network] Received " + std::to_string(recvBytes) + " bytes");
             }
 
-            if (recvBytes > sizeof(network->m_recvBuffer)) {
-                network->LogToFile("[Error] Receive buffer overflow: " + std::to_string(recvBytes) + " bytes");
-                return 1;
-            }
+            ring.Commit(recvBytes);
 
-            // 수신된 데이터를 패킷 버퍼에 추가
-            if (network->m_packetBufferSize + recvBytes > sizeof(network->m_packetBuffer)) {
-                network->LogToFile("[Error] Packet buffer overflow, clearing buffer");
-                network->m_packetBufferSize = 0;
-                memset(network->m_packetBuffer, 0, sizeof(network->m_packetBuffer));
-                continue;
-            }
-
-            memcpy(network->m_packetBuffer + network->m_packetBufferSize, network->m_recvBuffer, recvBytes);
-            network->m_packetBufferSize += recvBytes;
-
-            // 패킷 버퍼에서 완전한 패킷들을 처리
+            // 링에서 완전한 패킷들을 처리 (링 끝을 넘는 패킷도 연속으로 보이므로 그대로 전달)
+            const char* data = ring.ReadPtr();
+            int available = static_cast<int>(ring.Readable());
             int processedBytes = 0;
-            while (network->m_packetBufferSize - processedBytes >= sizeof(PacketHeader)) {
-                PacketHeader* header = (PacketHeader*)(network->m_packetBuffer + processedBytes);
+            while (available - processedBytes >= sizeof(PacketHeader)) {
+                PacketHeader header = ReadPacketHeader(data + processedBytes);
                 
-                // 패킷 크기 검증
-                if (header->size < sizeof(PacketHeader) || header->size > sizeof(network->m_packetBuffer)) {
-                    network->LogToFile("[Error] Invalid packet size: " + std::to_string(header->size));
-                    network->m_packetBufferSize = 0;
-                    memset(network->m_packetBuffer, 0, sizeof(network->m_packetBuffer));
+                // 패킷 크기 검증 (크기 필드가 16bit라 링 용량을 넘는 패킷은 없음)
+                if (header.size < sizeof(PacketHeader)) {
+                    network->LogToFile("[Error] Invalid packet size: " + std::to_string(header.size));
+                    processedBytes = available;  // 프레임 경계를 잃었으므로 받은 데이터를 모두 버림
                     if (++errorCount >= MAX_ERRORS) {
                         network->LogToFile("[Warning] Many invalid packets, but continuing...");
                         // 에러가 많아도 연결 유지
@@ -260,13 +275,13 @@ DWORD WINAPI NetworkManager::NetworkThread(LPVOID arg) {
                 }
 
                 // 완전한 패킷이 있는지 확인
-                if (network->m_packetBufferSize - processedBytes < header->size) {
+                if (available - processedBytes < header.size) {
                     break;  // 완전한 패킷이 없음
                 }
 
                 // 패킷 처리 (안전한 접근)
                 try {
-                    network->ProcessPacket(network->m_packetBuffer + processedBytes);
+                    network->ProcessPacket(data + processedBytes);
                 } catch (const std::exception& e) {
                     // 패킷 처리 중 예외 발생 시 무시하고 계속 진행
                     network->LogToFile("[Error] Exception during packet processing: " + std::string(e.what()));
@@ -274,17 +289,11 @@ DWORD WINAPI NetworkManager::NetworkThread(LPVOID arg) {
                     // 패킷 처리 중 예외 발생 시 무시하고 계속 진행
                     network->LogToFile("[Error] Unknown exception during packet processing");
                 }
-                processedBytes += header->size;
+                processedBytes += header.size;
             }
 
-            // 처리된 데이터를 버퍼에서 제거
-            if (processedBytes > 0) {
-                if (processedBytes < network->m_packetBufferSize) {
-                    memmove(network->m_packetBuffer, network->m_packetBuffer + processedBytes, 
-                           network->m_packetBufferSize - processedBytes);
-                }
-                network->m_packetBufferSize -= processedBytes;
-            }
+            // 처리한 만큼 읽기 위치만 이동 (남은 부분 패킷은 제자리에서 다음 수신과 이어짐)
+            ring.Consume(processedBytes);
 
             // 성공적인 패킷 수신 시 에러 카운트 리셋
             errorCount = 0;
@@ -338,6 +347,14 @@ bool NetworkManager::AttemptReconnect() {
     
     LogToFile("[Reconnect] Attempting reconnection #" + std::to_string(m_reconnectAttempts));
     
+    CloseUdpChannel();  // 새 세션은 LOGIN_RESPONSE로 다시 협상
+    if (m_udpOnly) {
+        LogToFile("[Reconnect] UDP session is re-established by logging in again");
+        m_shouldReconnect = false;
+        m_reconnectAttempts = 0;
+        ResetErrorInfo();
+        return false;
+    }
     if (sock != INVALID_SOCKET) {
         closesocket(sock);
         sock = INVALID_SOCKET;
@@ -376,8 +393,8 @@ bool NetworkManager::AttemptReconnect() {
 
 void NetworkManager::ResetErrorInfo() {
     m_errorCount = 0;
-    m_packetBufferSize = 0;
-    memset(m_packetBuffer, 0, sizeof(m_packetBuffer));
+    m_recvRing.Reset();
+    m_decompressor.Reset();   // 새 연결의 압축 사전은 비어 있는 상태부터
     LogToFile("[Info] Error info and packet buffer reset");
 }
 
@@ -400,15 +417,21 @@ void NetworkManager::SendPlayerUpdate(float x, float y, float z, float rotY) {
             if (player) {
                 Animation* anim = player->GetComponent<Animation>();
                 if (anim) {
-                    strncpy_s(pkt.animationFile, anim->mCurrentFileName.c_str(), sizeof(pkt.animationFile) - 1);
+                    pkt.animationClip = anim->mCurrentClip;
                     pkt.animationTime = anim->mAnimationTime;
                 } else {
-                    strncpy_s(pkt.animationFile, "1P(boy-idle).fbx", sizeof(pkt.animationFile) - 1);
+                    pkt.animationClip = ANIM_CLIP_BOY_IDLE;
                     pkt.animationTime = 0.0f;
                 }
             }
         }
 
+        // UDP 채널이 있으면 데이터그램으로 (유실되어도 다음 갱신이 덮어씀)
+        if (m_udpSocket != INVALID_SOCKET) {
+            SendUnreliable(&pkt, sizeof(pkt));
+            return;
+        }
+
         int sendResult = send(sock, (char*)&pkt, sizeof(pkt), 0);
         if (sendResult == SOCKET_ERROR) {
             int error = WSAGetLastError();
@@ -426,8 +449,8 @@ void NetworkManager::SendPlayerUpdate(float x, float y, float z, float rotY) {
     }
 }
 
-void NetworkManager::ProcessPacket(char* buffer) {
-    PacketHeader* header = (PacketHeader*)buffer;
+void NetworkManager::ProcessPacket(const char* buffer) {
+    PacketHeader header = ReadPacketHeader(buffer);
     // 패킷 처리 시작 로그 제거 (로그 출력 최소화)
 
     // 메모리 사용량 모니터링 (최적화)
@@ -457,220 +480,530 @@ void NetworkManager::ProcessPacket(char* buffer) {
         }
     }
 
+    // 압축된 큰 패킷은 세션 사전으로 풀어서 원래 패킷으로 처리
+    if (header.type & PACKET_FLAG_COMPRESSED) {
+        if (!DecompressPacket(m_decompressor, buffer, m_decompressed)) {
+            // 이후 압축 패킷도 같은 사전을 쓰므로 풀 수 없음 - 연결을 다시 맺음
+            LogToFile("[Error] Failed to decompress " + std::string(GetPacketName(header.type & ~PACKET_FLAG_COMPRESSED)) + " packet");
+            m_shouldReconnect = true;
+            return;
+        }
+        ProcessPacket(m_decompressed.data());
+        return;
+    }
+
     try {
-        switch (header->type) {
-            case PACKET_LOGIN_RESPONSE: {
-                PacketLoginResponse* loginRespPkt = (PacketLoginResponse*)buffer;
-                LogToFile("[Login] Received login response - Success: " + std::to_string(loginRespPkt->success));
-                
-                if (loginRespPkt->success) {
-                    m_myClientID = loginRespPkt->clientID;
-                    m_isLoggedIn = true;
-                    LogToFile("[Login] Login successful - Client ID: " + std::to_string(m_myClientID));
-                    
-                    // 로그인 성공 후 준비 완료 신호 전송
-                    PacketClientReady readyPacket;
-                    readyPacket.header.type = PACKET_CLIENT_READY;
-                    readyPacket.header.size = sizeof(PacketClientReady);
-                    readyPacket.clientID = m_myClientID;
-                    
-                    int sendResult = send(sock, (char*)&readyPacket, sizeof(readyPacket), 0);
-                    if (sendResult == SOCKET_ERROR) {
-                        int error = WSAGetLastError();
-                        LogToFile("[Error] Failed to send ready packet: " + std::to_string(error));
-                    } else {
-                        LogToFile("[Login] Sent client ready packet");
-                    }
-                    
-                    if (m_loginSuccessCallback) {
-                        m_loginSuccessCallback(m_myClientID, m_username);
-                    }
-                } else {
-                    m_isLoggedIn = false;
-                    std::string errorMsg = loginRespPkt->message;
-                    LogToFile("[Login] Login failed: " + errorMsg);
-                    
-                    if (m_loginFailedCallback) {
-                        m_loginFailedCallback(errorMsg);
-                    }
-                }
+        // 타입 번호로 핸들러 테이블을 바로 찾아 호출 (크기 검사는 공용 스키마 테이블)
+        switch (PacketDispatcher<NetworkManager>::Dispatch(*this, buffer, header.size)) {
+            case PacketDispatcher<NetworkManager>::UNKNOWN_TYPE:
+                LogToFile("[Warning] Unknown packet type: " + std::to_string(header.type));
                 break;
-            }
-            
-            case PACKET_PLAYER_SPAWN: {
-                PacketPlayerSpawn* spawnPkt = (PacketPlayerSpawn*)buffer;
-                LogToFile("[Spawn] Processing spawn packet for ID: " + std::to_string(spawnPkt->playerID));
-
-                // 로그인 상태 확인
-                if (!m_isLoggedIn) {
-                    LogToFile("[Spawn] Ignoring player spawn packet - not logged in yet");
-                    break;
-                }
-
-                if (m_myClientID == 0) {
-                    m_myClientID = spawnPkt->playerID;
-                    LogToFile("[Spawn] Set my client ID to: " + std::to_string(m_myClientID));
-                }
-                else if (spawnPkt->playerID != m_myClientID) {
-                    try {
-                        OtherPlayerManager::GetInstance()->SpawnOtherPlayer(spawnPkt->playerID);
-                        LogToFile("[Spawn] Successfully spawned other player: " + std::to_string(spawnPkt->playerID) + " (" + spawnPkt->username + ")");
-                    }
-                    catch (const std::exception& e) {
-                        LogToFile("[Error] Failed to spawn other player: " + std::string(e.what()));
-                    }
-                }
+            case PacketDispatcher<NetworkManager>::INVALID_SIZE:
+                LogToFile("[Warning] Invalid " + std::string(GetPacketName(header.type)) + " packet size: " + std::to_string(header.size));
                 break;
-            }
-            
-            case PACKET_PLAYER_DISCONNECT: {
-                PacketPlayerDisconnect* disconnectPkt = (PacketPlayerDisconnect*)buffer;
-                LogToFile("[Disconnect] Player disconnected: " + std::to_string(disconnectPkt->playerID) + " (" + disconnectPkt->username + ")");
-                
-                if (disconnectPkt->playerID != m_myClientID) {
-                    try {
-                        OtherPlayerManager::GetInstance()->RemoveOtherPlayer(disconnectPkt->playerID);
-                        LogToFile("[Disconnect] Removed other player: " + std::to_string(disconnectPkt->playerID));
-                    }
-                    catch (const std::exception& e) {
-                        LogToFile("[Error] Failed to remove other player: " + std::string(e.what()));
-                    }
-                }
+            default:
                 break;
-            }
+        }
+    }
+    catch (const std::exception& e) {
+        LogToFile("[Error] Failed to process packet: " + std::string(e.what()));
+        // 예외를 상위로 전파하지 않고 여기서 처리
+    }
 
-            case PACKET_PLAYER_UPDATE: {
-                PacketPlayerUpdate* updatePkt = (PacketPlayerUpdate*)buffer;
-                
-                // 로그인 상태 확인
-                if (!m_isLoggedIn) {
-                    LogToFile("[Update] Ignoring player update packet - not logged in yet");
-                    break;
-                }
-                
-                if (updatePkt->clientID == m_myClientID) {
-                    LogToFile("[Update] Ignoring own update packet");
-                    return;
-                }
+    // 패킷 처리 완료 로그 제거
+}
 
-                // 애니메이션 정보 추출
-                std::string animationFile = updatePkt->animationFile;
-                float animationTime = updatePkt->animationTime;
+template<typename T>
+void NetworkManager::OnPacket(PacketView<T> pkt) {
+    LogToFile("[Warning] Unhandled packet type: " + std::string(GetPacketName(PacketTypeOf<T>::VALUE)));
+}
 
-                OtherPlayerManager::GetInstance()->UpdateOtherPlayer(
-                    updatePkt->clientID, updatePkt->x, updatePkt->y, updatePkt->z, updatePkt->rotY,
-                    animationFile, animationTime);
-                LogToFile("[Update] Successfully updated player: " + std::to_string(updatePkt->clientID));
-                break;
-            }
+void NetworkManager::OnPacket(PacketView<PacketLoginResponse> pkt) {
+    bool success = pkt.Get(&PacketLoginResponse::success);
+    LogToFile("[Login] Received login response - Success: " + std::to_string(success));
+    
+    if (success) {
+        m_myClientID = pkt.Get(&PacketLoginResponse::clientID);
+        m_isLoggedIn = true;
+        m_lastSnapshotTick = 0;         // 새 세션은 전체 상태부터 다시 받음
+        m_snapshotHistory.Clear();
+        LogToFile("[Login] Login successful - Client ID: " + std::to_string(m_myClientID));
+        
+        // 서버가 UDP 채널을 열어 두었으면 위치/스냅샷은 UDP로
+        unsigned short udpPort = pkt.Get(&PacketLoginResponse::udpPort);
+        if (m_udpOnly) {
+            std::lock_guard<std::mutex> lock(m_udpMutex);
+            m_udpToken = pkt.Get(&PacketLoginResponse::udpToken);   // 이후 데이터그램은 clientID/토큰으로 확인
+        }
+        else if (udpPort != 0 && OpenUdpChannel(udpPort, pkt.Get(&PacketLoginResponse::udpToken))) {
+            SendSnapshotAck(0);  // 첫 데이터그램 - 서버가 이 주소로 UDP 송신을 시작함
+        }
+        
+        // 로그인 성공 후 준비 완료 신호 전송
+        PacketClientReady readyPacket = MakePacket<PacketClientReady>();
+        readyPacket.clientID = m_myClientID;
+        if (m_scene) {
+            auto& position = m_scene->GetObj<PlayerObject>(L"PlayerObject").GetComponent<Position>();
+            readyPacket.x = position.mFloat4.x;   // 서버가 이 위치 주변으로 부트스트랩을 채움
+            readyPacket.z = position.mFloat4.z;
+        }
+        
+        if (!SendReliable(&readyPacket, sizeof(readyPacket))) {
+            int error = WSAGetLastError();
+            LogToFile("[Error] Failed to send ready packet: " + std::to_string(error));
+        } else {
+            LogToFile("[Login] Sent client ready packet");
+        }
+        
+        if (m_loginSuccessCallback) {
+            m_loginSuccessCallback(m_myClientID, m_username);
+        }
+    } else {
+        m_isLoggedIn = false;
+        std::string errorMsg(pkt.GetString(&PacketLoginResponse::message));
+        LogToFile("[Login] Login failed: " + errorMsg);
+        
+        if (m_loginFailedCallback) {
+            m_loginFailedCallback(errorMsg);
+        }
+    }
+}
 
-            case PACKET_TIGER_SPAWN: {
-                PacketTigerSpawn* tigerSpawnPkt = (PacketTigerSpawn*)buffer;
-                LogToFile("[Tiger] Received spawn packet for tiger ID: " + std::to_string(tigerSpawnPkt->tigerID));
-                
-                // 로그인 상태 확인 - 로그인 전에 받은 호랑이 스폰 패킷은 무시
-                if (!m_isLoggedIn) {
-                    LogToFile("[Tiger] Ignoring tiger spawn packet - not logged in yet");
-                    break;
-                }
-                
-                // 이미 스폰된 호랑이인지 확인
-                if (m_tigers.find(tigerSpawnPkt->tigerID) != m_tigers.end()) {
-                    LogToFile("[Tiger] Tiger ID " + std::to_string(tigerSpawnPkt->tigerID) + " already spawned, ignoring duplicate spawn");
-                    break;
-                }
-                
-                // Tiger 정보 저장
-                TigerInfo tigerInfo;
-                tigerInfo.tigerID = tigerSpawnPkt->tigerID;
-                tigerInfo.x = tigerSpawnPkt->x;
-                tigerInfo.y = tigerSpawnPkt->y;
-                tigerInfo.z = tigerSpawnPkt->z;
-                tigerInfo.rotY = 0.0f;
-                m_tigers[tigerSpawnPkt->tigerID] = tigerInfo;
-                
-                LogToFile("[Tiger] Successfully stored tiger info for ID: " + std::to_string(tigerSpawnPkt->tigerID));
-                
-                // Scene에 Tiger 생성 요청
-                if (m_scene && m_scene->GetDevice() != nullptr) {
-                    try {
-                        m_scene->CreateTigerObject(tigerSpawnPkt->tigerID, tigerSpawnPkt->x, tigerSpawnPkt->y, tigerSpawnPkt->z, m_scene->GetDevice());
-                    }
-                    catch (...) {
-                        // 예외가 발생해도 클라이언트는 계속 실행
-                    }
-                }
-                break;
-            }
-            
-            case PACKET_TIGER_UPDATE: {
-                PacketTigerUpdate* tigerUpdatePkt = (PacketTigerUpdate*)buffer;
-                
-                // 로그인 상태 확인
-                if (!m_isLoggedIn) {
-                    break;
-                }
-                
-                if (m_tigers.find(tigerUpdatePkt->tigerID) != m_tigers.end()) {
-                    // Tiger 정보 업데이트
-                    m_tigers[tigerUpdatePkt->tigerID].x = tigerUpdatePkt->x;
-                    m_tigers[tigerUpdatePkt->tigerID].y = tigerUpdatePkt->y;
-                    m_tigers[tigerUpdatePkt->tigerID].z = tigerUpdatePkt->z;
-                    m_tigers[tigerUpdatePkt->tigerID].rotY = tigerUpdatePkt->rotY;
-                    
-                    // Scene의 Tiger 오브젝트 업데이트
-                    if (m_scene) {
-                        try {
-                            m_scene->UpdateTigerObject(tigerUpdatePkt->tigerID, tigerUpdatePkt->x, tigerUpdatePkt->y, tigerUpdatePkt->z, tigerUpdatePkt->rotY);
-                        }
-                        catch (...) {
-                            // 예외가 발생해도 클라이언트는 계속 실행
-                        }
-                    }
-                }
-                break;
-            }
+void NetworkManager::OnPacket(PacketView<PacketPlayerSpawn> pkt) {
+    int playerID = pkt.Get(&PacketPlayerSpawn::playerID);
+    LogToFile("[Spawn] Processing spawn packet for ID: " + std::to_string(playerID));
 
-            case PACKET_TREE_SPAWN: {
-                PacketTreeSpawn* treeSpawnPkt = (PacketTreeSpawn*)buffer;
-                LogToFile("[Tree] Received tree positions packet with " + std::to_string(treeSpawnPkt->treeCount) + " trees");
-                
-                // 로그인 상태 확인 - 로그인 전에 받은 나무 스폰 패킷은 무시
-                if (!m_isLoggedIn) {
-                    LogToFile("[Tree] Ignoring tree spawn packet - not logged in yet");
-                    break;
-                }
-                
-                // 나무 생성 요청을 큐에 추가 (스레드 안전)
-                {
-                    std::lock_guard<std::mutex> lock(m_treeSpawnMutex);
-                    for (int i = 0; i < treeSpawnPkt->treeCount; i++) {
-                        const TreePosition& treePos = treeSpawnPkt->trees[i];
-                        TreeSpawnRequest request;
-                        request.treeID = i + 1;
-                        request.x = treePos.x;
-                        request.y = treePos.y;
-                        request.z = treePos.z;
-                        request.rotY = treePos.rotY;
-                        request.treeType = treePos.treeType;
-                        m_treeSpawnQueue.push(request);
-                    }
-                    LogToFile("[Tree] Added " + std::to_string(treeSpawnPkt->treeCount) + " tree spawn requests to queue");
-                }
-                break;
+    // 로그인 상태 확인
+    if (!m_isLoggedIn) {
+        LogToFile("[Spawn] Ignoring player spawn packet - not logged in yet");
+        return;
+    }
+
+    if (m_myClientID == 0) {
+        m_myClientID = playerID;
+        LogToFile("[Spawn] Set my client ID to: " + std::to_string(m_myClientID));
+    }
+    else if (playerID != m_myClientID) {
+        try {
+            OtherPlayerManager::GetInstance()->SpawnOtherPlayer(playerID);
+            LogToFile("[Spawn] Successfully spawned other player: " + std::to_string(playerID) + " (" + std::string(pkt.GetString(&PacketPlayerSpawn::username)) + ")");
+        }
+        catch (const std::exception& e) {
+            LogToFile("[Error] Failed to spawn other player: " + std::string(e.what()));
+        }
+    }
+}
+
+void NetworkManager::OnPacket(PacketView<PacketPlayerDisconnect> pkt) {
+    int playerID = pkt.Get(&PacketPlayerDisconnect::playerID);
+    LogToFile("[Disconnect] Player disconnected: " + std::to_string(playerID) + " (" + std::string(pkt.GetString(&PacketPlayerDisconnect::username)) + ")");
+    
+    if (playerID != m_myClientID) {
+        try {
+            OtherPlayerManager::GetInstance()->RemoveOtherPlayer(playerID);
+            LogToFile("[Disconnect] Removed other player: " + std::to_string(playerID));
+        }
+        catch (const std::exception& e) {
+            LogToFile("[Error] Failed to remove other player: " + std::string(e.what()));
+        }
+    }
+}
+
+void NetworkManager::OnPacket(PacketView<PacketPlayerUpdate> pkt) {
+    // 로그인 상태 확인
+    if (!m_isLoggedIn) {
+        LogToFile("[Update] Ignoring player update packet - not logged in yet");
+        return;
+    }
+    
+    int clientID = pkt.Get(&PacketPlayerUpdate::clientID);
+    if (clientID == m_myClientID) {
+        LogToFile("[Update] Ignoring own update packet");
+        return;
+    }
+
+    // 애니메이션 정보 추출
+    uint16_t animationClip = pkt.Get(&PacketPlayerUpdate::animationClip);
+    float animationTime = pkt.Get(&PacketPlayerUpdate::animationTime);
+
+    OtherPlayerManager::GetInstance()->UpdateOtherPlayer(
+        clientID, pkt.Get(&PacketPlayerUpdate::x), pkt.Get(&PacketPlayerUpdate::y), pkt.Get(&PacketPlayerUpdate::z),
+        pkt.Get(&PacketPlayerUpdate::rotY), animationClip, animationTime);
+    LogToFile("[Update] Successfully updated player: " + std::to_string(clientID));
+}
+
+void NetworkManager::OnPacket(PacketView<PacketTigerSpawn> pkt) {
+    int tigerID = pkt.Get(&PacketTigerSpawn::tigerID);
+    LogToFile("[Tiger] Received spawn packet for tiger ID: " + std::to_string(tigerID));
+    
+    // 로그인 상태 확인 - 로그인 전에 받은 호랑이 스폰 패킷은 무시
+    if (!m_isLoggedIn) {
+        LogToFile("[Tiger] Ignoring tiger spawn packet - not logged in yet");
+        return;
+    }
+    
+    SpawnTiger(tigerID, pkt.Get(&PacketTigerSpawn::x), pkt.Get(&PacketTigerSpawn::y), pkt.Get(&PacketTigerSpawn::z), 0.0f);
+}
+
+void NetworkManager::SpawnTiger(int tigerID, float x, float y, float z, float rotY) {
+    // 이미 스폰된 호랑이 = 관심 영역에 다시 들어온 호랑이 (숨겨 둔 오브젝트를 다시 보임)
+    auto existing = m_tigers.find(tigerID);
+    if (existing != m_tigers.end()) {
+        TigerInfo& tiger = existing->second;
+        tiger.x = x;
+        tiger.y = y;
+        tiger.z = z;
+        tiger.rotY = rotY;
+        if (m_scene) {
+            m_scene->ShowTigerObject(tigerID, tiger.x, tiger.z);
+        }
+        return;
+    }
+    
+    // Tiger 정보 저장
+    TigerInfo tigerInfo;
+    tigerInfo.tigerID = tigerID;
+    tigerInfo.x = x;
+    tigerInfo.y = y;
+    tigerInfo.z = z;
+    tigerInfo.rotY = rotY;
+    m_tigers[tigerID] = tigerInfo;
+    
+    LogToFile("[Tiger] Successfully stored tiger info for ID: " + std::to_string(tigerID));
+    
+    // Scene에 Tiger 생성 요청
+    if (m_scene && m_scene->GetDevice() != nullptr) {
+        try {
+            m_scene->CreateTigerObject(tigerID, tigerInfo.x, tigerInfo.y, tigerInfo.z, m_scene->GetDevice());
+        }
+        catch (...) {
+            // 예외가 발생해도 클라이언트는 계속 실행
+        }
+    }
+}
+
+void NetworkManager::OnPacket(PacketView<PacketTigerUpdate> pkt) {
+    // 로그인 상태 확인
+    if (!m_isLoggedIn) {
+        return;
+    }
+    
+    ApplyTigerUpdate(pkt.Get(&PacketTigerUpdate::tigerID), pkt.Get(&PacketTigerUpdate::x), pkt.Get(&PacketTigerUpdate::y),
+        pkt.Get(&PacketTigerUpdate::z), pkt.Get(&PacketTigerUpdate::rotY));
+}
+
+void NetworkManager::OnPacket(PacketView<PacketTigerSnapshot> pkt) {
+    // 로그인 상태 확인 (ack하지 않으면 서버는 다음에도 전체 상태를 보냄)
+    if (!m_isLoggedIn) {
+        return;
+    }
+    
+    uint32_t tick = pkt.Get(&PacketTigerSnapshot::tick);
+    uint32_t baselineTick = pkt.Get(&PacketTigerSnapshot::baselineTick);
+    int count = pkt.Get(&PacketTigerSnapshot::count);
+    if (tick <= m_lastSnapshotTick) {
+        return;  // 이미 적용한 스냅샷보다 오래됨
+    }
+
+    const SnapshotEntities* baseline = nullptr;
+    if (baselineTick != 0) {
+        baseline = m_snapshotHistory.Find(baselineTick);
+        if (!baseline) {
+            LogToFile("[Warning] Snapshot baseline " + std::to_string(baselineTick) + " not found, requesting full state");
+            SendSnapshotAck(0);
+            return;
+        }
+    }
+    
+    // 기준 스냅샷에 바뀐 필드만 적용하고, 바뀐 호랑이만 갱신
+    const uint8_t* bits = reinterpret_cast<const uint8_t*>(pkt.Data()) + sizeof(PacketTigerSnapshot);
+    size_t bitsSize = static_cast<size_t>(pkt.Size()) - sizeof(PacketTigerSnapshot);
+    bool decoded = DecodeSnapshotDelta(baseline, bits, bitsSize, count, m_snapshotScratch,
+        [this](const QuantizedEntityState& state, uint32_t mask) {
+            if (mask == 0) return;  // 관심 영역에서 빠진 호랑이 (ENTITY_LEAVE로 숨김)
+            // y는 오지 않음 (UpdateTigerObject가 지형 높이로 계산)
+            ApplyTigerUpdate(static_cast<int>(state.entityID), DequantizePosition(state.x), 0.0f,
+                DequantizePosition(state.z), DequantizeYaw(state.yaw));
+        });
+    if (!decoded) {
+        LogToFile("[Warning] Malformed tiger snapshot at tick " + std::to_string(tick) + ", requesting full state");
+        SendSnapshotAck(0);
+        return;
+    }
+
+    m_snapshotHistory.Store(tick, m_snapshotScratch);
+    m_lastSnapshotTick = tick;
+    SendSnapshotAck(tick);
+}
+
+void NetworkManager::OnPacket(PacketView<PacketEntityLeave> pkt) {
+    if (!m_isLoggedIn) {
+        return;
+    }
+    
+    int entityID = pkt.Get(&PacketEntityLeave::entityID);
+    if (pkt.Get(&PacketEntityLeave::entityType) == ENTITY_TYPE_TIGER) {
+        // 호랑이는 다시 들어올 때 재사용하도록 숨기기만 함
+        if (m_scene) {
+            m_scene->HideTigerObject(entityID);
+        }
+    }
+    else if (entityID != m_myClientID) {
+        // 다른 플레이어는 다시 들어오면 PLAYER_SPAWN으로 새로 만들어짐
+        OtherPlayerManager::GetInstance()->RemoveOtherPlayer(entityID);
+        LogToFile("[AOI] Player left interest area: " + std::to_string(entityID));
+    }
+}
+
+void NetworkManager::SendSnapshotAck(uint32_t tick) {
+    PacketSnapshotAck pkt = MakePacket<PacketSnapshotAck>();
+    pkt.tick = tick;
+    if (m_udpSocket != INVALID_SOCKET) {
+        SendUnreliable(&pkt, sizeof(pkt));   // 서버는 가장 최신 ack만 쓰므로 유실되어도 됨
+        return;
+    }
+    if (send(sock, (char*)&pkt, sizeof(pkt), 0) == SOCKET_ERROR) {
+        LogToFile("[Error] Failed to send snapshot ack: " + std::to_string(WSAGetLastError()));
+    }
+}
+
+bool NetworkManager::OpenUdpChannel(unsigned short port, uint32_t token) {
+    // TCP로 연결된 서버 주소에 UDP 포트만 바꿔서 연결
+    SOCKADDR_IN serverAddr = { 0 };
+    int addrLen = sizeof(serverAddr);
+    if (getpeername(sock, (SOCKADDR*)&serverAddr, &addrLen) == SOCKET_ERROR) {
+        LogToFile("[UDP] Failed to get server address: " + std::to_string(WSAGetLastError()));
+        return false;
+    }
+    serverAddr.sin_port = htons(port);
+    if (!OpenUdpSocket(serverAddr)) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(m_udpMutex);
+    m_udpToken = token;
+    return true;
+}
+
+bool NetworkManager::OpenUdpSocket(const SOCKADDR_IN& serverAddr) {
+    CloseUdpChannel();
+
+    // 서버 주소로 connect 해서 send/recv로 주고받고 다른 곳에서 온 데이터그램은 차단
+    SOCKET udpSocket = socket(AF_INET, SOCK_DGRAM, 0);
+    if (udpSocket == INVALID_SOCKET) {
+        LogToFile("[UDP] Socket creation failed");
+        return false;
+    }
+    u_long nonBlocking = 1;
+    ioctlsocket(udpSocket, FIONBIO, &nonBlocking);
+    if (connect(udpSocket, (SOCKADDR*)&serverAddr, sizeof(serverAddr)) == SOCKET_ERROR) {
+        LogToFile("[UDP] Connect failed: " + std::to_string(WSAGetLastError()));
+        closesocket(udpSocket);
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(m_udpMutex);
+    m_udpSendSequence = 0;
+    m_udpRecv.Reset();
+    m_reliable = ReliableChannel(CLIENT_FRAGMENT_SIZE);
+    m_lastDatagramSendTime = 0;
+    m_udpSocket = udpSocket;
+    LogToFile("[UDP] Channel opened on port " + std::to_string(ntohs(serverAddr.sin_port)));
+    return true;
+}
+
+void NetworkManager::CloseUdpChannel() {
+    std::lock_guard<std::mutex> lock(m_udpMutex);
+    if (m_udpSocket != INVALID_SOCKET) {
+        closesocket(m_udpSocket);
+        m_udpSocket = INVALID_SOCKET;
+    }
+}
+
+bool NetworkManager::SendReliable(const void* packet, int size) {
+    // UDP 전용이면 신뢰 채널 대기열에 (네트워크 스레드가 보내고 ack가 올 때까지 재전송), 아니면 TCP
+    if (m_udpOnly) {
+        std::lock_guard<std::mutex> lock(m_udpMutex);
+        return m_udpSocket != INVALID_SOCKET && m_reliable.Send(packet, size);
+    }
+    return send(sock, (const char*)packet, size, 0) != SOCKET_ERROR;
+}
+
+void NetworkManager::SendUnreliable(const void* packet, int size) {
+    char datagram[MAX_CLIENT_DATAGRAM_SIZE];
+    int body = WriteUnreliableChunk(datagram + sizeof(DatagramHeader), MAX_CLIENT_DATAGRAM_SIZE - static_cast<int>(sizeof(DatagramHeader)), packet, size);
+    if (body == 0) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(m_udpMutex);
+    SendDatagram(datagram, body);
+}
+
+void NetworkManager::SendDatagram(char* datagram, int bodySize) {
+    // m_udpMutex 를 잡은 상태에서 호출. 헤더를 채우고 (신뢰 채널 ack를 함께 실음) 보냄
+    if (m_udpSocket == INVALID_SOCKET) return;
+    DatagramHeader header;
+    header.token = m_udpToken;
+    header.clientID = m_udpToken != 0 ? m_myClientID : 0;
+    header.sequence = ++m_udpSendSequence;
+    header.reliableAck = m_reliable.GetAck();
+    header.reliableAckBits = m_reliable.GetAckBits();
+    memcpy(datagram, &header, sizeof(header));
+    m_reliable.OnAckSent();
+    m_lastDatagramSendTime = GetTickCount();
+
+    if (send(m_udpSocket, datagram, static_cast<int>(sizeof(header)) + bodySize, 0) == SOCKET_ERROR) {
+        int error = WSAGetLastError();
+        if (error != WSAEWOULDBLOCK && error != WSAECONNRESET) {   // 송신 버퍼 가득 / 이전 송신의 ICMP - 이번 것만 버림
+            LogToFile("[UDP] Send failed: " + std::to_string(error));
+        }
+    }
+}
+
+void NetworkManager::FlushDatagrams() {
+    // 새 세그먼트/재전송/ack를 보내고, 한동안 보낸 것이 없으면 빈 데이터그램으로 세션 유지
+    std::lock_guard<std::mutex> lock(m_udpMutex);
+    if (m_udpSocket == INVALID_SOCKET || !m_udpOnly) return;
+    char datagram[MAX_CLIENT_DATAGRAM_SIZE];
+    const int capacity = MAX_CLIENT_DATAGRAM_SIZE - static_cast<int>(sizeof(DatagramHeader));
+    const auto now = ReliableChannel::Clock::now();
+    while (true) {
+        int body = m_reliable.WriteSegments(datagram + sizeof(DatagramHeader), capacity, now);
+        bool keepAlive = m_udpToken != 0 && GetTickCount() - m_lastDatagramSendTime >= UDP_KEEPALIVE_MS;
+        if (body == 0 && !m_reliable.NeedsAck() && !keepAlive) break;
+        SendDatagram(datagram, body);
+        if (body == 0) break;
+    }
+}
+
+void NetworkManager::ReceiveDatagrams() {
+    // 데이터그램을 받을 수 있는 만큼 모두 해석. 패킷 처리(핸들러가 다시 송신할 수 있음)는 잠금을 푼 뒤에
+    char datagram[MAX_DATAGRAM_SIZE];
+    std::vector<char> packets;
+    {
+        std::lock_guard<std::mutex> lock(m_udpMutex);
+        while (m_udpSocket != INVALID_SOCKET) {
+            int received = recv(m_udpSocket, datagram, sizeof(datagram), 0);
+            if (received == SOCKET_ERROR) {
+                if (WSAGetLastError() == WSAECONNRESET) continue;   // 서버 포트가 닫혔다는 ICMP - 다음 데이터그램 확인
+                break;  // WSAEWOULDBLOCK - 더 없음
             }
+            if (received < static_cast<int>(sizeof(DatagramHeader))) continue;
 
-            default:
-                LogToFile("[Warning] Unknown packet type: " + std::to_string(header->type));
-                break;
+            DatagramHeader header;
+            memcpy(&header, datagram, sizeof(header));
+            // 로그인 전(UDP 전용)에는 서버가 정한 토큰을 아직 모름 - connect 한 소켓이라 서버에서 온 것만 받음
+            if (m_udpToken != 0 && (header.token != m_udpToken || header.clientID != m_myClientID)) continue;
+
+            bool fresh = m_udpRecv.Accept(header.sequence);   // 오래된 데이터그램은 비신뢰 청크만 버림
+            m_reliable.OnAck(header.reliableAck, header.reliableAckBits, ReliableChannel::Clock::now());
+            ParseDatagramChunks(datagram + sizeof(header), received - static_cast<int>(sizeof(header)),
+                [&](const char* packet, int size) {
+                    if (!fresh || size < static_cast<int>(sizeof(PacketHeader))) return;
+                    PacketHeader packetHeader = ReadPacketHeader(packet);
+                    if (packetHeader.size != size) return;
+                    if (packetHeader.type != PACKET_PLAYER_UPDATE && packetHeader.type != PACKET_TIGER_SNAPSHOT) return;
+                    packets.insert(packets.end(), packet, packet + size);
+                },
+                [&](uint16_t segment, uint8_t fragIndex, uint8_t fragCount, const char* data, int size) {
+                    m_reliable.OnSegment(segment, fragIndex, fragCount, data, size, [&](const char* message, int messageSize) {
+                        packets.insert(packets.end(), message, message + messageSize);
+                    });
+                });
         }
     }
-    catch (const std::exception& e) {
-        LogToFile("[Error] Failed to process packet: " + std::string(e.what()));
-        // 예외를 상위로 전파하지 않고 여기서 처리
+
+    // 받은 순서대로 처리 (신뢰 메시지 하나에 여러 패킷이 이어져 있을 수 있음)
+    int offset = 0;
+    int available = static_cast<int>(packets.size());
+    while (available - offset >= static_cast<int>(sizeof(PacketHeader))) {
+        PacketHeader header = ReadPacketHeader(packets.data() + offset);
+        if (header.size < sizeof(PacketHeader) || header.size > available - offset) break;
+        try {
+            ProcessPacket(packets.data() + offset);
+        } catch (const std::exception& e) {
+            LogToFile("[Error] Exception during datagram processing: " + std::string(e.what()));
+        }
+        offset += header.size;
     }
+}
 
-    // 패킷 처리 완료 로그 제거
+void NetworkManager::ApplyTigerUpdate(int tigerID, float x, float y, float z, float rotY) {
+    auto it = m_tigers.find(tigerID);
+    if (it == m_tigers.end()) {
+        return;
+    }
+    
+    // Tiger 정보 업데이트
+    TigerInfo& tiger = it->second;
+    tiger.x = x;
+    tiger.y = y;
+    tiger.z = z;
+    tiger.rotY = rotY;
+    
+    // Scene의 Tiger 오브젝트 업데이트
+    if (m_scene) {
+        try {
+            m_scene->UpdateTigerObject(tigerID, x, y, z, rotY);
+        }
+        catch (...) {
+            // 예외가 발생해도 클라이언트는 계속 실행
+        }
+    }
+}
+
+void NetworkManager::OnPacket(PacketView<PacketWorldBootstrap> pkt) {
+    int treeCount = pkt.Get(&PacketWorldBootstrap::treeCount);
+    int tigerCount = pkt.Get(&PacketWorldBootstrap::tigerCount);
+    int playerCount = pkt.Get(&PacketWorldBootstrap::playerCount);
+    LogToFile("[Bootstrap] Received world: " + std::to_string(treeCount) + " trees, " + std::to_string(tigerCount) + " tigers, "
+        + std::to_string(playerCount) + " players (" + std::to_string(pkt.Size()) + " bytes)");
+    
+    // 로그인 상태 확인 - 로그인 전에 받은 부트스트랩은 무시
+    if (!m_isLoggedIn) {
+        LogToFile("[Bootstrap] Ignoring world bootstrap - not logged in yet");
+        return;
+    }
+    
+    // 나무는 메인 스레드에서 만들도록 큐에, 호랑이/플레이어는 스폰 패킷과 같은 경로로
+    // (y 는 오지 않음 - 호랑이/나무는 지면에 세우고, 플레이어는 다음 위치 갱신이 덮어씀)
+    std::vector<TreeSpawnRequest> trees;
+    trees.reserve(treeCount);
+    const uint8_t* entries = reinterpret_cast<const uint8_t*>(pkt.Data()) + sizeof(PacketWorldBootstrap);
+    size_t entriesSize = static_cast<size_t>(pkt.Size()) - sizeof(PacketWorldBootstrap);
+    bool decoded = DecodeWorldBootstrap(entries, entriesSize, treeCount, tigerCount, playerCount,
+        [&](const BootstrapTree& tree) {
+            TreeSpawnRequest request;
+            request.treeID = static_cast<int>(trees.size()) + 1;
+            request.x = tree.x;
+            request.y = 0.0f;
+            request.z = tree.z;
+            request.rotY = tree.rotY;
+            request.treeType = tree.treeType;
+            trees.push_back(request);
+        },
+        [&](const QuantizedEntityState& tiger) {
+            SpawnTiger(static_cast<int>(tiger.entityID), DequantizePosition(tiger.x), 0.0f, DequantizePosition(tiger.z), DequantizeYaw(tiger.yaw));
+        },
+        [&](const BootstrapPlayer& player) {
+            if (player.clientID == m_myClientID) return;
+            uint16_t clip = DequantizeClip(player.state.clip);
+            OtherPlayerManager::GetInstance()->UpdateOtherPlayer(player.clientID, DequantizePosition(player.state.x), 0.0f,
+                DequantizePosition(player.state.z), DequantizeYaw(player.state.yaw), clip,
+                DequantizeAnimTime(player.state.animTime, GetAnimationClipDuration(clip)));
+            LogToFile("[Bootstrap] Spawned other player: " + std::to_string(player.clientID) + " (" + std::string(player.username) + ")");
+        });
+    if (!decoded) {
+        LogToFile("[Warning] Malformed world bootstrap, applied entries up to the error");
+    }
+    
+    // 나무 생성 요청을 큐에 추가 (스레드 안전)
+    {
+        std::lock_guard<std::mutex> lock(m_treeSpawnMutex);
+        for (const TreeSpawnRequest& request : trees) {
+            m_treeSpawnQueue.push(request);
+        }
+        LogToFile("[Tree] Added " + std::to_string(trees.size()) + " tree spawn requests to queue");
+    }
 }
 
 void NetworkManager::Shutdown() {
@@ -680,6 +1013,7 @@ void NetworkManager::Shutdown() {
         CloseHandle(m_networkThread);
         m_networkThread = NULL;
     }
+    CloseUdpChannel();
     if (sock != INVALID_SOCKET) {
         closesocket(sock);
         sock = INVALID_SOCKET;
@@ -713,9 +1047,9 @@ void NetworkManager::ProcessTreeSpawnQueue() {
     
     LogToFile("[Tree] Processing tree spawn queue, size: " + std::to_string(m_treeSpawnQueue.size()));
     
-    // 한 번에 최대 1개씩만 처리 (더욱 안전하게)
+    // 프레임이 끊기지 않도록 프레임당 일부만 처리 (나머지는 다음 프레임에)
     int processedCount = 0;
-    const int MAX_PROCESS_PER_FRAME = 1;
+    const int MAX_PROCESS_PER_FRAME = 16;
     
     while (!m_treeSpawnQueue.empty() && processedCount < MAX_PROCESS_PER_FRAME) {
         TreeSpawnRequest request = m_treeSpawnQueue.front();
@@ -730,9 +1064,6 @@ void NetworkManager::ProcessTreeSpawnQueue() {
                 // 나무 생성 시도
                 m_scene->CreateTreeObject(request.treeID, request.x, request.y, request.z, request.rotY, request.treeType, m_scene->GetDevice());
                 LogToFile("[Tree] Successfully created tree: " + std::to_string(request.treeID));
-                
-                // 나무 생성 후 더 긴 지연 (GPU 리소스 안정화)
-                Sleep(100); // 100ms로 증가
             } else {
                 LogToFile("[Tree] Scene or device is null, skipping tree creation");
             }
@@ -1,6 +1,7 @@
 #pragma once
 #include "stdafx.h"
 #include "Packet.h"
+#include "../Common/RecvRing.h"
 #include "Scene.h"
 #include "GameTimer.h"
 #include <fstream>
@@ -35,6 +36,7 @@ public:
     ~NetworkManager();
     bool Initialize(const char* serverIP, int port, Scene* scene);
     void SetScene(Scene* scene) { m_scene = scene; }
+    void SetUdpOnly(bool udpOnly) { m_udpOnly = udpOnly; }   // Initialize 전에 호출
     void SendPlayerUpdate(float x, float y, float z, float rotY);
     void SendLoginRequest(const std::string& username);
     void SendPlayerDisconnect();
@@ -54,8 +56,34 @@ public:
 
 private:
     static DWORD WINAPI NetworkThread(LPVOID arg);
-    void ProcessPacket(char* buffer);
+    void ProcessPacket(const char* buffer);
     void ProcessTreeSpawnQueue(); // 나무 생성 큐 처리
+    void SpawnTiger(int tigerID, float x, float y, float z, float rotY);  // 스폰 패킷 / 부트스트랩 공용
+    void ApplyTigerUpdate(int tigerID, float x, float y, float z, float rotY);
+    void SendSnapshotAck(uint32_t tick);
+    // UDP 채널 (UDP 전용이면 모든 패킷, 아니면 로그인 응답으로 협상해 위치/스냅샷/ack만)
+    bool OpenUdpChannel(unsigned short port, uint32_t token);
+    bool OpenUdpSocket(const SOCKADDR_IN& serverAddr);
+    void CloseUdpChannel();
+    bool SendReliable(const void* packet, int size);
+    void SendUnreliable(const void* packet, int size);
+    void SendDatagram(char* datagram, int bodySize);
+    void FlushDatagrams();
+    void ReceiveDatagrams();
+
+    // 패킷 핸들러 (공용 스키마의 핸들러 테이블이 타입 번호로 바로 호출)
+    friend class PacketDispatcher<NetworkManager>;
+    void OnPacket(PacketView<PacketLoginResponse> pkt);
+    void OnPacket(PacketView<PacketPlayerSpawn> pkt);
+    void OnPacket(PacketView<PacketPlayerDisconnect> pkt);
+    void OnPacket(PacketView<PacketPlayerUpdate> pkt);
+    void OnPacket(PacketView<PacketTigerSpawn> pkt);
+    void OnPacket(PacketView<PacketTigerUpdate> pkt);
+    void OnPacket(PacketView<PacketTigerSnapshot> pkt);
+    void OnPacket(PacketView<PacketWorldBootstrap> pkt);
+    void OnPacket(PacketView<PacketEntityLeave> pkt);
+    template<typename T>
+    void OnPacket(PacketView<T> pkt);   // 클라이언트가 받지 않는 패킷
 
     struct TigerInfo {
         int tigerID;
@@ -63,6 +91,9 @@ private:
         float rotY;
     };
     std::unordered_map<int, TigerInfo> m_tigers;  // 타이거 정보 저장
+    uint32_t m_lastSnapshotTick{0};     // 마지막으로 적용한 호랑이 스냅샷의 서버 틱
+    SnapshotHistory m_snapshotHistory;  // 최근 복원한 스냅샷 (서버가 고른 델타 기준점 조회)
+    SnapshotEntities m_snapshotScratch; // 복원 작업 공간 (Store 가 밀려난 스냅샷 벡터로 바꿔 돌려줌)
 
     // 나무 생성 요청 큐 (스레드 안전)
     std::queue<TreeSpawnRequest> m_treeSpawnQueue;
@@ -70,11 +101,21 @@ private:
 
     Scene* m_scene{nullptr};
     SOCKET sock;
+    static constexpr int CLIENT_FRAGMENT_SIZE = MAX_CLIENT_DATAGRAM_SIZE - static_cast<int>(sizeof(DatagramHeader)) - RELIABLE_CHUNK_HEADER_SIZE;
+    static constexpr DWORD UDP_KEEPALIVE_MS = 1000;  // 서버의 UDP 세션 시간 초과(10초)보다 충분히 짧게
+    bool m_udpOnly{true};                // TCP 연결 없이 UDP 하나로 (false = TCP + 위치/스냅샷만 UDP)
+    SOCKET m_udpSocket{INVALID_SOCKET};  // 서버 UDP 포트에 연결된 소켓
+    std::mutex m_udpMutex;               // 아래 UDP 상태 보호 (메인 스레드 송신 / 네트워크 스레드 수신)
+    uint32_t m_udpToken{0};
+    uint32_t m_udpSendSequence{0};
+    SequenceFilter m_udpRecv;            // 오래된/중복 데이터그램 제거
+    ReliableChannel m_reliable{CLIENT_FRAGMENT_SIZE};  // 로그인/준비/연결 해제 (서버 -> 클라이언트는 스폰/나무 목록 등)
+    DWORD m_lastDatagramSendTime{0};
     HANDLE m_networkThread;
     bool m_isRunning;
-    char m_recvBuffer[4096];  // 버퍼 크기를 4KB로 증가
-    char m_packetBuffer[8192];  // 패킷 큐잉을 위한 추가 버퍼
-    int m_packetBufferSize{0};  // 현재 패킷 버퍼에 저장된 데이터 크기
+    RecvRing m_recvRing;  // 소켓이 바로 수신하는 미러링 링 버퍼 (64KB, 패킷을 복사 없이 처리)
+    LzStreamDecoder m_decompressor;     // 서버가 압축한 큰 패킷용 세션 사전 (네트워크 스레드 전용)
+    std::vector<char> m_decompressed;   // 복원한 패킷
     static std::ofstream m_logFile;
     static std::mutex m_logMutex;
     int m_myClientID{0};  // 자신의 클라이언트 ID 저장
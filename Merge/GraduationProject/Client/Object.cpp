@@ -89,7 +89,7 @@ void PlayerObject::OnUpdate(GameTimer& gTimer)
         float y = XMVectorGetY(GetComponent<Position>().GetXMVECTOR());
         if (y > newY) {
             t += gTimer.DeltaTime();
-            //currentFileName = "1P(boy-jump).fbx";
+            //currentClip = ANIM_CLIP_BOY_JUMP;
             GetComponent<Velocity>().SetXMVECTOR(XMVectorSetY(GetComponent<Velocity>().GetXMVECTOR(), 0.5 * -9.8 * (t * t)));
         }
         else {
@@ -99,18 +99,18 @@ void PlayerObject::OnUpdate(GameTimer& gTimer)
 
     XMVECTOR velocity = GetComponent<Velocity>().GetXMVECTOR();
 
-    string currentFileName{};
+    AnimationClipID currentClip = ANIM_CLIP_BOY_IDLE;
     if (XMVector4Equal(velocity, XMVectorZero())) {
-        currentFileName = "1P(boy-idle).fbx";
-        //currentFileName = "boy_pickup_fix.fbx";
+        currentClip = ANIM_CLIP_BOY_IDLE;
+        //currentClip = ANIM_CLIP_BOY_PICKUP;
     }
     else if (XMVectorGetY(velocity) != 0.f) {
-        currentFileName = "1P(boy-jump).fbx";
+        currentClip = ANIM_CLIP_BOY_JUMP;
     }
     else if (XMVectorGetX(velocity) != 0 || XMVectorGetZ(velocity) != 0) {
-        currentFileName = "boy_walk_fix.fbx";
+        currentClip = ANIM_CLIP_BOY_WALK;
         if (abs(XMVectorGetX(velocity)) > 15 || abs(XMVectorGetZ(velocity)) > 15) {
-            currentFileName = "boy_run_fix.fbx";
+            currentClip = ANIM_CLIP_BOY_RUN;
         }
     }
 
@@ -120,7 +120,11 @@ void PlayerObject::OnUpdate(GameTimer& gTimer)
     if (isAnimate) {
         vector<XMFLOAT4X4> finalTransforms{ 90 };
         Animation& animComponent = GetComponent<Animation>();
-        SkinnedData& animData = animComponent.mAnimData->at(currentFileName);
+        SkinnedData& animData = *(*animComponent.mAnimClips)[currentClip];
+        if (animComponent.mCurrentClip != currentClip) {
+            animComponent.mCurrentClip = currentClip;
+            animComponent.mAnimationTime = 0.f;  // 클립이 바뀌면 처음부터 재생
+        }
         animComponent.mAnimationTime += gTimer.DeltaTime();
         string clipName = "Take 001";
         if (animComponent.mAnimationTime >= animData.GetClipEndTime(clipName)) animComponent.mAnimationTime = 0.f;
@@ -650,7 +654,9 @@ void TigerObject::OnUpdate(GameTimer& gTimer)
         if (animComponent.mAnimData && !animComponent.mAnimData->empty()) {
             try {
                 vector<XMFLOAT4X4> finalTransforms{ 90 };
-                SkinnedData& animData = animComponent.mAnimData->at("202411_walk_tiger_center.fbx");
+                SkinnedData* animClip = (*animComponent.mAnimClips)[ANIM_CLIP_TIGER_WALK_CENTER];
+                if (!animClip) throw std::out_of_range("tiger clip not loaded");
+                SkinnedData& animData = *animClip;
                 animComponent.mAnimationTime += gTimer.DeltaTime();
                 string clipName = "Take 001";
                 if (animComponent.mAnimationTime >= animData.GetClipEndTime(clipName)) animComponent.mAnimationTime = 0.f;
@@ -726,6 +732,7 @@ void TigerObject::LateUpdate(GameTimer& gTimer)
 
 void TigerObject::OnRender(ID3D12Device* device, ID3D12GraphicsCommandList* commandList)
 {
+    if (!IsActive()) return;   // 관심 영역 밖으로 나간 호랑이
     CD3DX12_GPU_DESCRIPTOR_HANDLE hDescriptor(m_root->GetDescriptorHeap()->GetGPUDescriptorHandleForHeapStart());
     hDescriptor.Offset(1 + GetComponent<Texture>().mDescriptorStartIndex, device->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV));
     commandList->SetGraphicsRootDescriptorTable(1, hDescriptor);
@@ -59,7 +59,7 @@ void OtherPlayerManager::SpawnOtherPlayer(int clientID) {
     }
 }
 
-void OtherPlayerManager::UpdateOtherPlayer(int clientID, float x, float y, float z, float rotY, const std::string& animationFile, float animationTime) {
+void OtherPlayerManager::UpdateOtherPlayer(int clientID, float x, float y, float z, float rotY, uint16_t animationClip, float animationTime) {
     auto it = otherPlayers.find(clientID);
     if (it == otherPlayers.end()) {
         SpawnOtherPlayer(clientID);
@@ -78,9 +78,9 @@ void OtherPlayerManager::UpdateOtherPlayer(int clientID, float x, float y, float
     rotation.mFloat4 = XMFLOAT4(0.0f, rotY, 0.0f, 0.0f);
     
     // 애니메이션 업데이트 (GraduationProject는 간단한 구조이므로 기본 처리)
-    if (!animationFile.empty() && m_networkManager) {
+    if (IsValidAnimationClip(animationClip) && m_networkManager) {
         m_networkManager->LogToFile("[OtherPlayerManager] Updated player " + std::to_string(clientID) + 
-            " animation: " + animationFile + " time: " + std::to_string(animationTime));
+            " animation: " + GetAnimationClipName(animationClip) + " time: " + std::to_string(animationTime));
     }
 }
 
@@ -29,7 +29,13 @@ void ResourceManager::LoadFbx(const string& fileName, bool onlyAnimation, bool z
 
 	SkinnedData animData;
 	animData.Set(mFbxExtractor->GetBoneHierarchyIndex(), mFbxExtractor->GetOffsetMatrix(), mFbxExtractor->GetAnimation());
-	mAnimData.emplace(fileName ,animData);
+	auto result = mAnimData.emplace(fileName ,animData);
+
+	// 공용 클립 테이블에 있는 파일이면 ID로 바로 찾을 수 있게 등록
+	AnimationClipID clipID = FindAnimationClipID(fileName);
+	if (clipID != ANIM_CLIP_NONE) {
+		mAnimClips[clipID] = &result.first->second;
+	}
 
 
 	mFbxExtractor->ResetAndClear();
@@ -192,6 +198,11 @@ unordered_map<string, SkinnedData>& ResourceManager::GetAnimationData()
 	return mAnimData;
 }
 
+array<SkinnedData*, ANIM_CLIP_COUNT>& ResourceManager::GetAnimationClips()
+{
+	return mAnimClips;
+}
+
 TerrainData& ResourceManager::GetTerrainData()
 {
 	return mTerrainData;
@@ -2,6 +2,7 @@
 #include "stdafx.h"
 #include "FbxExtractor.h"
 #include "Info.h"
+#include "../Common/AnimationClips.h"
 
 class Scene;  // 전방 선언
 
@@ -24,6 +25,7 @@ public:
 	vector<uint32_t>& GetIndexBuffer();
 	unordered_map<string, SubMeshData>& GetSubMeshData();
 	unordered_map<string, SkinnedData>& GetAnimationData();
+	array<SkinnedData*, ANIM_CLIP_COUNT>& GetAnimationClips();
 	TerrainData& GetTerrainData();
 
 private:
@@ -32,6 +34,7 @@ private:
 	vector<uint32_t> mIndexBuffer;
 	unordered_map<string, SubMeshData> mSubMeshData;
 	unordered_map<string, SkinnedData> mAnimData;
+	array<SkinnedData*, ANIM_CLIP_COUNT> mAnimClips{};	// 공용 클립 ID로 바로 찾는 테이블 (mAnimData 원소를 가리킴)
 
 	TerrainData mTerrainData;
 };
@@ -144,6 +144,7 @@ void Scene::BuildObjects(ID3D12Device* device)
     ResourceManager& rm = GetResourceManager();
     auto& subMeshData = rm.GetSubMeshData();
     auto& animData = rm.GetAnimationData();
+    auto& animClips = rm.GetAnimationClips();
 
     Object* objectPtr = nullptr;
 
@@ -159,7 +160,7 @@ void Scene::BuildObjects(ID3D12Device* device)
     objectPtr->AddComponent(Scale{ 0.1f, objectPtr });
     objectPtr->AddComponent(Mesh{ subMeshData.at("1P(boy-idle).fbx"), objectPtr });
     objectPtr->AddComponent(Texture{ m_subTextureData.at(L"boy"), objectPtr });
-    objectPtr->AddComponent(Animation{ animData, objectPtr });
+    objectPtr->AddComponent(Animation{ animData, animClips, objectPtr });
     objectPtr->AddComponent(Gravity{ 2.f, objectPtr });
     objectPtr->AddComponent(Collider{ 0.f, 0.f, 0.f, 4.f, 50.f, 4.f, objectPtr });
 
@@ -173,7 +174,7 @@ void Scene::BuildObjects(ID3D12Device* device)
     objectPtr->AddComponent(Scale{ 0.1f, objectPtr });
     objectPtr->AddComponent(Mesh{ subMeshData.at("1P(boy-idle).fbx"), objectPtr });
     objectPtr->AddComponent(Texture{ m_subTextureData.at(L"boy"), objectPtr });
-    objectPtr->AddComponent(Animation{ animData, objectPtr });
+    objectPtr->AddComponent(Animation{ animData, animClips, objectPtr });
     objectPtr->AddComponent(Gravity{ 2.f, objectPtr });
     objectPtr->AddComponent(Collider{ 0.f, 0.f, 0.f, 4.f, 50.f, 4.f, objectPtr });
     objectPtr->SetActive(false);  // 초기에는 비활성화
@@ -950,7 +951,7 @@ void Scene::CreateTigerObject(int tigerID, float x, float y, float z, ID3D12Devi
         tiger.AddComponent<Rotation>(Rotation{ 0.0f, 0.0f, 0.0f, 0.0f, &tiger });
         tiger.AddComponent<Scale>(Scale{ 0.2f, &tiger });
         tiger.AddComponent<Velocity>(Velocity{ 0.0f, 0.0f, 0.0f, 0.0f, &tiger });
-        tiger.AddComponent<Animation>(Animation{ m_resourceManager->GetAnimationData(), &tiger });
+        tiger.AddComponent<Animation>(Animation{ m_resourceManager->GetAnimationData(), m_resourceManager->GetAnimationClips(), &tiger });
         tiger.AddComponent<Mesh>(Mesh{ m_resourceManager->GetSubMeshData().at("202411_walk_tiger_center.fbx"), &tiger });
         tiger.AddComponent<Texture>(Texture{ m_subTextureData.at(L"tigercolor"), &tiger });
         tiger.AddComponent<Collider>(Collider{ 0.0f, 0.0f, 0.0f, 2.0f, 50.0f, 10.0f, &tiger });
@@ -1001,6 +1002,26 @@ void Scene::UpdateTigerObject(int tigerID, float x, float y, float z, float rotY
     }
 }
 
+void Scene::ShowTigerObject(int tigerID, float x, float z) {
+    wstring objectName = L"NetworkTiger_" + std::to_wstring(tigerID);
+    
+    if (m_objects.find(objectName) != m_objects.end()) {
+        auto& tiger = GetObj<TigerObject>(objectName);
+        tiger.GetComponent<Position>().SetXMVECTOR(XMVectorSet(x, CalculateTerrainHeight(x, z), z, 1.0f));
+        tiger.SetActive(true);
+        m_tigerInterpolationData.erase(tigerID);
+    }
+}
+
+void Scene::HideTigerObject(int tigerID) {
+    wstring objectName = L"NetworkTiger_" + std::to_wstring(tigerID);
+    
+    if (m_objects.find(objectName) != m_objects.end()) {
+        GetObj<TigerObject>(objectName).SetActive(false);
+    }
+    m_tigerInterpolationData.erase(tigerID);
+}
+
 float Scene::CalculateTerrainHeight(float x, float z) {
     ResourceManager& rm = GetResourceManager();
     int width = rm.GetTerrainData().terrainWidth;
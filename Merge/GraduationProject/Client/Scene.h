@@ -62,6 +62,8 @@ public:
     void CreateTigerObject(int tigerID, float x, float y, float z, ID3D12Device* device);
     void CreateTreeObject(int treeID, float x, float y, float z, float rotY, int treeType, ID3D12Device* device);
     void UpdateTigerObject(int tigerID, float x, float y, float z, float rotY);
+    void ShowTigerObject(int tigerID, float x, float z);   // 관심 영역에 다시 들어온 호랑이 (보간 없이 바로 이동)
+    void HideTigerObject(int tigerID);
 
     float CalculateTerrainHeight(float x, float z);
 
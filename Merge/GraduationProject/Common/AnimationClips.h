@@ -0,0 +1,69 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+// 클라이언트/서버 공용 애니메이션 클립 테이블 (PacketSchema.h 가 이 파일을 포함)
+// 네트워크와 서버 AI는 파일명 대신 16비트 클립 ID만 사용하고,
+// 파일명은 클라이언트가 FBX를 로드할 때 ID를 찾는 데만 쓴다.
+// 클립을 추가할 때는 아래 목록에 한 줄만 추가하면 ID/파일명/길이 테이블이 함께 생성된다.
+// (순서가 곧 와이어 값이므로 중간 삽입 없이 끝에 추가)
+
+//  X(ID 이름, FBX 파일명, 클립 길이(초))
+#define ANIMATION_CLIP_TABLE(X)                                         \
+    X(BOY_IDLE,           "1P(boy-idle).fbx",             2.0f)          \
+    X(BOY_JUMP,           "1P(boy-jump).fbx",             1.0f)          \
+    X(BOY_RUN,            "boy_run_fix.fbx",              0.8f)          \
+    X(BOY_WALK,           "boy_walk_fix.fbx",             1.2f)          \
+    X(BOY_PICKUP,         "boy_pickup_fix.fbx",           1.5f)          \
+    X(TIGER_WALK_CENTER,  "202411_walk_tiger_center.fbx", 1.0f)          \
+    X(TIGER_IDLE,         "0722_tiger_idle2.fbx",         2.0f)          \
+    X(TIGER_WALK,         "0113_tiger_walk.fbx",          1.0f)          \
+    X(TIGER_RUN,          "0722_tiger_run.fbx",           0.7f)          \
+    X(TIGER_ATTACK,       "0208_tiger_attack.fbx",        1.0f)
+
+enum AnimationClipID : uint16_t {
+#define ANIMATION_CLIP_ENUM(name, file, duration) ANIM_CLIP_##name,
+    ANIMATION_CLIP_TABLE(ANIMATION_CLIP_ENUM)
+#undef ANIMATION_CLIP_ENUM
+
+    ANIM_CLIP_COUNT,            // 테이블 크기 (마지막에 유지)
+    ANIM_CLIP_NONE = 0xFFFF     // 알 수 없는 클립
+};
+
+struct AnimationClipInfo {
+    const char* fileName;
+    float duration;     // 서버 AI가 애니메이션 시간을 되감을 때 사용
+};
+
+inline constexpr std::array<AnimationClipInfo, ANIM_CLIP_COUNT> ANIMATION_CLIPS = { {
+#define ANIMATION_CLIP_INFO(name, file, duration) { file, duration },
+    ANIMATION_CLIP_TABLE(ANIMATION_CLIP_INFO)
+#undef ANIMATION_CLIP_INFO
+} };
+
+constexpr bool IsValidAnimationClip(uint16_t id) {
+    return id < ANIM_CLIP_COUNT;
+}
+
+constexpr const char* GetAnimationClipName(uint16_t id) {
+    return IsValidAnimationClip(id) ? ANIMATION_CLIPS[id].fileName : "UNKNOWN";
+}
+
+constexpr float GetAnimationClipDuration(uint16_t id) {
+    return IsValidAnimationClip(id) ? ANIMATION_CLIPS[id].duration : 0.0f;
+}
+
+// 파일명 -> 클립 ID (리소스 로드 시에만 사용, 핫패스에서 호출하지 않음)
+constexpr AnimationClipID FindAnimationClipID(std::string_view fileName) {
+    for (size_t i = 0; i < ANIMATION_CLIPS.size(); ++i) {
+        if (fileName == ANIMATION_CLIPS[i].fileName) {
+            return static_cast<AnimationClipID>(i);
+        }
+    }
+    return ANIM_CLIP_NONE;
+}
+
+static_assert(ANIM_CLIP_COUNT < ANIM_CLIP_NONE, "Animation clip table too large for 16-bit IDs");
+static_assert(FindAnimationClipID("0208_tiger_attack.fbx") == ANIM_CLIP_TIGER_ATTACK, "Clip table lookup mismatch");
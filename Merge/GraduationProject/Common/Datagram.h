@@ -0,0 +1,63 @@
+#pragma once
+#include <cstdint>
+
+// 클라이언트/서버 공용 UDP 채널 규약 (PacketSchema.h 가 이 파일을 포함)
+//  - 데이터그램 = [DatagramHeader][청크 ...] (청크 형식은 ReliableChannel.h)
+//    비신뢰 청크: 최신 상태만 의미 있는 패킷 (플레이어 위치, 호랑이 스냅샷, 스냅샷 ack)
+//    신뢰 청크  : 로그인/스폰/퇴장/연결 해제 등 - 순서대로 한 번씩 전달
+//  - UDP 전용 세션: 토큰 0 / clientID 0 으로 LOGIN_REQUEST 를 신뢰 청크로 보내 시작,
+//    LOGIN_RESPONSE 로 clientID 와 토큰을 받은 뒤부터 헤더에 채움
+//  - TCP 세션도 LOGIN_RESPONSE 의 포트/토큰으로 비신뢰 청크만 UDP로 주고받을 수 있음
+//  - 받는 쪽은 이미 받은 것보다 오래된 시퀀스의 비신뢰 청크를 버림 (유실은 다음 데이터그램이 덮어씀)
+
+constexpr int MAX_DATAGRAM_SIZE = 1200;   // 경로 MTU 이하 (IP 조각화 방지)
+constexpr int MAX_CLIENT_DATAGRAM_SIZE = 256;   // 클라이언트 -> 서버 (서버 명령 큐 한 칸에 그대로 담음)
+
+#pragma pack(push, 1)
+struct DatagramHeader {
+    uint32_t token;      // 로그인 때 받은 세션 토큰 (양방향 동일)
+    int clientID;
+    uint32_t sequence;   // 보내는 쪽 채널별 1부터 증가
+    uint16_t reliableAck;       // 다음에 받을 신뢰 세그먼트 번호 (그 앞은 모두 받음)
+    uint32_t reliableAckBits;   // 비트 i = reliableAck + 1 + i 세그먼트 받음
+};
+#pragma pack(pop)
+
+// a가 b보다 최신 시퀀스인지 (2^31 범위 안에서 순환 비교)
+constexpr bool IsNewerSequence(uint32_t a, uint32_t b) {
+    return static_cast<int32_t>(a - b) > 0;
+}
+
+static_assert(IsNewerSequence(2, 1), "Sequence compare");
+static_assert(!IsNewerSequence(1, 1), "Duplicate sequence is not newer");
+static_assert(!IsNewerSequence(1, 2), "Older sequence is not newer");
+static_assert(IsNewerSequence(3, 0xFFFFFFFEu), "Sequence compare must handle wrap-around");
+
+// 수신 시퀀스 필터 (순서가 뒤바뀌었거나 중복된 데이터그램 제거)
+class SequenceFilter {
+public:
+    bool Accept(uint32_t sequence) {
+        if (m_hasReceived && !IsNewerSequence(sequence, m_last)) {
+            m_staleCount++;
+            return false;
+        }
+        if (m_hasReceived) {
+            m_lostCount += sequence - m_last - 1;   // 건너뛴 시퀀스 = 유실 (나중에 늦게 와도 버림)
+        }
+        m_last = sequence;
+        m_hasReceived = true;
+        return true;
+    }
+
+    void Reset() { *this = SequenceFilter{}; }
+
+    bool HasReceived() const { return m_hasReceived; }
+    uint64_t GetStaleCount() const { return m_staleCount; }
+    uint64_t GetLostCount() const { return m_lostCount; }
+
+private:
+    uint32_t m_last = 0;
+    bool m_hasReceived = false;
+    uint64_t m_staleCount = 0;
+    uint64_t m_lostCount = 0;
+};
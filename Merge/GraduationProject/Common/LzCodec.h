@@ -0,0 +1,241 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+// 클라이언트/서버 공용 LZ77 계열 압축 (LZ4 블록과 같은 시퀀스 형식, PacketSchema.h 가 이 파일을 포함)
+//  - 시퀀스 = [토큰: 리터럴 길이 4bit | 일치 길이-4 4bit][리터럴 길이 확장][리터럴][오프셋 16][일치 길이 확장]
+//    길이 필드가 15면 뒤에 255가 아닌 바이트가 나올 때까지 더함. 마지막 시퀀스는 리터럴만 있음
+//  - 해시 테이블 한 번 조회로 일치를 찾는 탐욕 방식 (압축률보다 속도 우선, 일치가 없으면 점점 건너뜀)
+//  - 블록: LzCompress / LzDecompress (블록마다 독립)
+//  - 스트림: LzStreamEncoder / LzStreamDecoder - 앞선 블록들(최대 64KB)을 사전으로 참조하므로
+//    디코더는 인코더가 만든 순서 그대로 모든 블록을 풀어야 함 (TCP / 신뢰 채널처럼 순서가 보장된 경로)
+//    블록마다 번호를 붙여 보내면 디코더가 빠진 블록을 감지함 (빠진 채로 풀면 오류 없이 틀린 데이터가 나옴)
+
+constexpr int LZ_MIN_MATCH = 4;
+constexpr int LZ_MAX_OFFSET = 0xFFFF;
+constexpr int LZ_HASH_BITS = 12;                // 해시 테이블 4096칸 (16KB)
+constexpr int LZ_WINDOW_SIZE = 64 * 1024;       // 스트림 사전 크기
+constexpr int LZ_MAX_BLOCK_SIZE = 64 * 1024;    // 블록 하나의 최대 원본 크기 (패킷 크기 필드가 16bit)
+
+// 압축 결과의 최대 크기 (압축되지 않는 데이터는 리터럴 길이 확장 바이트만큼 커짐)
+constexpr int LzCompressBound(int size) {
+    return size + size / 255 + 16;
+}
+
+namespace LzDetail {
+    using HashTable = std::array<uint32_t, 1 << LZ_HASH_BITS>;   // 위치 + 1 (0 = 비어 있음)
+
+    inline uint32_t Read32(const uint8_t* p) {
+        uint32_t value;
+        memcpy(&value, p, sizeof(value));
+        return value;
+    }
+
+    inline uint32_t Hash(uint32_t sequence) {
+        return (sequence * 2654435761u) >> (32 - LZ_HASH_BITS);
+    }
+
+    inline uint8_t* WriteLength(uint8_t* op, int length) {
+        while (length >= 255) {
+            *op++ = 255;
+            length -= 255;
+        }
+        *op++ = static_cast<uint8_t>(length);
+        return op;
+    }
+
+    inline uint8_t* WriteSequence(uint8_t* op, const uint8_t* literals, int literalLength, int offset, int matchLength) {
+        uint8_t* token = op++;
+        int matchCode = matchLength - LZ_MIN_MATCH;
+        *token = static_cast<uint8_t>((std::min(literalLength, 15) << 4) | (matchLength > 0 ? std::min(matchCode, 15) : 0));
+        if (literalLength >= 15) op = WriteLength(op, literalLength - 15);
+        memcpy(op, literals, literalLength);
+        op += literalLength;
+        if (matchLength > 0) {
+            *op++ = static_cast<uint8_t>(offset);
+            *op++ = static_cast<uint8_t>(offset >> 8);
+            if (matchCode >= 15) op = WriteLength(op, matchCode - 15);
+        }
+        return op;
+    }
+
+    // base[start, end) 를 압축. base[dictStart, start) 는 이미 보낸 데이터(사전)로 참조만 함
+    // dst 는 LzCompressBound(end - start) 바이트 이상이어야 함
+    inline int Compress(const uint8_t* base, int dictStart, int start, int end, HashTable& table, uint8_t* dst) {
+        uint8_t* op = dst;
+        int anchor = start;
+        int ip = start;
+        while (ip + LZ_MIN_MATCH <= end) {
+            uint32_t sequence = Read32(base + ip);
+            uint32_t& slot = table[Hash(sequence)];
+            int ref = static_cast<int>(slot) - 1;
+            slot = static_cast<uint32_t>(ip + 1);
+            if (ref < dictStart || ip - ref > LZ_MAX_OFFSET || Read32(base + ref) != sequence) {
+                ip += 1 + ((ip - anchor) >> 6);   // 일치가 계속 없으면 보폭을 늘림 (압축되지 않는 데이터에서 빠르게 지나감)
+                continue;
+            }
+            int length = LZ_MIN_MATCH;
+            while (ip + length < end && base[ref + length] == base[ip + length]) {
+                ++length;
+            }
+            op = WriteSequence(op, base + anchor, ip - anchor, ip - ref, length);
+            ip += length;
+            anchor = ip;
+        }
+        if (anchor < end) {
+            op = WriteSequence(op, base + anchor, end - anchor, 0, 0);
+        }
+        return static_cast<int>(op - dst);
+    }
+
+    inline bool ReadLength(const uint8_t*& ip, const uint8_t* end, int& length) {
+        uint8_t byte;
+        do {
+            if (ip >= end) return false;
+            byte = *ip++;
+            length += byte;
+            if (length > LZ_MAX_BLOCK_SIZE) return false;
+        } while (byte == 255);
+        return true;
+    }
+
+    // src 를 base[start, ...) 에 복원 (최대 capacity 바이트). base[dictStart, start) 는 사전
+    // 복원한 바이트 수, 형식이 어긋나면 -1
+    inline int Decompress(const uint8_t* src, int srcSize, uint8_t* base, int dictStart, int start, int capacity) {
+        const uint8_t* ip = src;
+        const uint8_t* const ipEnd = src + srcSize;
+        uint8_t* op = base + start;
+        uint8_t* const opEnd = op + capacity;
+        while (ip < ipEnd) {
+            uint8_t token = *ip++;
+            int literalLength = token >> 4;
+            if (literalLength == 15 && !ReadLength(ip, ipEnd, literalLength)) return -1;
+            if (literalLength > ipEnd - ip || literalLength > opEnd - op) return -1;
+            memcpy(op, ip, literalLength);
+            ip += literalLength;
+            op += literalLength;
+            if (ip == ipEnd) break;   // 마지막 시퀀스 (리터럴만)
+
+            if (ipEnd - ip < 2) return -1;
+            int offset = ip[0] | (ip[1] << 8);
+            ip += 2;
+            int matchLength = token & 15;
+            if (matchLength == 15 && !ReadLength(ip, ipEnd, matchLength)) return -1;
+            matchLength += LZ_MIN_MATCH;
+            if (offset == 0 || offset > (op - base) - dictStart || matchLength > opEnd - op) return -1;
+            const uint8_t* match = op - offset;
+            if (offset >= matchLength) {
+                memcpy(op, match, matchLength);
+                op += matchLength;
+            } else {
+                for (int i = 0; i < matchLength; ++i) {   // 겹치는 일치 (반복 패턴) - 한 바이트씩
+                    *op++ = match[i];
+                }
+            }
+        }
+        return static_cast<int>(op - (base + start));
+    }
+}
+
+// 독립 블록 압축. 압축한 바이트 수, dst 가 LzCompressBound(size) 보다 작으면 0
+inline int LzCompress(const void* src, int size, void* dst, int capacity) {
+    if (size < 0 || size > LZ_MAX_BLOCK_SIZE || capacity < LzCompressBound(size)) return 0;
+    LzDetail::HashTable table{};
+    return LzDetail::Compress(static_cast<const uint8_t*>(src), 0, 0, size, table, static_cast<uint8_t*>(dst));
+}
+
+// 독립 블록 복원. 복원한 바이트 수, 형식이 어긋나거나 capacity 를 넘으면 -1
+inline int LzDecompress(const void* src, int srcSize, void* dst, int capacity) {
+    return LzDetail::Decompress(static_cast<const uint8_t*>(src), srcSize, static_cast<uint8_t*>(dst), 0, 0, capacity);
+}
+
+// 스트림 사전 버퍼 (인코더/디코더가 같은 규칙으로 밀어내므로 블록 크기만 같으면 위치가 항상 일치)
+class LzStreamWindow {
+public:
+    LzStreamWindow() : m_buffer(LZ_WINDOW_SIZE + LZ_MAX_BLOCK_SIZE) {}
+
+    // size 바이트 블록을 이어 쓸 자리를 만들고 시작 위치 반환. 밀어낸 바이트 수는 shift
+    int Reserve(int size, int& shift) {
+        shift = 0;
+        if (m_end + size > static_cast<int>(m_buffer.size())) {
+            int keep = std::min(m_end, LZ_WINDOW_SIZE);
+            shift = m_end - keep;
+            memmove(m_buffer.data(), m_buffer.data() + shift, keep);
+            m_end = keep;
+        }
+        return m_end;
+    }
+    void Commit(int size) { m_end += size; }
+    void Reset() { m_end = 0; }
+
+    uint8_t* Data() { return m_buffer.data(); }
+    // 사전 시작 (이보다 앞은 오프셋 범위 밖)
+    int DictStart(int start) const { return std::max(0, start - LZ_MAX_OFFSET); }
+
+private:
+    std::vector<uint8_t> m_buffer;
+    int m_end = 0;
+};
+
+class LzStreamEncoder {
+public:
+    // 블록 하나 압축 (앞선 블록을 사전으로 참조). 압축한 바이트 수, 블록이 너무 크거나 dst 가 작으면 0
+    int Compress(const void* src, int size, void* dst, int capacity) {
+        if (size < 0 || size > LZ_MAX_BLOCK_SIZE || capacity < LzCompressBound(size)) return 0;
+        int shift;
+        int start = m_window.Reserve(size, shift);
+        if (shift > 0) {
+            for (uint32_t& slot : m_table) {   // 밀어낸 만큼 위치를 당기고 사라진 위치는 비움
+                slot = slot > static_cast<uint32_t>(shift) ? slot - shift : 0;
+            }
+        }
+        memcpy(m_window.Data() + start, src, size);
+        int written = LzDetail::Compress(m_window.Data(), m_window.DictStart(start), start, start + size, m_table, static_cast<uint8_t*>(dst));
+        m_window.Commit(size);
+        ++m_sequence;
+        return written;
+    }
+
+    // 다음 Compress 가 만들 블록 번호 (블록마다 1씩, 16bit 에서 되돌아감)
+    uint16_t NextSequence() const { return m_sequence; }
+
+    void Reset() {
+        m_window.Reset();
+        m_table.fill(0);
+        m_sequence = 0;
+    }
+
+private:
+    LzStreamWindow m_window;
+    LzDetail::HashTable m_table{};
+    uint16_t m_sequence = 0;
+};
+
+class LzStreamDecoder {
+public:
+    // 블록 하나 복원 (원본 크기 rawSize 와 인코더의 블록 번호를 알아야 함). 성공하면 복원된 바이트 (다음 Decompress 전까지 유효)
+    // 번호가 기다리던 것과 다르면 (앞 블록이 빠짐) nullptr
+    const uint8_t* Decompress(const void* src, int srcSize, int rawSize, uint16_t sequence) {
+        if (rawSize < 0 || rawSize > LZ_MAX_BLOCK_SIZE || sequence != m_sequence) return nullptr;
+        int shift;
+        int start = m_window.Reserve(rawSize, shift);
+        int decoded = LzDetail::Decompress(static_cast<const uint8_t*>(src), srcSize, m_window.Data(), m_window.DictStart(start), start, rawSize);
+        if (decoded != rawSize) return nullptr;   // 이후 블록도 풀 수 없으므로 호출한 쪽이 연결을 다시 맺어야 함
+        m_window.Commit(rawSize);
+        ++m_sequence;
+        return m_window.Data() + start;
+    }
+
+    void Reset() {
+        m_window.Reset();
+        m_sequence = 0;
+    }
+
+private:
+    LzStreamWindow m_window;
+    uint16_t m_sequence = 0;   // 다음에 올 블록 번호
+};
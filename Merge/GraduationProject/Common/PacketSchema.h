@@ -0,0 +1,386 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <vector>
+#include "AnimationClips.h"
+#include "Quantize.h"
+#include "SnapshotDelta.h"
+#include "Datagram.h"
+#include "ReliableChannel.h"
+#include "WorldBootstrap.h"
+#include "LzCodec.h"
+
+// 클라이언트/서버 공용 패킷 스키마 (Client/Packet.h, Server/Packet.h 가 이 파일을 포함)
+// 패킷을 추가할 때는 구조체를 정의하고 아래 PACKET_SCHEMA 목록에 한 줄만 추가하면
+// 타입 검사, 크기 검사, 핸들러 테이블이 양쪽에 함께 생성된다.
+
+#pragma pack(push, 1)
+struct PacketHeader {
+    unsigned short size;
+    unsigned short type;   // PacketType, 압축된 패킷은 PACKET_FLAG_COMPRESSED 비트가 켜짐
+};
+
+// 큰 패킷 자동 압축 (신뢰/순서 보장 경로 전용, 세션마다 LzStream 사전을 이어 씀)
+//  [PacketHeader size = 압축 후 전체, type = 원래 타입 | PACKET_FLAG_COMPRESSED][원래 크기][블록 번호][LZ 블록 (원래 헤더 뒤 본문)]
+constexpr unsigned short PACKET_FLAG_COMPRESSED = 0x8000;
+constexpr int PACKET_COMPRESS_THRESHOLD = 256;   // 이 크기 이상인 패킷만 압축
+
+struct CompressedPacketHeader {
+    PacketHeader header;
+    unsigned short rawSize;   // 복원한 패킷 크기 (헤더 포함)
+    unsigned short sequence;  // 세션 스트림의 블록 번호 (빠진 압축 패킷 감지)
+};
+
+enum PacketType {
+    PACKET_PLAYER_UPDATE = 1,
+    PACKET_PLAYER_SPAWN = 2,
+    PACKET_TIGER_SPAWN = 3,    // 호랑이 스폰 패킷
+    PACKET_TIGER_UPDATE = 4,   // 호랑이 업데이트 패킷
+    PACKET_LOGIN_REQUEST = 6,  // 로그인 요청
+    PACKET_LOGIN_RESPONSE = 7, // 로그인 응답
+    PACKET_PLAYER_DISCONNECT = 8, // 플레이어 연결 해제
+    PACKET_CLIENT_READY = 9,   // 클라이언트 준비 완료 신호
+    PACKET_TIGER_ATTACK = 10,  // 호랑이 공격 패킷
+    PACKET_TIGER_SNAPSHOT = 11,    // 한 틱의 호랑이 스냅샷 (기준점 대비 델타)
+    PACKET_SNAPSHOT_ACK = 12,      // 클라이언트가 마지막으로 받은 스냅샷 틱
+    PACKET_ENTITY_LEAVE = 13,      // 엔티티가 관심 영역(AOI) 밖으로 나감
+    PACKET_WORLD_BOOTSTRAP = 14,   // CLIENT_READY 응답 - 나무/호랑이/플레이어 전체를 한 번에
+
+    PACKET_TYPE_COUNT          // 타입 테이블 크기 (마지막에 유지)
+};
+static_assert(PACKET_TYPE_COUNT <= PACKET_FLAG_COMPRESSED, "Packet type numbers must not use the compression flag bit");
+
+// 관심 영역 진입/이탈을 알릴 때 쓰는 엔티티 종류
+enum EntityType : uint8_t {
+    ENTITY_TYPE_PLAYER = 0,
+    ENTITY_TYPE_TIGER = 1,
+};
+
+struct PacketPlayerUpdate {
+    PacketHeader header;
+    int clientID;
+    float x, y, z;    // Position
+    float rotY;       // Rotation
+    uint16_t animationClip;  // 현재 애니메이션 클립 ID (AnimationClipID)
+    float animationTime;     // 애니메이션 시간
+};
+
+struct PacketPlayerSpawn {
+    PacketHeader header;
+    int playerID;     // 클라이언트 ID
+    char username[32]; // 사용자명 (최대 31자 + null)
+};
+
+struct PacketTigerSpawn {
+    PacketHeader header;
+    int tigerID;
+    float x, y, z;
+};
+
+struct PacketTigerUpdate {
+    PacketHeader header;
+    int tigerID;
+    float x, y, z;
+    float rotY;
+    uint16_t animationClip;  // 현재 애니메이션 클립 ID (AnimationClipID)
+    float animationTime;     // 애니메이션 시간
+};
+
+// 틱마다 호랑이 전체를 패킷 하나로 전송 (호랑이마다 헤더/디스패치를 반복하지 않음)
+// 뒤에 baselineTick 스냅샷 대비 델타 항목 count개가 비트 단위로 이어 붙음 (SnapshotDelta.h)
+struct PacketTigerSnapshot {
+    PacketHeader header;     // size = sizeof(PacketTigerSnapshot) + 델타 비트열 바이트 수
+    uint32_t tick;           // 서버 시뮬레이션 틱 번호 (클라이언트가 그대로 ack)
+    uint32_t baselineTick;   // 기준 스냅샷 틱 (0 = 기준점 없음, 전체 상태)
+    unsigned short count;    // 델타 항목 수 (바뀐 엔티티만)
+};
+
+struct PacketSnapshotAck {
+    PacketHeader header;
+    uint32_t tick;           // 마지막으로 적용한 스냅샷 틱 (0 = 복원 실패, 전체 상태 요청)
+};
+
+struct PacketLoginRequest {
+    PacketHeader header;
+    char username[32]; // 사용자명 (최대 31자 + null)
+};
+
+struct PacketLoginResponse {
+    PacketHeader header;
+    int clientID;
+    bool success;
+    char message[128]; // 응답 메시지
+    unsigned short udpPort;  // 0 = UDP 채널 없음 (모든 패킷을 TCP로)
+    uint32_t udpToken;       // 이 세션의 데이터그램에 붙일 토큰
+};
+
+struct PacketPlayerDisconnect {
+    PacketHeader header;
+    int playerID;
+    char username[32];
+};
+
+struct PacketClientReady {
+    PacketHeader header;
+    int clientID;
+    float x, z;       // 현재 위치 (부트스트랩에 담을 관심 영역의 중심)
+};
+
+struct PacketTigerAttack {
+    PacketHeader header;
+    int tigerID;
+    float x, y, z;  // 공격 위치
+    float rotY;     // 공격 방향
+};
+// 진입은 기존 스폰 패킷(PacketPlayerSpawn / PacketTigerSpawn)으로 알림
+struct PacketEntityLeave {
+    PacketHeader header;
+    uint8_t entityType;   // EntityType
+    int entityID;         // 플레이어 clientID 또는 tigerID
+};
+
+// 접속한 클라이언트가 한 번의 왕복으로 월드를 받도록 전체 상태를 패킷 하나로
+// 뒤에 나무/호랑이/플레이어 항목이 WorldBootstrap.h 형식으로 이어 붙음
+struct PacketWorldBootstrap {
+    PacketHeader header;         // size = sizeof(PacketWorldBootstrap) + 항목 바이트 수
+    unsigned short treeCount;
+    unsigned short tigerCount;   // 관심 영역 안의 호랑이
+    unsigned short playerCount;  // 관심 영역 안의 다른 플레이어
+};
+#pragma pack(pop)
+
+// 애니메이션은 클립 ID(2바이트)로만 전송 (파일명 문자열 대비 엔티티당 62바이트 절약)
+static_assert(sizeof(PacketPlayerUpdate) == 30, "PacketPlayerUpdate wire size changed");
+static_assert(sizeof(PacketTigerUpdate) == 30, "PacketTigerUpdate wire size changed");
+static_assert(sizeof(PacketTigerSnapshot) + ((QUANT_MAX_ENTITY_ID + 1) * SNAPSHOT_ENTRY_MAX_BITS + 7) / 8 <= 0xFFFF,
+    "A full tiger snapshot must fit one packet");
+
+// 크기 규칙
+//  PACKET_SIZE_FIXED   : header.size == sizeof(구조체)
+//  PACKET_SIZE_VARIABLE: header.size >= sizeof(구조체) (구조체 뒤에 가변 길이 항목이 붙는 패킷)
+enum PacketSizeRule : uint8_t {
+    PACKET_SIZE_NONE,       // 스키마에 없는 타입
+    PACKET_SIZE_FIXED,
+    PACKET_SIZE_VARIABLE,
+};
+
+// X(타입, 구조체, 크기 규칙)
+#define PACKET_SCHEMA(X) \
+    X(PACKET_PLAYER_UPDATE,     PacketPlayerUpdate,     PACKET_SIZE_FIXED) \
+    X(PACKET_PLAYER_SPAWN,      PacketPlayerSpawn,      PACKET_SIZE_FIXED) \
+    X(PACKET_TIGER_SPAWN,       PacketTigerSpawn,       PACKET_SIZE_FIXED) \
+    X(PACKET_TIGER_UPDATE,      PacketTigerUpdate,      PACKET_SIZE_FIXED) \
+    X(PACKET_LOGIN_REQUEST,     PacketLoginRequest,     PACKET_SIZE_FIXED) \
+    X(PACKET_LOGIN_RESPONSE,    PacketLoginResponse,    PACKET_SIZE_FIXED) \
+    X(PACKET_PLAYER_DISCONNECT, PacketPlayerDisconnect, PACKET_SIZE_FIXED) \
+    X(PACKET_CLIENT_READY,      PacketClientReady,      PACKET_SIZE_FIXED) \
+    X(PACKET_TIGER_ATTACK,      PacketTigerAttack,      PACKET_SIZE_FIXED) \
+    X(PACKET_TIGER_SNAPSHOT,    PacketTigerSnapshot,    PACKET_SIZE_VARIABLE) \
+    X(PACKET_SNAPSHOT_ACK,      PacketSnapshotAck,      PACKET_SIZE_FIXED) \
+    X(PACKET_ENTITY_LEAVE,      PacketEntityLeave,      PACKET_SIZE_FIXED) \
+    X(PACKET_WORLD_BOOTSTRAP,   PacketWorldBootstrap,   PACKET_SIZE_VARIABLE)
+
+// 구조체 -> 타입 (패킷을 만들 때 header.type 채우기용)
+template<typename T> struct PacketTypeOf;
+#define PACKET_SCHEMA_TYPE_OF(type, Struct, rule) \
+    template<> struct PacketTypeOf<Struct> { static constexpr PacketType VALUE = type; };
+PACKET_SCHEMA(PACKET_SCHEMA_TYPE_OF)
+#undef PACKET_SCHEMA_TYPE_OF
+
+struct PacketSchemaEntry {
+    unsigned short size;    // FIXED: 정확한 크기, VARIABLE: 최소 크기
+    PacketSizeRule rule;
+    const char* name;
+};
+
+// 타입 번호로 바로 찾는 크기/이름 테이블 (컴파일 시간에 생성)
+inline constexpr std::array<PacketSchemaEntry, PACKET_TYPE_COUNT> PACKET_SCHEMA_TABLE = [] {
+    std::array<PacketSchemaEntry, PACKET_TYPE_COUNT> table{};
+    for (PacketSchemaEntry& entry : table) {
+        entry = { 0, PACKET_SIZE_NONE, "UNKNOWN" };
+    }
+#define PACKET_SCHEMA_ENTRY(type, Struct, rule) \
+    static_assert(sizeof(Struct) <= 0xFFFF, #Struct " exceeds the 16-bit size field"); \
+    table[type] = { static_cast<unsigned short>(sizeof(Struct)), rule, #type };
+    PACKET_SCHEMA(PACKET_SCHEMA_ENTRY)
+#undef PACKET_SCHEMA_ENTRY
+    return table;
+}();
+
+constexpr bool IsKnownPacketType(unsigned type) {
+    return type < PACKET_TYPE_COUNT && PACKET_SCHEMA_TABLE[type].rule != PACKET_SIZE_NONE;
+}
+
+constexpr bool IsValidPacketSize(unsigned type, unsigned size) {
+    if (!IsKnownPacketType(type)) return false;
+    const PacketSchemaEntry& entry = PACKET_SCHEMA_TABLE[type];
+    return entry.rule == PACKET_SIZE_FIXED ? size == entry.size : size >= entry.size;
+}
+
+constexpr const char* GetPacketName(unsigned type) {
+    return type < PACKET_TYPE_COUNT ? PACKET_SCHEMA_TABLE[type].name : "UNKNOWN";
+}
+
+// 정렬되지 않았을 수 있는 위치(수신 버퍼)에서 헤더 읽기
+inline PacketHeader ReadPacketHeader(const char* data) {
+    PacketHeader header;
+    memcpy(&header, data, sizeof(header));
+    return header;
+}
+
+// 압축 패킷을 out 에 만들고 크기 반환. 압축 결과가 16bit 크기를 넘을 수 있으면 0 (원래 패킷을 그대로 보냄)
+// 인코더 사전은 이 패킷을 포함하므로 한 번 압축한 패킷은 반드시 압축된 채로 보내야 함
+inline int CompressPacket(LzStreamEncoder& encoder, const void* packet, int size, std::vector<char>& out) {
+    const int bodySize = size - static_cast<int>(sizeof(PacketHeader));
+    const int bound = static_cast<int>(sizeof(CompressedPacketHeader)) + LzCompressBound(bodySize);
+    if (bodySize <= 0 || bound > 0xFFFF) return 0;
+    out.resize(bound);
+    const uint16_t sequence = encoder.NextSequence();
+    int compressed = encoder.Compress(static_cast<const char*>(packet) + sizeof(PacketHeader), bodySize,
+        out.data() + sizeof(CompressedPacketHeader), LzCompressBound(bodySize));
+    CompressedPacketHeader header;
+    header.header = ReadPacketHeader(static_cast<const char*>(packet));
+    header.header.size = static_cast<unsigned short>(sizeof(CompressedPacketHeader) + compressed);
+    header.header.type |= PACKET_FLAG_COMPRESSED;
+    header.rawSize = static_cast<unsigned short>(size);
+    header.sequence = sequence;
+    memcpy(out.data(), &header, sizeof(header));
+    return header.header.size;
+}
+
+// 압축 패킷을 원래 패킷(헤더 포함)으로 복원해 out 에 기록. 형식이 어긋나거나 앞선 압축 패킷이 빠졌으면 false
+// (이후 패킷도 같은 사전을 쓰므로 실패하면 연결을 다시 맺어야 함)
+inline bool DecompressPacket(LzStreamDecoder& decoder, const char* packet, std::vector<char>& out) {
+    CompressedPacketHeader header;
+    memcpy(&header, packet, sizeof(header));
+    if (header.header.size < sizeof(CompressedPacketHeader) || header.rawSize < sizeof(PacketHeader)) return false;
+    const int bodySize = header.rawSize - static_cast<int>(sizeof(PacketHeader));
+    const uint8_t* body = decoder.Decompress(packet + sizeof(CompressedPacketHeader), header.header.size - static_cast<int>(sizeof(CompressedPacketHeader)), bodySize, header.sequence);
+    if (!body) return false;
+    PacketHeader original = { header.rawSize, static_cast<unsigned short>(header.header.type & ~PACKET_FLAG_COMPRESSED) };
+    out.resize(header.rawSize);
+    memcpy(out.data(), &original, sizeof(original));
+    memcpy(out.data() + sizeof(original), body, bodySize);
+    return true;
+}
+
+// 헤더가 채워진 빈 패킷
+template<typename T>
+T MakePacket() {
+    T packet{};
+    packet.header.size = static_cast<unsigned short>(sizeof(T));
+    packet.header.type = static_cast<unsigned short>(PacketTypeOf<T>::VALUE);
+    return packet;
+}
+
+// 수신 버퍼 위의 패킷을 복사 없이 읽는 뷰
+// pack(1) 구조체는 필드가 정렬되어 있지 않으므로 T*로 캐스팅하지 않고 필드 단위로 memcpy 한다.
+//  view.Get(&PacketTigerSpawn::x), view.GetString(&PacketLoginRequest::username)
+template<typename T>
+class PacketView {
+public:
+    explicit PacketView(const char* data) : m_data(data) {}
+
+    const char* Data() const { return m_data; }
+    int Size() const { return ReadPacketHeader(m_data).size; }
+
+    template<typename M>
+    M Get(M T::* member) const {
+        M value;
+        memcpy(&value, m_data + Offset(member), sizeof(M));
+        return value;
+    }
+
+    // 고정 길이 문자열 필드 (null이 없으면 배열 끝까지)
+    template<size_t N>
+    std::string_view GetString(char (T::* member)[N]) const {
+        const char* text = m_data + Offset(member);
+        const void* end = memchr(text, '\0', N);
+        return std::string_view(text, end ? static_cast<const char*>(end) - text : N);
+    }
+
+    template<typename E, size_t N>
+    E GetElement(E (T::* member)[N], int index) const {
+        E value;
+        memcpy(&value, m_data + Offset(member) + sizeof(E) * index, sizeof(E));
+        return value;
+    }
+
+    // 구조체 뒤에 이어지는 가변 길이 항목 (PACKET_SIZE_VARIABLE 패킷)
+    template<typename E>
+    int TrailingCount() const {
+        return (Size() - static_cast<int>(sizeof(T))) / static_cast<int>(sizeof(E));
+    }
+
+    template<typename E>
+    E GetTrailing(int index) const {
+        E value;
+        memcpy(&value, m_data + sizeof(T) + sizeof(E) * index, sizeof(E));
+        return value;
+    }
+
+    // 구조체 전체가 필요할 때 (저장/수정 후 재전송)
+    T Copy() const {
+        T value;
+        memcpy(&value, m_data, sizeof(T));
+        return value;
+    }
+
+private:
+    template<typename M>
+    static size_t Offset(M T::* member) {
+        static const T probe{};   // 멤버 포인터 -> 바이트 오프셋 (최적화 시 상수로 접힘)
+        return reinterpret_cast<const char*>(&(probe.*member)) - reinterpret_cast<const char*>(&probe);
+    }
+
+    const char* m_data;
+};
+
+// 타입 번호 -> 핸들러 함수 테이블 (컴파일 시간에 생성, 분기 없이 한 번의 인덱스 호출)
+// Handler는 처리할 패킷마다 OnPacket(PacketView<구조체>, Args...) 를 정의하고,
+// 나머지 패킷을 위한 템플릿 OnPacket을 하나 둔다 (비템플릿 오버로드가 우선).
+// private 핸들러를 쓰려면 Handler에서 friend class PacketDispatcher<Handler, Args...>; 선언
+template<typename Handler, typename... Args>
+class PacketDispatcher {
+public:
+    enum Result {
+        DISPATCHED,
+        UNKNOWN_TYPE,   // 스키마에 없는 타입
+        INVALID_SIZE,   // header.size가 스키마와 다르거나 받은 데이터보다 큼
+    };
+
+    // data: 헤더부터 시작하는 패킷 하나, size: 사용할 수 있는 바이트 수
+    static Result Dispatch(Handler& handler, const char* data, int size, Args... args) {
+        if (size < static_cast<int>(sizeof(PacketHeader))) {
+            return INVALID_SIZE;
+        }
+        PacketHeader header = ReadPacketHeader(data);
+        if (!IsKnownPacketType(header.type)) {
+            return UNKNOWN_TYPE;
+        }
+        if (header.size > size || !IsValidPacketSize(header.type, header.size)) {
+            return INVALID_SIZE;
+        }
+        HANDLERS[header.type](handler, data, args...);
+        return DISPATCHED;
+    }
+
+private:
+    using Function = void (*)(Handler&, const char*, Args...);
+
+    template<typename T>
+    static void Invoke(Handler& handler, const char* data, Args... args) {
+        handler.OnPacket(PacketView<T>(data), args...);
+    }
+
+    static constexpr std::array<Function, PACKET_TYPE_COUNT> HANDLERS = [] {
+        std::array<Function, PACKET_TYPE_COUNT> table{};
+#define PACKET_SCHEMA_HANDLER(type, Struct, rule) table[type] = &Invoke<Struct>;
+        PACKET_SCHEMA(PACKET_SCHEMA_HANDLER)
+#undef PACKET_SCHEMA_HANDLER
+        return table;
+    }();
+};
@@ -0,0 +1,224 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include "AnimationClips.h"
+
+// 클라이언트/서버 공용 양자화 레이어 (PacketSchema.h 가 이 파일을 포함)
+// 서버가 보내는 엔티티 상태를 고정소수점 정수로 바꿔 비트 단위로 채운다.
+// 서버는 양자화된 값을 그대로 시뮬레이션 상태로 저장하므로
+// 클라이언트가 복원한 값은 서버가 시뮬레이션한 값과 정확히 같다.
+//  - y는 보내지 않음 (클라이언트가 지형 높이로 다시 계산)
+//  - 정밀도는 아래 비트 수로 조정 (엔트리 크기는 자동으로 따라감)
+
+constexpr float QUANT_WORLD_MIN = 0.0f;        // 월드 경계 (GetBounds 기준 0..1000)
+constexpr float QUANT_WORLD_MAX = 1000.0f;
+constexpr int QUANT_ENTITY_ID_BITS = 12;       // 엔티티 ID (최대 4095)
+constexpr int QUANT_POSITION_BITS = 16;        // x/z (1000 / 65535 ≈ 0.015 단위)
+constexpr int QUANT_YAW_BITS = 16;             // rotY (360 / 65536 ≈ 0.0055도)
+constexpr int QUANT_CLIP_BITS = 4;             // 애니메이션 클립 ID
+constexpr int QUANT_ANIM_TIME_BITS = 8;        // 클립 길이 대비 재생 위치 (1/256)
+
+constexpr int QUANT_ENTITY_STATE_BITS = QUANT_ENTITY_ID_BITS + QUANT_POSITION_BITS * 2 +
+    QUANT_YAW_BITS + QUANT_CLIP_BITS + QUANT_ANIM_TIME_BITS;
+constexpr int QUANT_ENTITY_STATE_BYTES = (QUANT_ENTITY_STATE_BITS + 7) / 8;
+
+constexpr uint32_t QuantMask(int bits) {
+    return bits >= 32 ? 0xFFFFFFFFu : ((1u << bits) - 1u);
+}
+
+constexpr int QUANT_MAX_ENTITY_ID = static_cast<int>(QuantMask(QUANT_ENTITY_ID_BITS));
+constexpr uint32_t QUANT_CLIP_NONE = QuantMask(QUANT_CLIP_BITS);   // ANIM_CLIP_NONE 의 와이어 값
+
+// 양자화 간격 (복원 오차는 간격의 절반 이하)
+constexpr float QUANT_POSITION_STEP = (QUANT_WORLD_MAX - QUANT_WORLD_MIN) / QuantMask(QUANT_POSITION_BITS);
+constexpr float QUANT_YAW_STEP = 360.0f / (QuantMask(QUANT_YAW_BITS) + 1.0f);
+constexpr float QUANT_ANIM_TIME_STEP = 1.0f / (QuantMask(QUANT_ANIM_TIME_BITS) + 1.0f);
+
+static_assert(QUANT_ENTITY_STATE_BYTES < 10, "Quantized entity state must stay under 10 bytes");
+static_assert(ANIM_CLIP_COUNT < QUANT_CLIP_NONE, "Animation clip table does not fit QUANT_CLIP_BITS");
+
+constexpr uint32_t QuantizePosition(float value) {
+    float t = (value - QUANT_WORLD_MIN) / (QUANT_WORLD_MAX - QUANT_WORLD_MIN);
+    if (t <= 0.0f) return 0;
+    if (t >= 1.0f) return QuantMask(QUANT_POSITION_BITS);   // 월드 밖은 경계로 고정
+    return static_cast<uint32_t>(t * QuantMask(QUANT_POSITION_BITS) + 0.5f);
+}
+
+constexpr float DequantizePosition(uint32_t q) {
+    return QUANT_WORLD_MIN + q * QUANT_POSITION_STEP;
+}
+
+// 각도는 360도로 감싸서 [0, 360) 으로 복원
+constexpr uint32_t QuantizeYaw(float degrees) {
+    float turns = degrees / 360.0f;
+    turns -= static_cast<float>(static_cast<int64_t>(turns));
+    if (turns < 0.0f) turns += 1.0f;
+    return static_cast<uint32_t>(turns * (QuantMask(QUANT_YAW_BITS) + 1.0f) + 0.5f) & QuantMask(QUANT_YAW_BITS);
+}
+
+constexpr float DequantizeYaw(uint32_t q) {
+    return q * QUANT_YAW_STEP;
+}
+
+// 애니메이션 시간은 클립 길이에 대한 비율로 보냄 (반복 재생이므로 1.0은 0으로 감김)
+constexpr uint32_t QuantizeAnimTime(float time, float duration) {
+    if (duration <= 0.0f || time <= 0.0f) return 0;
+    float t = time / duration;
+    if (t >= 1.0f) t = 1.0f;
+    return static_cast<uint32_t>(t * (QuantMask(QUANT_ANIM_TIME_BITS) + 1.0f) + 0.5f) & QuantMask(QUANT_ANIM_TIME_BITS);
+}
+
+constexpr float DequantizeAnimTime(uint32_t q, float duration) {
+    return q * QUANT_ANIM_TIME_STEP * duration;
+}
+
+constexpr uint32_t QuantizeClip(uint16_t clip) {
+    return IsValidAnimationClip(clip) ? clip : QUANT_CLIP_NONE;
+}
+
+constexpr uint16_t DequantizeClip(uint32_t q) {
+    return q == QUANT_CLIP_NONE ? static_cast<uint16_t>(ANIM_CLIP_NONE) : static_cast<uint16_t>(q);
+}
+
+// 리틀 엔디언 비트 스트림 (필드 하나는 최대 32비트)
+class BitWriter {
+public:
+    constexpr BitWriter(uint8_t* data) : m_data(data) {}
+
+    constexpr void Write(uint32_t value, int bits) {
+        m_scratch |= static_cast<uint64_t>(value & QuantMask(bits)) << m_scratchBits;
+        m_scratchBits += bits;
+        while (m_scratchBits >= 8) {
+            m_data[m_bytes++] = static_cast<uint8_t>(m_scratch);
+            m_scratch >>= 8;
+            m_scratchBits -= 8;
+        }
+    }
+
+    // 남은 비트를 마지막 바이트에 기록, 기록한 바이트 수 반환
+    constexpr size_t Flush() {
+        if (m_scratchBits > 0) {
+            m_data[m_bytes++] = static_cast<uint8_t>(m_scratch);
+            m_scratch = 0;
+            m_scratchBits = 0;
+        }
+        return m_bytes;
+    }
+
+private:
+    uint8_t* m_data;
+    size_t m_bytes = 0;
+    uint64_t m_scratch = 0;
+    int m_scratchBits = 0;
+};
+
+// 데이터 끝을 넘어 읽으면 0을 돌려주고 Overflowed()가 true (수신 데이터 검증용)
+class BitReader {
+public:
+    constexpr BitReader(const uint8_t* data, size_t size) : m_data(data), m_size(size) {}
+
+    constexpr uint32_t Read(int bits) {
+        while (m_scratchBits < bits) {
+            if (m_bytes >= m_size) {
+                m_overflow = true;
+                return 0;
+            }
+            m_scratch |= static_cast<uint64_t>(m_data[m_bytes++]) << m_scratchBits;
+            m_scratchBits += 8;
+        }
+        uint32_t value = static_cast<uint32_t>(m_scratch) & QuantMask(bits);
+        m_scratch >>= bits;
+        m_scratchBits -= bits;
+        return value;
+    }
+
+    constexpr bool Overflowed() const { return m_overflow; }
+
+private:
+    const uint8_t* m_data;
+    size_t m_size;
+    bool m_overflow = false;
+    size_t m_bytes = 0;
+    uint64_t m_scratch = 0;
+    int m_scratchBits = 0;
+};
+
+// 양자화된 엔티티 상태 (와이어에 그대로 실리는 정수 값)
+struct QuantizedEntityState {
+    uint32_t entityID = 0;
+    uint32_t x = 0, z = 0;
+    uint32_t yaw = 0;
+    uint32_t clip = QUANT_CLIP_NONE;
+    uint32_t animTime = 0;
+};
+
+constexpr QuantizedEntityState QuantizeEntityState(int entityID, float x, float z, float rotY, uint16_t clip, float animationTime) {
+    QuantizedEntityState q;
+    q.entityID = static_cast<uint32_t>(entityID) & QuantMask(QUANT_ENTITY_ID_BITS);
+    q.x = QuantizePosition(x);
+    q.z = QuantizePosition(z);
+    q.yaw = QuantizeYaw(rotY);
+    q.clip = QuantizeClip(clip);
+    q.animTime = QuantizeAnimTime(animationTime, GetAnimationClipDuration(clip));
+    return q;
+}
+
+constexpr void EncodeEntityState(const QuantizedEntityState& q, uint8_t* out) {
+    BitWriter writer(out);
+    writer.Write(q.entityID, QUANT_ENTITY_ID_BITS);
+    writer.Write(q.x, QUANT_POSITION_BITS);
+    writer.Write(q.z, QUANT_POSITION_BITS);
+    writer.Write(q.yaw, QUANT_YAW_BITS);
+    writer.Write(q.clip, QUANT_CLIP_BITS);
+    writer.Write(q.animTime, QUANT_ANIM_TIME_BITS);
+    writer.Flush();
+}
+
+constexpr QuantizedEntityState DecodeEntityState(const uint8_t* in) {
+    BitReader reader(in, QUANT_ENTITY_STATE_BYTES);
+    QuantizedEntityState q;
+    q.entityID = reader.Read(QUANT_ENTITY_ID_BITS);
+    q.x = reader.Read(QUANT_POSITION_BITS);
+    q.z = reader.Read(QUANT_POSITION_BITS);
+    q.yaw = reader.Read(QUANT_YAW_BITS);
+    q.clip = reader.Read(QUANT_CLIP_BITS);
+    q.animTime = reader.Read(QUANT_ANIM_TIME_BITS);
+    return q;
+}
+
+// 컴파일 타임 검사: 복원 오차가 양자화 간격의 절반 이내인지, 인코딩 왕복이 손실 없는지
+namespace QuantizeChecks {
+    constexpr float Abs(float v) { return v < 0.0f ? -v : v; }
+
+    constexpr bool PositionWithinBound(float v) {
+        return Abs(DequantizePosition(QuantizePosition(v)) - v) <= QUANT_POSITION_STEP * 0.5f + 1e-4f;
+    }
+
+    constexpr bool YawWithinBound(float degrees, float expected) {
+        float diff = Abs(DequantizeYaw(QuantizeYaw(degrees)) - expected);
+        return diff <= QUANT_YAW_STEP * 0.5f + 1e-3f || Abs(diff - 360.0f) <= QUANT_YAW_STEP * 0.5f + 1e-3f;
+    }
+
+    constexpr bool AnimTimeWithinBound(float time, float duration) {
+        return Abs(DequantizeAnimTime(QuantizeAnimTime(time, duration), duration) - time) <= QUANT_ANIM_TIME_STEP * duration * 0.5f + 1e-4f;
+    }
+
+    constexpr bool EntityRoundTrip() {
+        QuantizedEntityState in = QuantizeEntityState(4095, 612.34f, 87.5f, -135.0f, ANIM_CLIP_TIGER_RUN, 0.3f);
+        uint8_t buffer[QUANT_ENTITY_STATE_BYTES] = {};
+        EncodeEntityState(in, buffer);
+        QuantizedEntityState out = DecodeEntityState(buffer);
+        return in.entityID == out.entityID && in.x == out.x && in.z == out.z && in.yaw == out.yaw &&
+            in.clip == out.clip && in.animTime == out.animTime;
+    }
+
+    static_assert(PositionWithinBound(0.0f) && PositionWithinBound(1000.0f), "Position bounds must be exact");
+    static_assert(PositionWithinBound(123.456f) && PositionWithinBound(500.0f) && PositionWithinBound(999.99f), "Position error exceeds half step");
+    static_assert(DequantizePosition(QuantizePosition(-50.0f)) == QUANT_WORLD_MIN, "Position below world must clamp");
+    static_assert(DequantizePosition(QuantizePosition(1200.0f)) == QUANT_WORLD_MAX, "Position above world must clamp");
+    static_assert(YawWithinBound(45.0f, 45.0f) && YawWithinBound(359.99f, 359.99f), "Yaw error exceeds half step");
+    static_assert(YawWithinBound(-90.0f, 270.0f) && YawWithinBound(720.0f + 10.0f, 10.0f), "Yaw must wrap to [0, 360)");
+    static_assert(AnimTimeWithinBound(0.0f, 2.0f) && AnimTimeWithinBound(0.77f, 2.0f) && AnimTimeWithinBound(0.69f, 0.7f), "Animation time error exceeds half step");
+    static_assert(DequantizeClip(QuantizeClip(ANIM_CLIP_NONE)) == ANIM_CLIP_NONE, "Unknown clip must survive quantization");
+    static_assert(EntityRoundTrip(), "Entity state encode/decode must be lossless");
+}
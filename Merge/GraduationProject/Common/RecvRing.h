@@ -0,0 +1,112 @@
+#pragma once
+#ifdef _WIN32
+#include <winsock2.h>
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+#include <cstddef>
+#include <cstdint>
+
+// 클라이언트/서버 공용 미러링된 수신 링 버퍼
+// 같은 물리 메모리를 가상 주소에 두 번 연달아 매핑하므로 [base, base + 2 * capacity) 가 항상 이어져 보인다.
+//  - 소켓이 WritePtr()에 바로 수신 (중간 수신 버퍼 -> 패킷 버퍼 복사 없음)
+//  - ReadPtr()부터 Readable() 바이트가 항상 연속 - 링 끝을 넘는 패킷도 복사 없이 그대로 처리
+//  - 처리한 만큼 Consume()으로 읽기 위치만 이동 (memmove 없음)
+// capacity는 페이지(Windows는 할당 단위 64KB) 배수. 패킷 크기 필드가 16bit이므로 64KB면 어떤 패킷도 들어감
+class RecvRing {
+public:
+    static constexpr size_t DEFAULT_CAPACITY = 64 * 1024;
+
+    RecvRing() : m_base(nullptr), m_capacity(0), m_readPos(0), m_writePos(0) {}
+    ~RecvRing() { Destroy(); }
+
+    RecvRing(const RecvRing&) = delete;
+    RecvRing& operator=(const RecvRing&) = delete;
+
+    bool IsCreated() const { return m_base != nullptr; }
+
+    bool Create(size_t capacity = DEFAULT_CAPACITY) {
+        Destroy();
+#ifdef _WIN32
+        // 예약한 주소 범위를 풀고 바로 두 뷰를 매핑 - 그 사이 다른 스레드가 가져가면 재시도
+        HANDLE mapping = CreateFileMappingW(INVALID_HANDLE_VALUE, NULL, PAGE_READWRITE,
+            0, static_cast<DWORD>(capacity), NULL);
+        if (mapping == NULL) return false;
+
+        for (int attempt = 0; attempt < 16 && !m_base; ++attempt) {
+            char* base = static_cast<char*>(VirtualAlloc(NULL, capacity * 2, MEM_RESERVE, PAGE_NOACCESS));
+            if (!base) break;
+            VirtualFree(base, 0, MEM_RELEASE);
+
+            void* first = MapViewOfFileEx(mapping, FILE_MAP_ALL_ACCESS, 0, 0, capacity, base);
+            void* second = first ? MapViewOfFileEx(mapping, FILE_MAP_ALL_ACCESS, 0, 0, capacity, base + capacity) : NULL;
+            if (first && second) {
+                m_base = base;
+            } else {
+                if (first) UnmapViewOfFile(first);
+            }
+        }
+        CloseHandle(mapping);   // 뷰가 매핑을 참조하므로 핸들은 닫아도 됨
+#else
+        int fd = memfd_create("recv_ring", MFD_CLOEXEC);
+        if (fd < 0) return false;
+        if (ftruncate(fd, static_cast<off_t>(capacity)) != 0) {
+            close(fd);
+            return false;
+        }
+
+        void* reserved = mmap(nullptr, capacity * 2, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (reserved != MAP_FAILED) {
+            char* base = static_cast<char*>(reserved);
+            if (mmap(base, capacity, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) != MAP_FAILED &&
+                mmap(base + capacity, capacity, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) != MAP_FAILED) {
+                m_base = base;
+            } else {
+                munmap(reserved, capacity * 2);
+            }
+        }
+        close(fd);
+#endif
+        if (!m_base) return false;
+        m_capacity = capacity;
+        Reset();
+        return true;
+    }
+
+    void Destroy() {
+        if (!m_base) return;
+#ifdef _WIN32
+        UnmapViewOfFile(m_base);
+        UnmapViewOfFile(m_base + m_capacity);
+#else
+        munmap(m_base, m_capacity * 2);
+#endif
+        m_base = nullptr;
+        m_capacity = 0;
+    }
+
+    void Reset() { m_readPos = m_writePos = 0; }
+
+    // 수신할 위치와 남은 공간 (항상 연속)
+    char* WritePtr() const { return m_base + (m_writePos % m_capacity); }
+    size_t Writable() const { return m_capacity - Readable(); }
+    void Commit(size_t bytes) { m_writePos += bytes; }
+
+    // 아직 처리하지 않은 데이터 (항상 연속)
+    const char* ReadPtr() const { return m_base + (m_readPos % m_capacity); }
+    size_t Readable() const { return static_cast<size_t>(m_writePos - m_readPos); }
+    void Consume(size_t bytes) {
+        m_readPos += bytes;
+        if (m_readPos == m_writePos) {
+            Reset();   // 비었으면 앞으로 되돌려 같은 페이지를 계속 사용
+        }
+    }
+
+private:
+    char* m_base;
+    size_t m_capacity;
+    uint64_t m_readPos;    // 누적 위치 (capacity로 나눈 나머지가 실제 오프셋)
+    uint64_t m_writePos;
+};
@@ -0,0 +1,276 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <vector>
+#include "Datagram.h"
+
+// 클라이언트/서버 공용 신뢰-순서 보장 채널 (UDP 데이터그램 위에 다중화)
+//  - 메시지를 조각(세그먼트)으로 나눠 세그먼트 번호를 붙이고, 받는 쪽은 번호 순서대로만 전달
+//  - 모든 데이터그램 헤더에 선택적 ack(다음에 받을 번호 + 그 뒤 비트맵)를 실어 보냄
+//  - ack가 RTO 안에 오지 않은 세그먼트만 다시 보냄 (RTO = SRTT + 4 * RTTVAR, 재전송마다 2배)
+//  - 한 번에 미확인 상태로 둘 수 있는 세그먼트는 RELIABLE_WINDOW 개 (받는 쪽 비트맵 범위)
+//  - 소켓을 직접 다루지 않음 (바이트를 만들고 해석만 함)
+
+constexpr int RELIABLE_WINDOW = 32;                 // ack 번호 + 비트맵 31개 (65536의 약수여야 번호 순환 후에도 슬롯이 겹치지 않음)
+constexpr int RELIABLE_FRAGMENT_SIZE = 1024;        // 서버 -> 클라이언트 조각 크기 (나무 목록 등)
+constexpr int RELIABLE_MAX_FRAGMENTS = 255;
+
+// 청크 종류 (데이터그램 본문 = 청크 나열)
+enum DatagramChunkKind : uint8_t {
+    CHUNK_UNRELIABLE = 1,   // [kind][uint16 length][패킷]
+    CHUNK_RELIABLE = 2,     // [kind][uint16 segment][uint8 fragIndex][uint8 fragCount][uint16 length][조각]
+};
+constexpr int UNRELIABLE_CHUNK_HEADER_SIZE = 3;
+constexpr int RELIABLE_CHUNK_HEADER_SIZE = 7;
+
+// a가 b보다 뒤의 세그먼트 번호인지 (16bit 순환 비교)
+constexpr bool IsNewerSegment(uint16_t a, uint16_t b) {
+    return static_cast<int16_t>(static_cast<uint16_t>(a - b)) > 0;
+}
+static_assert(IsNewerSegment(1, 0xFFFF), "Segment compare must handle wrap-around");
+static_assert(!IsNewerSegment(5, 5), "Same segment is not newer");
+static_assert(65536 % RELIABLE_WINDOW == 0, "Receive window slots must stay distinct across segment wrap-around");
+
+inline int WriteUnreliableChunk(char* out, int capacity, const void* packet, int size) {
+    if (UNRELIABLE_CHUNK_HEADER_SIZE + size > capacity) return 0;
+    out[0] = static_cast<char>(CHUNK_UNRELIABLE);
+    uint16_t length = static_cast<uint16_t>(size);
+    memcpy(out + 1, &length, sizeof(length));
+    memcpy(out + UNRELIABLE_CHUNK_HEADER_SIZE, packet, size);
+    return UNRELIABLE_CHUNK_HEADER_SIZE + size;
+}
+
+// 데이터그램 본문을 청크별로 나눔. 형식이 깨졌으면 false (앞의 청크는 이미 전달됨)
+// onUnreliable(const char* data, int size)
+// onReliable(uint16_t segment, uint8_t fragIndex, uint8_t fragCount, const char* data, int size)
+template<typename OnUnreliable, typename OnReliable>
+bool ParseDatagramChunks(const char* data, int size, OnUnreliable&& onUnreliable, OnReliable&& onReliable) {
+    int offset = 0;
+    while (offset < size) {
+        uint8_t kind = static_cast<uint8_t>(data[offset]);
+        if (kind == CHUNK_UNRELIABLE) {
+            if (size - offset < UNRELIABLE_CHUNK_HEADER_SIZE) return false;
+            uint16_t length;
+            memcpy(&length, data + offset + 1, sizeof(length));
+            offset += UNRELIABLE_CHUNK_HEADER_SIZE;
+            if (size - offset < length) return false;
+            onUnreliable(data + offset, static_cast<int>(length));
+            offset += length;
+        } else if (kind == CHUNK_RELIABLE) {
+            if (size - offset < RELIABLE_CHUNK_HEADER_SIZE) return false;
+            uint16_t segment, length;
+            memcpy(&segment, data + offset + 1, sizeof(segment));
+            uint8_t fragIndex = static_cast<uint8_t>(data[offset + 3]);
+            uint8_t fragCount = static_cast<uint8_t>(data[offset + 4]);
+            memcpy(&length, data + offset + 5, sizeof(length));
+            offset += RELIABLE_CHUNK_HEADER_SIZE;
+            if (size - offset < length || fragCount == 0 || fragIndex >= fragCount) return false;
+            onReliable(segment, fragIndex, fragCount, data + offset, static_cast<int>(length));
+            offset += length;
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
+
+class ReliableChannel {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr float INITIAL_RTO_MS = 200.0f;   // RTT 표본이 없을 때
+    static constexpr float MIN_RTO_MS = 50.0f;
+    static constexpr float MAX_RTO_MS = 2000.0f;
+
+    explicit ReliableChannel(int fragmentSize = RELIABLE_FRAGMENT_SIZE) : m_fragmentSize(fragmentSize) {}
+
+    // 메시지를 조각내 송신 대기열에 추가 (실제 전송은 WriteSegments)
+    bool Send(const void* data, int size) {
+        int fragCount = std::max(1, (size + m_fragmentSize - 1) / m_fragmentSize);
+        if (fragCount > RELIABLE_MAX_FRAGMENTS) return false;
+        const char* bytes = static_cast<const char*>(data);
+        for (int i = 0; i < fragCount; ++i) {
+            int offset = i * m_fragmentSize;
+            int length = std::min(m_fragmentSize, size - offset);
+            Segment segment;
+            segment.number = m_nextSendSegment++;
+            segment.fragIndex = static_cast<uint8_t>(i);
+            segment.fragCount = static_cast<uint8_t>(fragCount);
+            segment.data.assign(bytes + offset, bytes + offset + length);
+            m_sendQueue.push_back(std::move(segment));
+        }
+        return true;
+    }
+
+    // 상대가 보낸 ack 반영 (ack 이전 세그먼트는 모두 받음, ackBits 비트 i = ack + 1 + i 받음)
+    void OnAck(uint16_t ack, uint32_t ackBits, Clock::time_point now) {
+        for (Segment& segment : m_sendQueue) {
+            if (segment.acked || segment.sendCount == 0) continue;
+            bool acked = IsNewerSegment(ack, segment.number);
+            if (!acked && IsNewerSegment(segment.number, ack)) {
+                int bit = static_cast<uint16_t>(segment.number - ack) - 1;
+                acked = bit < 32 && (ackBits & (1u << bit)) != 0;
+            }
+            if (!acked) continue;
+            segment.acked = true;
+            if (segment.sendCount == 1) {
+                AddRttSample(std::chrono::duration<float, std::milli>(now - segment.sentAt).count());   // 재전송한 것은 제외 (Karn)
+            }
+        }
+        while (!m_sendQueue.empty() && m_sendQueue.front().acked) {
+            m_sendQueue.pop_front();
+        }
+    }
+
+    // 받은 신뢰 조각. 순서대로 완성된 메시지는 deliver(const char* data, int size)
+    // 형식이 어긋나면(조각 순서 불일치) false
+    template<typename Func>
+    bool OnSegment(uint16_t number, uint8_t fragIndex, uint8_t fragCount, const char* data, int size, Func&& deliver) {
+        m_ackPending = true;   // 중복이어도 ack는 다시 보냄 (이전 ack가 유실되었을 수 있음)
+        if (!IsNewerSegment(number, static_cast<uint16_t>(m_recvNext - 1))) {
+            return true;   // 이미 전달한 세그먼트
+        }
+        uint16_t offset = static_cast<uint16_t>(number - m_recvNext);
+        if (offset >= RELIABLE_WINDOW) {
+            return true;   // 창 밖 (보내는 쪽이 창을 지키므로 오지 않음)
+        }
+        RecvSlot& slot = m_recvWindow[number % RELIABLE_WINDOW];
+        if (!slot.filled) {
+            slot.filled = true;
+            slot.fragIndex = fragIndex;
+            slot.fragCount = fragCount;
+            slot.data.assign(data, data + size);
+        }
+
+        // 앞에서부터 이어진 세그먼트를 순서대로 조립해 전달
+        while (true) {
+            RecvSlot& next = m_recvWindow[m_recvNext % RELIABLE_WINDOW];
+            if (!next.filled) break;
+            if (next.fragIndex != m_reassemblyFragments) {
+                return false;
+            }
+            m_reassembly.insert(m_reassembly.end(), next.data.begin(), next.data.end());
+            m_reassemblyFragments++;
+            if (next.fragIndex + 1 == next.fragCount) {
+                deliver(m_reassembly.data(), static_cast<int>(m_reassembly.size()));
+                m_reassembly.clear();
+                m_reassemblyFragments = 0;
+            }
+            next.filled = false;
+            next.data.clear();
+            m_recvNext++;
+        }
+        return true;
+    }
+
+    // 이번에 보낼 데이터그램 헤더의 ack
+    uint16_t GetAck() const { return m_recvNext; }
+    uint32_t GetAckBits() const {
+        uint32_t bits = 0;
+        for (int i = 0; i + 1 < RELIABLE_WINDOW; ++i) {
+            if (m_recvWindow[static_cast<uint16_t>(m_recvNext + 1 + i) % RELIABLE_WINDOW].filled) {
+                bits |= 1u << i;
+            }
+        }
+        return bits;
+    }
+    bool NeedsAck() const { return m_ackPending; }
+    void OnAckSent() { m_ackPending = false; }
+
+    // 새 세그먼트와 RTO가 지난 세그먼트를 out에 청크로 기록. 기록한 바이트 수 반환
+    int WriteSegments(char* out, int capacity, Clock::time_point now) {
+        int written = 0;
+        if (m_sendQueue.empty()) return 0;
+        const uint16_t windowStart = m_sendQueue.front().number;
+        const float rto = GetRtoMs();
+        for (Segment& segment : m_sendQueue) {
+            if (static_cast<uint16_t>(segment.number - windowStart) >= RELIABLE_WINDOW) break;
+            if (segment.acked) continue;
+            if (segment.sendCount > 0) {
+                float backoff = static_cast<float>(1 << std::min(segment.sendCount - 1, 4));
+                if (std::chrono::duration<float, std::milli>(now - segment.sentAt).count() < std::min(rto * backoff, MAX_RTO_MS)) {
+                    continue;
+                }
+            }
+            int length = static_cast<int>(segment.data.size());
+            if (written + RELIABLE_CHUNK_HEADER_SIZE + length > capacity) break;
+
+            char* chunk = out + written;
+            chunk[0] = static_cast<char>(CHUNK_RELIABLE);
+            memcpy(chunk + 1, &segment.number, sizeof(segment.number));
+            chunk[3] = static_cast<char>(segment.fragIndex);
+            chunk[4] = static_cast<char>(segment.fragCount);
+            uint16_t length16 = static_cast<uint16_t>(length);
+            memcpy(chunk + 5, &length16, sizeof(length16));
+            memcpy(chunk + RELIABLE_CHUNK_HEADER_SIZE, segment.data.data(), length);
+            written += RELIABLE_CHUNK_HEADER_SIZE + length;
+
+            if (segment.sendCount > 0) {
+                m_resendCount++;   // 이번 데이터그램에 실제로 기록한 재전송만
+            }
+            segment.sentAt = now;
+            segment.sendCount++;
+        }
+        return written;
+    }
+
+    size_t GetPendingCount() const { return m_sendQueue.size(); }
+    float GetRtoMs() const {
+        if (!m_hasRtt) return INITIAL_RTO_MS;
+        return std::clamp(m_srttMs + 4.0f * m_rttVarMs, MIN_RTO_MS, MAX_RTO_MS);
+    }
+    float GetSmoothedRttMs() const { return m_srttMs; }
+    uint64_t GetResendCount() const { return m_resendCount; }
+
+private:
+    // RFC 6298 방식 RTT 평활
+    void AddRttSample(float sampleMs) {
+        if (!m_hasRtt) {
+            m_srttMs = sampleMs;
+            m_rttVarMs = sampleMs / 2.0f;
+            m_hasRtt = true;
+            return;
+        }
+        m_rttVarMs = 0.75f * m_rttVarMs + 0.25f * std::abs(m_srttMs - sampleMs);
+        m_srttMs = 0.875f * m_srttMs + 0.125f * sampleMs;
+    }
+
+    struct Segment {
+        uint16_t number = 0;
+        uint8_t fragIndex = 0;
+        uint8_t fragCount = 1;
+        std::vector<char> data;
+        Clock::time_point sentAt{};
+        int sendCount = 0;
+        bool acked = false;
+    };
+
+    struct RecvSlot {
+        bool filled = false;
+        uint8_t fragIndex = 0;
+        uint8_t fragCount = 0;
+        std::vector<char> data;
+    };
+
+    int m_fragmentSize;
+
+    // 송신
+    std::deque<Segment> m_sendQueue;   // 세그먼트 번호 순, 앞 = 가장 오래된 미확인
+    uint16_t m_nextSendSegment = 0;
+    bool m_hasRtt = false;
+    float m_srttMs = 0.0f;
+    float m_rttVarMs = 0.0f;
+    uint64_t m_resendCount = 0;
+
+    // 수신
+    uint16_t m_recvNext = 0;           // 다음에 전달할 세그먼트
+    std::array<RecvSlot, RELIABLE_WINDOW> m_recvWindow{};
+    std::vector<char> m_reassembly;
+    int m_reassemblyFragments = 0;
+    bool m_ackPending = false;
+};
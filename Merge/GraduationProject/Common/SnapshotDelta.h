@@ -0,0 +1,177 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "Quantize.h"
+
+// 클라이언트/서버 공용 스냅샷 델타 압축 (PacketSchema.h 가 이 파일을 포함)
+//  - 스냅샷 = 한 틱의 엔티티 양자화 상태 목록 (entityID 오름차순)
+//  - 서버는 클라이언트가 마지막으로 ack한 스냅샷(기준점) 대비 바뀐 필드만 보냄
+//    기준점이 없거나 링에서 밀려났으면 빈 스냅샷 대비 = 전체 전송
+//  - 바뀌지 않은 엔티티는 아예 기록하지 않음 (정지한 호랑이는 0바이트)
+//  - ack가 유실되어도 서버는 마지막으로 받은 ack를 계속 기준점으로 쓰므로 복원은 항상 맞음
+//
+// 엔티티 항목 비트 배치: [entityID][필드 마스크][마스크에 켜진 필드 ...]
+//   마스크 0 = 이번 스냅샷에서 빠진 엔티티 (제거)
+
+constexpr int SNAPSHOT_HISTORY_SIZE = 32;   // 클라이언트별로 보관하는 최근 스냅샷 수
+
+enum SnapshotField : uint32_t {
+    SNAPSHOT_FIELD_X    = 1 << 0,
+    SNAPSHOT_FIELD_Z    = 1 << 1,
+    SNAPSHOT_FIELD_YAW  = 1 << 2,
+    SNAPSHOT_FIELD_CLIP = 1 << 3,   // 클립 + 재생 위치 (클립이 그대로면 재생 위치는 클라이언트가 이어서 진행)
+    SNAPSHOT_FIELD_ALL  = 0xF,
+};
+constexpr int SNAPSHOT_FIELD_BITS = 4;
+
+// 엔티티 한 개 항목의 최대 비트 수 (출력 버퍼 크기 계산용)
+constexpr int SNAPSHOT_ENTRY_MAX_BITS = QUANT_ENTITY_ID_BITS + SNAPSHOT_FIELD_BITS +
+    QUANT_POSITION_BITS * 2 + QUANT_YAW_BITS + QUANT_CLIP_BITS + QUANT_ANIM_TIME_BITS;
+
+using SnapshotEntities = std::vector<QuantizedEntityState>;
+// 최근 스냅샷 링 (틱 % 크기 슬롯, 슬롯의 틱이 다르면 이미 밀려난 것)
+// 슬롯 벡터는 계속 재사용: Store 는 넘겨받은 벡터와 슬롯을 맞바꾸고, 밀려난 스냅샷은 비운 채(용량 유지) 돌려줌
+class SnapshotHistory {
+public:
+    void Store(uint32_t tick, SnapshotEntities& snapshot) {
+        Slot& slot = m_slots[tick % SNAPSHOT_HISTORY_SIZE];
+        slot.tick = tick;
+        slot.snapshot.swap(snapshot);
+        snapshot.clear();
+    }
+
+    const SnapshotEntities* Find(uint32_t tick) const {
+        if (tick == 0) return nullptr;   // 0 = 기준점 없음
+        const Slot& slot = m_slots[tick % SNAPSHOT_HISTORY_SIZE];
+        return slot.tick == tick ? &slot.snapshot : nullptr;
+    }
+
+    void Clear() {
+        for (Slot& slot : m_slots) {
+            slot.tick = 0;
+            slot.snapshot.clear();
+        }
+    }
+
+private:
+    struct Slot {
+        uint32_t tick = 0;
+        SnapshotEntities snapshot;
+    };
+    std::array<Slot, SNAPSHOT_HISTORY_SIZE> m_slots{};
+};
+
+inline uint32_t DiffSnapshotFields(const QuantizedEntityState& base, const QuantizedEntityState& cur) {
+    uint32_t mask = 0;
+    if (base.x != cur.x) mask |= SNAPSHOT_FIELD_X;
+    if (base.z != cur.z) mask |= SNAPSHOT_FIELD_Z;
+    if (base.yaw != cur.yaw) mask |= SNAPSHOT_FIELD_YAW;
+    if (base.clip != cur.clip) mask |= SNAPSHOT_FIELD_CLIP;
+    return mask;
+}
+
+// mask 필드를 가진 항목 하나의 비트 수 (WriteSnapshotEntry 와 같은 배치)
+constexpr int SnapshotEntryBits(uint32_t mask) {
+    return QUANT_ENTITY_ID_BITS + SNAPSHOT_FIELD_BITS +
+        ((mask & SNAPSHOT_FIELD_X) ? QUANT_POSITION_BITS : 0) +
+        ((mask & SNAPSHOT_FIELD_Z) ? QUANT_POSITION_BITS : 0) +
+        ((mask & SNAPSHOT_FIELD_YAW) ? QUANT_YAW_BITS : 0) +
+        ((mask & SNAPSHOT_FIELD_CLIP) ? QUANT_CLIP_BITS + QUANT_ANIM_TIME_BITS : 0);
+}
+static_assert(SnapshotEntryBits(SNAPSHOT_FIELD_ALL) == SNAPSHOT_ENTRY_MAX_BITS, "Entry bit count mismatch");
+
+inline void WriteSnapshotEntry(BitWriter& writer, const QuantizedEntityState& state, uint32_t mask) {
+    writer.Write(state.entityID, QUANT_ENTITY_ID_BITS);
+    writer.Write(mask, SNAPSHOT_FIELD_BITS);
+    if (mask & SNAPSHOT_FIELD_X) writer.Write(state.x, QUANT_POSITION_BITS);
+    if (mask & SNAPSHOT_FIELD_Z) writer.Write(state.z, QUANT_POSITION_BITS);
+    if (mask & SNAPSHOT_FIELD_YAW) writer.Write(state.yaw, QUANT_YAW_BITS);
+    if (mask & SNAPSHOT_FIELD_CLIP) {
+        writer.Write(state.clip, QUANT_CLIP_BITS);
+        writer.Write(state.animTime, QUANT_ANIM_TIME_BITS);
+    }
+}
+
+// baseline(없으면 nullptr) 대비 current의 델타를 out에 기록. 기록한 엔티티 수 반환
+inline int EncodeSnapshotDelta(const SnapshotEntities* baseline, const SnapshotEntities& current, std::vector<uint8_t>& out) {
+    static const SnapshotEntities EMPTY;
+    const SnapshotEntities& base = baseline ? *baseline : EMPTY;
+
+    size_t maxBits = (base.size() + current.size()) * SNAPSHOT_ENTRY_MAX_BITS;
+    out.resize((maxBits + 7) / 8);
+    BitWriter writer(out.data());
+    int count = 0;
+
+    // 두 목록 모두 entityID 오름차순이므로 한 번의 병합 순회로 비교
+    size_t b = 0, c = 0;
+    while (b < base.size() || c < current.size()) {
+        if (c == current.size() || (b < base.size() && base[b].entityID < current[c].entityID)) {
+            WriteSnapshotEntry(writer, base[b++], 0);   // 제거됨
+            ++count;
+        } else if (b == base.size() || current[c].entityID < base[b].entityID) {
+            WriteSnapshotEntry(writer, current[c++], SNAPSHOT_FIELD_ALL);   // 새로 들어옴
+            ++count;
+        } else {
+            uint32_t mask = DiffSnapshotFields(base[b++], current[c]);
+            if (mask != 0) {
+                WriteSnapshotEntry(writer, current[c], mask);
+                ++count;
+            }
+            ++c;
+        }
+    }
+
+    out.resize(writer.Flush());
+    return count;
+}
+
+// baseline(없으면 nullptr)에 델타 count개를 적용해 out을 만듦
+// onEntity(const QuantizedEntityState& state, uint32_t mask) 는 항목마다 호출 (mask 0 = 제거)
+// 데이터가 모자라거나 새 엔티티에 필드가 빠져 있으면 false
+template<typename Func>
+bool DecodeSnapshotDelta(const SnapshotEntities* baseline, const uint8_t* data, size_t size, int count,
+    SnapshotEntities& out, Func&& onEntity) {
+    out.clear();
+    if (baseline) {
+        out = *baseline;
+    }
+
+    BitReader reader(data, size);
+    for (int i = 0; i < count; ++i) {
+        QuantizedEntityState entry;
+        entry.entityID = reader.Read(QUANT_ENTITY_ID_BITS);
+        uint32_t mask = reader.Read(SNAPSHOT_FIELD_BITS);
+        if (reader.Overflowed()) return false;
+
+        auto it = std::lower_bound(out.begin(), out.end(), entry.entityID,
+            [](const QuantizedEntityState& s, uint32_t id) { return s.entityID < id; });
+        bool exists = it != out.end() && it->entityID == entry.entityID;
+
+        if (mask == 0) {
+            if (!exists) return false;
+            entry = *it;
+            out.erase(it);
+            onEntity(entry, mask);
+            continue;
+        }
+        if (!exists) {
+            if (mask != SNAPSHOT_FIELD_ALL) return false;   // 기준점에 없는 엔티티는 전체 필드가 와야 함
+            it = out.insert(it, entry);
+        }
+
+        QuantizedEntityState& state = *it;
+        if (mask & SNAPSHOT_FIELD_X) state.x = reader.Read(QUANT_POSITION_BITS);
+        if (mask & SNAPSHOT_FIELD_Z) state.z = reader.Read(QUANT_POSITION_BITS);
+        if (mask & SNAPSHOT_FIELD_YAW) state.yaw = reader.Read(QUANT_YAW_BITS);
+        if (mask & SNAPSHOT_FIELD_CLIP) {
+            state.clip = reader.Read(QUANT_CLIP_BITS);
+            state.animTime = reader.Read(QUANT_ANIM_TIME_BITS);
+        }
+        if (reader.Overflowed()) return false;
+        onEntity(state, mask);
+    }
+    return !reader.Overflowed();
+}
@@ -0,0 +1,105 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include "AnimationClips.h"
+
+// 호랑이 행동 정의 (서버 AI 와 오프라인 시뮬레이션(서버 --tiger-sim-bench)이 같은 표를 사용)
+//  - 상태마다 한 줄: 애니메이션 클립, 이동 속도 배율, 이동 목표, 공격 쿨다운 대기 여부
+//  - 상태 전이는 [현재 상태][이벤트] 표 조회로만 결정 (이벤트 = 가장 가까운 플레이어의 거리 구간)
+//  - 상태를 추가할 때는 아래 표에 한 줄, 전이 표에 한 행을 추가하고 서버에 상태별 훅을 등록
+//    (enum 순서가 곧 전이 표의 행 순서)
+
+constexpr float TIGER_CHASE_RADIUS = 200.0f;     // 이 안의 플레이어를 추격
+constexpr float TIGER_ATTACK_RADIUS = 17.0f;     // 이 안이면 공격
+constexpr float TIGER_MOVE_SPEED = 30.0f;        // 기준 이동 속도 (상태별 배율을 곱함)
+constexpr float TIGER_ATTACK_COOLDOWN = 2.0f;    // 공격 후 다시 추격/공격하기까지 대기 시간
+constexpr float TIGER_FIRE_DELAY = 0.4f;         // 공격 애니메이션 시작부터 발사까지
+constexpr float TIGER_RETARGET_TIME = 2.0f;      // 배회 목표를 다시 고르는 간격
+constexpr float TIGER_WANDER_MIN_DIST = 40.0f;   // 배회 목표까지 거리 범위
+constexpr float TIGER_WANDER_MAX_DIST = 120.0f;
+
+enum TigerSteerTarget : uint8_t {
+    TIGER_STEER_NONE,     // 제자리
+    TIGER_STEER_PLAYER,   // 가장 가까운 플레이어 쪽으로
+    TIGER_STEER_WANDER,   // 배회 목표 쪽으로
+};
+
+//  X(상태 이름, 애니메이션 클립, 멈췄을 때 클립 (NONE = 그대로), 이동 속도 배율, 이동 목표, 쿨다운 대기)
+//  쿨다운 대기 상태는 공격 후 TIGER_ATTACK_COOLDOWN 이 지나야 클립을 바꾸고 움직임
+#define TIGER_STATE_TABLE(X)                                   \
+    X(SEARCH, TIGER_WALK,   TIGER_IDLE, 0.7f, WANDER, false)   \
+    X(CHASE,  TIGER_RUN,    NONE,       1.0f, PLAYER, true)    \
+    X(ATTACK, TIGER_ATTACK, NONE,       0.0f, NONE,   true)
+
+enum TigerState : uint8_t {
+#define TIGER_STATE_ENUM(name, clip, stopClip, speedScale, steer, waitsCooldown) TIGER_STATE_##name,
+    TIGER_STATE_TABLE(TIGER_STATE_ENUM)
+#undef TIGER_STATE_ENUM
+
+    TIGER_STATE_COUNT
+};
+
+struct TigerStateInfo {
+    const char* name;
+    AnimationClipID clip;
+    AnimationClipID stopClip;
+    float speedScale;
+    TigerSteerTarget steer;
+    bool waitsCooldown;
+};
+
+inline constexpr std::array<TigerStateInfo, TIGER_STATE_COUNT> TIGER_STATES = { {
+#define TIGER_STATE_INFO(name, clip, stopClip, speedScale, steer, waitsCooldown) \
+    { #name, ANIM_CLIP_##clip, ANIM_CLIP_##stopClip, speedScale, TIGER_STEER_##steer, waitsCooldown },
+    TIGER_STATE_TABLE(TIGER_STATE_INFO)
+#undef TIGER_STATE_INFO
+} };
+
+// 이벤트 = 추격 반경 안에서 가장 가까운 플레이어의 거리 구간 (서버가 틱마다 SIMD 로 분류)
+enum TigerEvent : uint8_t {
+    TIGER_EVENT_NO_TARGET,          // 추격 반경 안에 플레이어 없음
+    TIGER_EVENT_TARGET_IN_CHASE,    // 추격 반경 안
+    TIGER_EVENT_TARGET_IN_ATTACK,   // 공격 반경 안
+    TIGER_EVENT_COUNT
+};
+
+// [현재 상태][이벤트] -> 다음 상태
+inline constexpr uint8_t TIGER_TRANSITIONS[TIGER_STATE_COUNT][TIGER_EVENT_COUNT] = {
+    //                 NO_TARGET            TARGET_IN_CHASE     TARGET_IN_ATTACK
+    /* SEARCH */ { TIGER_STATE_SEARCH, TIGER_STATE_CHASE, TIGER_STATE_ATTACK },
+    /* CHASE  */ { TIGER_STATE_SEARCH, TIGER_STATE_CHASE, TIGER_STATE_ATTACK },
+    /* ATTACK */ { TIGER_STATE_SEARCH, TIGER_STATE_CHASE, TIGER_STATE_ATTACK },
+};
+
+constexpr TigerState NextTigerState(uint8_t state, uint8_t event) {
+    return static_cast<TigerState>(TIGER_TRANSITIONS[state][event]);
+}
+
+// 컴파일 타임 검사: 전이 표/클립 참조가 표 범위 안인지, 기본 시나리오가 기대대로 흘러가는지
+namespace TigerBehaviorChecks {
+    constexpr bool TransitionsInRange() {
+        for (int state = 0; state < TIGER_STATE_COUNT; ++state) {
+            for (int event = 0; event < TIGER_EVENT_COUNT; ++event) {
+                if (TIGER_TRANSITIONS[state][event] >= TIGER_STATE_COUNT) return false;
+            }
+        }
+        return true;
+    }
+    constexpr bool ClipsValid() {
+        for (const TigerStateInfo& info : TIGER_STATES) {
+            if (!IsValidAnimationClip(info.clip)) return false;
+            if (info.stopClip != ANIM_CLIP_NONE && !IsValidAnimationClip(info.stopClip)) return false;
+        }
+        return true;
+    }
+
+    static_assert(TransitionsInRange(), "Tiger transition table points outside the state table");
+    static_assert(ClipsValid(), "Tiger state table references an unknown animation clip");
+    static_assert(TIGER_ATTACK_RADIUS < TIGER_CHASE_RADIUS, "Attack band must lie inside the chase band");
+    // 오프라인 시나리오: 공격 반경 안에 들어오면 어느 상태에서든 공격, 반경 밖으로 나가면 배회로 돌아감
+    static_assert(NextTigerState(NextTigerState(TIGER_STATE_SEARCH, TIGER_EVENT_TARGET_IN_CHASE), TIGER_EVENT_TARGET_IN_ATTACK) == TIGER_STATE_ATTACK,
+                  "A chasing tiger that closes in must attack");
+    static_assert(NextTigerState(TIGER_STATE_ATTACK, TIGER_EVENT_NO_TARGET) == TIGER_STATE_SEARCH,
+                  "A tiger that loses every player must go back to searching");
+    static_assert(TIGER_STATES[TIGER_STATE_ATTACK].speedScale == 0.0f, "Attacking tigers stand still");
+}
@@ -0,0 +1,93 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include "Quantize.h"
+
+// 클라이언트/서버 공용 월드 부트스트랩 항목 (PacketSchema.h 가 이 파일을 포함)
+// CLIENT_READY 에 대한 응답 하나(PACKET_WORLD_BOOTSTRAP)에 나무/호랑이/플레이어를 모두 담는다.
+//  - PacketWorldBootstrap 뒤에 [나무 ...][호랑이 ...][플레이어 ...] 순서로 이어 붙음
+//  - 나무    : [x 16][z 16][yaw 16][종류 8] 비트 (y 는 보내지 않음 - 지면에 세움)
+//  - 호랑이  : EncodeEntityState 그대로 (스냅샷과 같은 양자화, 서버가 틱마다 만들어 둔 바이트를 복사)
+//  - 플레이어: [clientID 32][EncodeEntityState (entityID 칸 0)][이름 길이 8][이름]
+// 항목은 모두 바이트 단위로 끝나므로 서버는 미리 만든 구간을 그대로 이어 붙이기만 한다.
+
+constexpr int BOOTSTRAP_TREE_TYPE_BITS = 8;
+constexpr int BOOTSTRAP_TREE_BYTES = (QUANT_POSITION_BITS * 2 + QUANT_YAW_BITS + BOOTSTRAP_TREE_TYPE_BITS + 7) / 8;
+constexpr int BOOTSTRAP_TIGER_BYTES = QUANT_ENTITY_STATE_BYTES;
+constexpr int BOOTSTRAP_PLAYER_NAME_MAX = 31;
+constexpr int BOOTSTRAP_PLAYER_HEADER_BYTES = static_cast<int>(sizeof(int32_t)) + QUANT_ENTITY_STATE_BYTES + 1;
+constexpr int BOOTSTRAP_PLAYER_MAX_BYTES = BOOTSTRAP_PLAYER_HEADER_BYTES + BOOTSTRAP_PLAYER_NAME_MAX;
+
+struct BootstrapTree {
+    float x, z;
+    float rotY;
+    int treeType;
+};
+
+struct BootstrapPlayer {
+    int clientID;
+    QuantizedEntityState state;
+    std::string_view username;
+};
+
+inline void EncodeBootstrapTree(float x, float z, float rotY, int treeType, uint8_t* out) {
+    BitWriter writer(out);
+    writer.Write(QuantizePosition(x), QUANT_POSITION_BITS);
+    writer.Write(QuantizePosition(z), QUANT_POSITION_BITS);
+    writer.Write(QuantizeYaw(rotY), QUANT_YAW_BITS);
+    writer.Write(static_cast<uint32_t>(treeType), BOOTSTRAP_TREE_TYPE_BITS);
+    writer.Flush();
+}
+
+// 기록한 바이트 수 반환 (이름은 BOOTSTRAP_PLAYER_NAME_MAX 에서 자름)
+inline int EncodeBootstrapPlayer(int clientID, const QuantizedEntityState& state, std::string_view username, uint8_t* out) {
+    size_t nameLength = std::min(username.size(), static_cast<size_t>(BOOTSTRAP_PLAYER_NAME_MAX));
+    int32_t id = clientID;
+    memcpy(out, &id, sizeof(id));
+    EncodeEntityState(state, out + sizeof(id));
+    out[sizeof(id) + QUANT_ENTITY_STATE_BYTES] = static_cast<uint8_t>(nameLength);
+    memcpy(out + BOOTSTRAP_PLAYER_HEADER_BYTES, username.data(), nameLength);
+    return BOOTSTRAP_PLAYER_HEADER_BYTES + static_cast<int>(nameLength);
+}
+
+// 항목을 차례로 복원해 onTree(const BootstrapTree&), onTiger(const QuantizedEntityState&),
+// onPlayer(const BootstrapPlayer&) 호출. 개수만큼 읽기 전에 데이터가 끝나면 false
+template<typename TreeFunc, typename TigerFunc, typename PlayerFunc>
+bool DecodeWorldBootstrap(const uint8_t* data, size_t size, int treeCount, int tigerCount, int playerCount,
+    TreeFunc&& onTree, TigerFunc&& onTiger, PlayerFunc&& onPlayer) {
+    size_t offset = 0;
+    for (int i = 0; i < treeCount; ++i) {
+        if (size - offset < BOOTSTRAP_TREE_BYTES) return false;
+        BitReader reader(data + offset, BOOTSTRAP_TREE_BYTES);
+        BootstrapTree tree;
+        tree.x = DequantizePosition(reader.Read(QUANT_POSITION_BITS));
+        tree.z = DequantizePosition(reader.Read(QUANT_POSITION_BITS));
+        tree.rotY = DequantizeYaw(reader.Read(QUANT_YAW_BITS));
+        tree.treeType = static_cast<int>(reader.Read(BOOTSTRAP_TREE_TYPE_BITS));
+        onTree(tree);
+        offset += BOOTSTRAP_TREE_BYTES;
+    }
+    for (int i = 0; i < tigerCount; ++i) {
+        if (size - offset < BOOTSTRAP_TIGER_BYTES) return false;
+        onTiger(DecodeEntityState(data + offset));
+        offset += BOOTSTRAP_TIGER_BYTES;
+    }
+    for (int i = 0; i < playerCount; ++i) {
+        if (size - offset < BOOTSTRAP_PLAYER_HEADER_BYTES) return false;
+        BootstrapPlayer player;
+        int32_t id;
+        memcpy(&id, data + offset, sizeof(id));
+        player.clientID = id;
+        player.state = DecodeEntityState(data + offset + sizeof(id));
+        size_t nameLength = data[offset + sizeof(id) + QUANT_ENTITY_STATE_BYTES];
+        offset += BOOTSTRAP_PLAYER_HEADER_BYTES;
+        if (nameLength > BOOTSTRAP_PLAYER_NAME_MAX || size - offset < nameLength) return false;
+        player.username = std::string_view(reinterpret_cast<const char*>(data + offset), nameLength);
+        onPlayer(player);
+        offset += nameLength;
+    }
+    return true;
+}
@@ -0,0 +1,206 @@
+#pragma once
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+// 관심 영역(AOI) 균일 격자
+//  - 1000x1000 월드를 칸(기본 CELL_SIZE, 용도별로 지정)으로 나누고, 틱마다 플레이어/호랑이 위치로 다시 채움
+//  - 조회는 반경이 걸치는 칸만 훑으므로 비용이 전체 인원이 아니라 주변 밀도에 비례
+//  - 최근접 / k-최근접은 가운데 칸부터 고리 모양으로 넓혀 가다가, 다음 고리가 이미 찾은 것보다 멀면 멈춤
+//  - 항목은 칸 순서로 정렬해 한 배열에 연속 저장 (삽입 후 첫 조회 때 계수 정렬) - 한 줄의 칸들이 한 구간
+//  - 삽입은 시뮬레이션 스레드 전용 (락 없음). Build() 뒤의 조회는 읽기만 하므로 잡 워커들이 동시에 실행 가능
+//
+// 키 = [엔티티 종류 32bit][ID 32bit] (정렬하면 종류별로 모이고, 종류 안에서는 ID 순)
+class AoiGrid {
+public:
+    static constexpr float WORLD_MIN = 0.0f;
+    static constexpr float WORLD_MAX = 1000.0f;
+    static constexpr float CELL_SIZE = 125.0f;   // 기본 칸 크기 (관심 영역 반경에 맞춤)
+
+    static uint64_t MakeKey(uint8_t type, int id) {
+        return (static_cast<uint64_t>(type) << 32) | static_cast<uint32_t>(id);
+    }
+    static uint8_t KeyType(uint64_t key) { return static_cast<uint8_t>(key >> 32); }
+    static int KeyID(uint64_t key) { return static_cast<int>(static_cast<uint32_t>(key)); }
+
+    struct Entry {
+        uint64_t key;
+        float x, z;
+    };
+
+    struct Neighbor {
+        float distSq;
+        const Entry* entry;   // 다음 Clear / Insert 전까지 유효
+        bool operator<(const Neighbor& other) const { return distSq < other.distSq; }
+    };
+
+    // 조회 반경보다 가까운 이웃을 주로 찾는 격자(최근접 탐색)는 칸을 작게 잡아 훑는 항목 수를 줄임
+    explicit AoiGrid(float cellSize = CELL_SIZE)
+        : m_cellSize(cellSize)
+        , m_cellsPerAxis(static_cast<int>(std::ceil((WORLD_MAX - WORLD_MIN) / cellSize)))
+        , m_cellStart(m_cellsPerAxis * m_cellsPerAxis + 1, 0) {}
+
+    // 배열 용량은 유지 (틱마다 재할당하지 않음)
+    void Clear() {
+        m_pending.clear();
+        m_pendingCells.clear();
+        m_sorted.clear();
+        std::fill(m_cellStart.begin(), m_cellStart.end(), 0);
+        m_dirty = false;
+    }
+
+    void Insert(uint64_t key, float x, float z) {
+        m_pending.push_back({ key, x, z });
+        m_pendingCells.push_back(CellIndex(x, z));
+        m_dirty = true;
+    }
+
+    float CellSize() const { return m_cellSize; }
+    int CellsPerAxis() const { return m_cellsPerAxis; }
+    // 월드 밖 좌표는 가장자리 칸
+    int CellCoord(float v) const {
+        int c = static_cast<int>((v - WORLD_MIN) / m_cellSize);
+        return std::clamp(c, 0, m_cellsPerAxis - 1);
+    }
+
+    // 칸 [minX, maxX] x [minZ, maxZ] (격자 안으로 잘라냄) 의 항목마다 func(const Entry&)
+    template<typename Func>
+    void ForEachInCells(int minX, int maxX, int minZ, int maxZ, Func&& func) const {
+        Build();
+        minX = std::max(minX, 0);
+        maxX = std::min(maxX, m_cellsPerAxis - 1);
+        for (int cz = std::max(minZ, 0); cz <= std::min(maxZ, m_cellsPerAxis - 1); ++cz) {
+            ForEachInRow(cz, minX, maxX, 0.0f, 0.0f, [&](const Entry& entry, float) { func(entry); });
+        }
+    }
+
+    // (x, z) 반경 radius 안의 엔티티마다 func(uint64_t key, float distSq)
+    template<typename Func>
+    void Query(float x, float z, float radius, Func&& func) const {
+        const float radiusSq = radius * radius;
+        int minX = CellCoord(x - radius), maxX = CellCoord(x + radius);
+        int minZ = CellCoord(z - radius), maxZ = CellCoord(z + radius);
+        Build();
+        for (int cz = minZ; cz <= maxZ; ++cz) {
+            ForEachInRow(cz, minX, maxX, x, z, [&](const Entry& entry, float distSq) {
+                if (distSq <= radiusSq) {
+                    func(entry.key, distSq);
+                }
+            });
+        }
+    }
+
+    // (x, z) 반경 radius 안에서 가장 가까운 엔티티 (없으면 nullptr)
+    const Entry* FindNearest(float x, float z, float radius, float& outDistSq) const {
+        const Entry* best = nullptr;
+        float bestDistSq = radius * radius;
+        ForEachRing(x, z, radius, [&](const Entry& entry, float distSq) {
+            if (distSq <= bestDistSq) {
+                best = &entry;
+                bestDistSq = distSq;
+            }
+        }, [&](float gap) { return best && bestDistSq <= gap * gap; });
+        outDistSq = bestDistSq;
+        return best;
+    }
+
+    // (x, z) 반경 radius 안에서 가까운 순으로 최대 k개를 out 에 (거리 오름차순)
+    void FindKNearest(float x, float z, size_t k, float radius, std::vector<Neighbor>& out) const {
+        out.clear();
+        if (k == 0) return;
+        const float radiusSq = radius * radius;
+        ForEachRing(x, z, radius, [&](const Entry& entry, float distSq) {
+            if (distSq > radiusSq) return;
+            if (out.size() < k) {
+                out.push_back({ distSq, &entry });
+                std::push_heap(out.begin(), out.end());   // 가장 먼 것이 맨 앞인 최대 힙
+            } else if (distSq < out.front().distSq) {
+                std::pop_heap(out.begin(), out.end());
+                out.back() = { distSq, &entry };
+                std::push_heap(out.begin(), out.end());
+            }
+        }, [&](float gap) { return out.size() == k && out.front().distSq <= gap * gap; });
+        std::sort_heap(out.begin(), out.end());
+    }
+
+    // (x, z) 에서 칸 사각형 [minX, maxX] x [minZ, maxZ] 바깥의 칸까지 가장 가까운 거리
+    // (격자 가장자리에 닿은 쪽은 더 볼 칸이 없으므로 제외 - 월드 밖 좌표도 가장자리 칸에 있음, 모두 닿으면 FLT_MAX)
+    float BlockGap(float x, float z, int minX, int maxX, int minZ, int maxZ) const {
+        float gap = FLT_MAX;
+        if (minX > 0) gap = std::min(gap, x - (WORLD_MIN + minX * m_cellSize));
+        if (maxX < m_cellsPerAxis - 1) gap = std::min(gap, (WORLD_MIN + (maxX + 1) * m_cellSize) - x);
+        if (minZ > 0) gap = std::min(gap, z - (WORLD_MIN + minZ * m_cellSize));
+        if (maxZ < m_cellsPerAxis - 1) gap = std::min(gap, (WORLD_MIN + (maxZ + 1) * m_cellSize) - z);
+        return gap;
+    }
+
+    // 삽입된 항목을 칸 순서로 계수 정렬 (같은 칸 안에서는 삽입 순서 유지)
+    // 조회가 처음 필요할 때 저절로 불리지만, 여러 워커가 동시에 조회하기 전에는 미리 호출 (그 뒤 조회는 읽기만 함)
+    void Build() const {
+        if (!m_dirty) return;
+        std::fill(m_cellStart.begin(), m_cellStart.end(), 0);
+        for (int cell : m_pendingCells) {
+            m_cellStart[cell + 1]++;
+        }
+        for (size_t i = 1; i < m_cellStart.size(); ++i) {
+            m_cellStart[i] += m_cellStart[i - 1];
+        }
+        m_cursor.assign(m_cellStart.begin(), m_cellStart.end() - 1);
+        m_sorted.resize(m_pending.size());
+        for (size_t i = 0; i < m_pending.size(); ++i) {
+            m_sorted[m_cursor[m_pendingCells[i]]++] = m_pending[i];
+        }
+        m_dirty = false;
+    }
+
+private:
+    // 가운데 칸에서 고리 단위로 넓혀 가며 func(entry, distSq)
+    // 고리를 하나 끝낼 때마다 아직 보지 않은 칸까지의 최소 거리(gap)로 done(gap) 을 물어 멈춤
+    template<typename Func, typename Done>
+    void ForEachRing(float x, float z, float radius, Func&& func, Done&& done) const {
+        Build();
+        const int cx = CellCoord(x), cz = CellCoord(z);
+        for (int ring = 0; ring < m_cellsPerAxis; ++ring) {
+            const int minX = std::max(cx - ring, 0), maxX = std::min(cx + ring, m_cellsPerAxis - 1);
+            for (int gz = std::max(cz - ring, 0); gz <= std::min(cz + ring, m_cellsPerAxis - 1); ++gz) {
+                if (gz == cz - ring || gz == cz + ring) {
+                    ForEachInRow(gz, minX, maxX, x, z, func);   // 고리의 위/아래 줄은 전부
+                } else {
+                    // 나머지 줄은 양 끝 칸만
+                    if (cx - ring >= 0) ForEachInRow(gz, cx - ring, cx - ring, x, z, func);
+                    if (ring > 0 && cx + ring < m_cellsPerAxis) ForEachInRow(gz, cx + ring, cx + ring, x, z, func);
+                }
+            }
+            float gap = BlockGap(x, z, cx - ring, cx + ring, cz - ring, cz + ring);
+            if (gap > radius || done(gap)) return;
+        }
+    }
+
+    // row 줄의 [minX, maxX] 칸 항목마다 func(entry, distSq) (정렬된 배열의 연속 구간)
+    template<typename Func>
+    void ForEachInRow(int row, int minX, int maxX, float x, float z, Func&& func) const {
+        const Entry* begin = m_sorted.data() + m_cellStart[row * m_cellsPerAxis + minX];
+        const Entry* end = m_sorted.data() + m_cellStart[row * m_cellsPerAxis + maxX + 1];
+        for (const Entry* entry = begin; entry != end; ++entry) {
+            float dx = entry->x - x;
+            float dz = entry->z - z;
+            func(*entry, dx * dx + dz * dz);
+        }
+    }
+
+    int CellIndex(float x, float z) const {
+        return CellCoord(z) * m_cellsPerAxis + CellCoord(x);
+    }
+
+    float m_cellSize;
+    int m_cellsPerAxis;
+    std::vector<Entry> m_pending;       // 삽입 순서
+    std::vector<int> m_pendingCells;    // m_pending 항목별 칸
+    // 조회용 정렬 결과 (const 조회가 처음 필요할 때 만듦)
+    mutable std::vector<Entry> m_sorted;
+    mutable std::vector<int> m_cellStart;   // 칸 i 의 항목 = m_sorted[m_cellStart[i], m_cellStart[i + 1])
+    mutable std::vector<int> m_cursor;
+    mutable bool m_dirty = false;
+};
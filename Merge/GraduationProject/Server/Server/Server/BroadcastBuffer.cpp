@@ -0,0 +1,47 @@
+#include "BroadcastBuffer.h"
+#include <mutex>
+
+namespace {
+    constexpr size_t MAX_POOLED_BUFFERS = 256;
+
+    std::mutex g_poolMutex;
+    std::vector<BroadcastBuffer*> g_pool;
+}
+
+BroadcastRef BroadcastBuffer::Create() {
+    BroadcastBuffer* buffer = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(g_poolMutex);
+        if (!g_pool.empty()) {
+            buffer = g_pool.back();
+            g_pool.pop_back();
+        }
+    }
+    if (!buffer) {
+        buffer = new BroadcastBuffer();
+    }
+    return BroadcastRef(buffer);
+}
+
+void BroadcastBuffer::Append(const void* data, int size) {
+    const char* src = static_cast<const char*>(data);
+    m_data.insert(m_data.end(), src, src + size);
+}
+
+void BroadcastBuffer::Release() {
+    if (m_refCount.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+        return;
+    }
+
+    // 마지막 참조 - 풀로 반환 (풀이 가득 차면 해제)
+    m_data.clear();
+    {
+        std::lock_guard<std::mutex> lock(g_poolMutex);
+        if (g_pool.size() < MAX_POOLED_BUFFERS) {
+            g_pool.push_back(this);
+            return;
+        }
+    }
+    delete this;
+}
+
@@ -0,0 +1,60 @@
+#pragma once
+#include <atomic>
+#include <vector>
+#include <utility>
+
+class BroadcastRef;
+
+// 여러 세션이 함께 참조하는 불변 송신 버퍼 (참조 카운트 + 풀)
+// 틱마다 공유 데이터(호랑이 업데이트, 브로드캐스트 패킷)를 한 번만 직렬화하고,
+// 각 세션의 SendQueue는 복사 없이 참조만 추가한다. 마지막 참조가 풀리면 풀로 돌아감.
+//  - 작성: Create() 후 Append() (아직 공유되기 전, 시뮬레이션 스레드)
+//  - 공유 후에는 읽기만 함 (송신 완료 스레드에서 Release 될 수 있음)
+class BroadcastBuffer {
+public:
+    static BroadcastRef Create();
+
+    void Append(const void* data, int size);
+    const char* Data() const { return m_data.data(); }
+    int Size() const { return static_cast<int>(m_data.size()); }
+
+private:
+    friend class BroadcastRef;
+
+    BroadcastBuffer() : m_refCount(0) {}
+
+    void AddRef() { m_refCount.fetch_add(1, std::memory_order_relaxed); }
+    void Release();
+
+    std::atomic<int> m_refCount;
+    std::vector<char> m_data;   // 풀로 돌아가도 capacity 유지
+};
+
+// BroadcastBuffer 참조 (복사하면 참조 카운트 증가)
+class BroadcastRef {
+public:
+    BroadcastRef() : m_buffer(nullptr) {}
+    explicit BroadcastRef(BroadcastBuffer* buffer) : m_buffer(buffer) { if (m_buffer) m_buffer->AddRef(); }
+    BroadcastRef(const BroadcastRef& other) : m_buffer(other.m_buffer) { if (m_buffer) m_buffer->AddRef(); }
+    BroadcastRef(BroadcastRef&& other) noexcept : m_buffer(other.m_buffer) { other.m_buffer = nullptr; }
+    ~BroadcastRef() { Reset(); }
+
+    BroadcastRef& operator=(BroadcastRef other) noexcept {
+        std::swap(m_buffer, other.m_buffer);
+        return *this;
+    }
+
+    void Reset() {
+        if (m_buffer) {
+            m_buffer->Release();
+            m_buffer = nullptr;
+        }
+    }
+
+    BroadcastBuffer* Get() const { return m_buffer; }
+    BroadcastBuffer* operator->() const { return m_buffer; }
+    explicit operator bool() const { return m_buffer != nullptr; }
+
+private:
+    BroadcastBuffer* m_buffer;
+};
@@ -0,0 +1,297 @@
+#ifdef __linux__
+#include "EpollBackend.h"
+#include <sys/epoll.h>
+#include <sys/uio.h>
+#include <cstdint>
+#include <iostream>
+
+namespace {
+    // epoll_event.data.u64 에 (clientID, socket)을 함께 담는다 (IOCP completion key 역할)
+    uint64_t PackKey(SOCKET socket, int clientID) {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(clientID)) << 32) | static_cast<uint32_t>(socket);
+    }
+    SOCKET KeySocket(uint64_t key) { return static_cast<SOCKET>(key & 0xFFFFFFFFu); }
+    int KeyClientID(uint64_t key) { return static_cast<int>(key >> 32); }
+}
+
+EpollBackend::EpollBackend()
+    : m_epollFd(-1)
+{
+}
+
+EpollBackend::~EpollBackend() {
+    Shutdown();
+}
+
+bool EpollBackend::Initialize(ReceiveCallback onReceive, DisconnectCallback onDisconnect) {
+    m_onReceive = std::move(onReceive);
+    m_onDisconnect = std::move(onDisconnect);
+
+    m_epollFd = epoll_create1(EPOLL_CLOEXEC);
+    if (m_epollFd < 0) {
+        std::cout << "[Error] epoll_create1 failed: " << errno << std::endl;
+        return false;
+    }
+
+    // 접속 폭주 중에 힙 할당이 일어나지 않도록 미리 확보
+    m_connections.assign(RESERVED_CONNECTIONS, nullptr);
+    m_flushList.reserve(RESERVED_CONNECTIONS);
+    SlabPool<Connection>::Instance().Reserve(RESERVED_CONNECTIONS);
+    return true;
+}
+
+void EpollBackend::Shutdown() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (size_t socket = 0; socket < m_connections.size(); ++socket) {
+            if (!m_connections[socket]) continue;
+            ReleaseConnection(m_connections[socket], static_cast<SOCKET>(socket));
+            m_connections[socket] = nullptr;
+        }
+        m_flushList.clear();
+    }
+    if (m_epollFd >= 0) {
+        close(m_epollFd);
+        m_epollFd = -1;
+    }
+}
+
+bool EpollBackend::AddClient(SOCKET socket, int clientID) {
+    // Nagle 비활성화 (작은 상태 패킷 위주)
+    int noDelay = 1;
+    setsockopt(socket, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        Connection* conn = SlabPool<Connection>::Instance().Allocate();
+        if (!conn) {
+            close(socket);
+            return false;
+        }
+        if (!conn->recvRing.IsCreated() && !conn->recvRing.Create()) {
+            std::cout << "[Error] Failed to create receive ring" << std::endl;
+            SlabPool<Connection>::Instance().Free(conn);
+            close(socket);
+            return false;
+        }
+        conn->clientID = clientID;
+        conn->sendQueue.Clear();   // 풀에서 재사용된 객체 - capacity는 유지
+        conn->flushQueued = false;
+        conn->recvRing.Reset();
+        conn->receiving = false;
+        conn->closing = false;
+
+        if (static_cast<size_t>(socket) >= m_connections.size()) {
+            m_connections.resize(static_cast<size_t>(socket) * 2, nullptr);
+        }
+        // 소켓은 백엔드가 닫으므로 같은 fd 번호의 이전 연결은 이미 칸에서 빠져 있음
+        m_connections[socket] = conn;
+    }
+
+    if (!StartReceive(socket, clientID, true)) {
+        std::cout << "[Error] Failed to register socket with epoll" << std::endl;
+        RemoveClient(socket, clientID);
+        return false;
+    }
+    return true;
+}
+
+void EpollBackend::RemoveClient(SOCKET socket, int clientID) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    Connection* conn = FindConnection(socket);
+    if (conn && conn->clientID == clientID) {
+        m_connections[socket] = nullptr;
+        ReleaseConnection(conn, socket);
+    }
+}
+
+void EpollBackend::ReleaseConnection(Connection* conn, SOCKET socket) {
+    conn->sendQueue.Clear();   // 보내지 못한 데이터는 폐기 (공유 버퍼 참조도 여기서 놓음)
+    if (conn->receiving) {
+        // 수신 중인 워커가 마지막 recv 뒤에 닫고 반납 (그 전에 닫으면 accept가 같은 fd 번호를 재사용해
+        // 워커가 새 연결의 첫 바이트를 이전 연결의 링으로 읽어 버릴 수 있음)
+        conn->closing = true;
+        return;
+    }
+    close(socket);
+    SlabPool<Connection>::Instance().Free(conn);
+}
+
+IOBackend::SendResult EpollBackend::Send(SOCKET socket, const void* data, int size) {
+    return QueueSend(socket, data, size, nullptr);
+}
+
+IOBackend::SendResult EpollBackend::SendShared(SOCKET socket, const BroadcastRef& buffer) {
+    return QueueSend(socket, nullptr, 0, &buffer);
+}
+
+IOBackend::SendResult EpollBackend::QueueSend(SOCKET socket, const void* data, int size, const BroadcastRef* shared) {
+    if (socket == INVALID_SOCKET) return SEND_FAILED;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    Connection* connPtr = FindConnection(socket);
+    if (!connPtr) {
+        return SEND_FAILED;
+    }
+
+    Connection& conn = *connPtr;
+    bool queued = shared ? conn.sendQueue.AppendShared(*shared, SEND_QUEUE_LIMIT)
+                         : conn.sendQueue.Append(data, size, SEND_QUEUE_LIMIT);
+    if (!queued) {
+        std::cout << "[SendPacket] Send queue full, dropping packet (socket: " << socket << ")" << std::endl;
+        return SEND_FAILED;
+    }
+    if (!conn.flushQueued) {
+        conn.flushQueued = true;
+        m_flushList.push_back(socket);
+    }
+    return conn.sendQueue.QueuedBytes() > SEND_HIGH_WATER ? SEND_BACKPRESSURE : SEND_OK;
+}
+
+void EpollBackend::Flush() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    // 소켓당 sendmsg 한 번: 이번 틱에 쌓인 전용 패킷과 공유 버퍼가 하나의 쓰기로 나간다
+    SendQueue::Slice slices[MAX_SEND_SLICES];
+    iovec iov[MAX_SEND_SLICES];
+    size_t keep = 0;
+    for (SOCKET socket : m_flushList) {
+        Connection* connPtr = FindConnection(socket);
+        if (!connPtr) continue;
+        Connection& conn = *connPtr;
+
+        int remaining = conn.sendQueue.BeginWrite();
+        while (remaining > 0) {
+            int count = conn.sendQueue.GetSlices(slices, MAX_SEND_SLICES);
+            size_t requested = 0;
+            for (int i = 0; i < count; ++i) {
+                iov[i].iov_base = const_cast<char*>(slices[i].data);
+                iov[i].iov_len = slices[i].size;
+                requested += slices[i].size;
+            }
+
+            msghdr msg = {};
+            msg.msg_iov = iov;
+            msg.msg_iovlen = count;
+            ssize_t sent = sendmsg(socket, &msg, MSG_DONTWAIT | MSG_NOSIGNAL);
+            if (sent < 0) {
+                if (errno == EINTR) continue;
+                if (errno != EAGAIN && errno != EWOULDBLOCK) {
+                    // 연결 에러 - 종료는 수신 쪽에서 감지되므로 대기열만 비움
+                    std::cout << "[SendPacket] Send failed (socket: " << socket << ", Error: " << errno << ")" << std::endl;
+                    conn.sendQueue.Clear();
+                }
+                break;
+            }
+
+            conn.sendQueue.CompleteWrite(static_cast<int>(sent));
+            remaining -= static_cast<int>(sent);
+            if (static_cast<size_t>(sent) < requested) {
+                break;   // 커널 송신 버퍼가 가득 참
+            }
+        }
+
+        // 남은 데이터는 다음 틱에 이어서 보냄
+        if (!conn.sendQueue.Empty()) {
+            m_flushList[keep++] = socket;
+        } else {
+            conn.flushQueued = false;
+        }
+    }
+    m_flushList.resize(keep);
+}
+
+void EpollBackend::LogStats() const {
+    SlabPool<Connection>::Instance().LogStats("epoll connections");
+}
+
+void EpollBackend::Poll(int timeoutMs) {
+    epoll_event events[MAX_EVENTS];
+    int count = epoll_wait(m_epollFd, events, MAX_EVENTS, timeoutMs);
+    if (count <= 0) {
+        return;  // 타임아웃 또는 EINTR
+    }
+
+    for (int i = 0; i < count; ++i) {
+        uint64_t key = events[i].data.u64;
+        DrainReceive(KeySocket(key), KeyClientID(key));
+    }
+}
+
+bool EpollBackend::StartReceive(SOCKET socket, int clientID, bool add) {
+    epoll_event ev = {};
+    ev.events = EPOLLIN | EPOLLRDHUP | EPOLLET | EPOLLONESHOT;
+    ev.data.u64 = PackKey(socket, clientID);
+    return epoll_ctl(m_epollFd, add ? EPOLL_CTL_ADD : EPOLL_CTL_MOD, socket, &ev) == 0;
+}
+
+void EpollBackend::DrainReceive(SOCKET socket, int clientID) {
+    Connection* conn = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        conn = FindConnection(socket);
+        if (!conn || conn->clientID != clientID) {
+            return;  // 이미 제거된 연결의 이벤트
+        }
+        conn->receiving = true;
+    }
+
+    // edge-triggered: EAGAIN이 나올 때까지 모두 읽어야 다음 이벤트가 온다
+    RecvRing& ring = conn->recvRing;
+    bool rearm = false;
+    while (true) {
+        ssize_t received = recv(socket, ring.WritePtr(), ring.Writable(), MSG_DONTWAIT);
+        if (received > 0) {
+            ring.Commit(static_cast<size_t>(received));
+            int consumed = m_onReceive(clientID, ring.ReadPtr(), static_cast<int>(ring.Readable()));
+            if (consumed < 0) {
+                break;  // 클라이언트가 제거됨 - 다시 무장하지 않음
+            }
+            ring.Consume(static_cast<size_t>(consumed));
+            if (ring.Writable() == 0) {
+                std::cout << "[Error] Receive ring full for client " << clientID << std::endl;
+                m_onDisconnect(clientID, ENOBUFS);
+                break;
+            }
+            continue;
+        }
+
+        if (received == 0) {
+            m_onDisconnect(clientID, 0);
+            break;
+        }
+
+        if (errno == EINTR) continue;
+        if (errno == EAGAIN || errno == EWOULDBLOCK) {
+            rearm = true;
+            break;
+        }
+
+        m_onDisconnect(clientID, errno);
+        break;
+    }
+
+    int rearmError = 0;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        conn->receiving = false;
+        if (conn->closing) {
+            // 수신 중에 RemoveClient됨 - 이 워커의 recv가 끝났으므로 이제 닫음
+            close(socket);
+            SlabPool<Connection>::Instance().Free(conn);
+            return;
+        }
+
+        // 다음 수신 준비 - closing 확인과 같은 잠금 안에서 (풀린 뒤에 RemoveClient + close 가 끼어들면
+        // 같은 fd 번호로 accept 된 새 연결을 이전 연결의 키로 다시 무장할 수 있음)
+        if (rearm && !StartReceive(socket, clientID, false)) {
+            rearmError = errno;
+        }
+    }
+
+    if (rearmError != 0) {
+        std::cout << "[Error] Failed to start next receive for client " << clientID << std::endl;
+        m_onDisconnect(clientID, rearmError);
+    }
+}
+#endif
@@ -0,0 +1,60 @@
+#pragma once
+#ifdef __linux__
+#include "IOBackend.h"
+#include "SendQueue.h"
+#include "SlabPool.h"
+#include "../../../Common/RecvRing.h"
+#include <vector>
+#include <mutex>
+
+// Linux epoll 백엔드
+// EPOLLET | EPOLLONESHOT 으로 등록하여 IOCP처럼 한 소켓은 한 번에 하나의 워커만 처리한다.
+// 수신은 EAGAIN까지 모두 읽은 뒤 다시 무장(re-arm)한다 (IOCP의 StartReceive에 해당).
+// 소켓은 연결별 RecvRing에 바로 수신하고, 콜백은 링의 미처리 구간을 그대로 본다 (복사 없음).
+// 송신은 소켓별 SendQueue에 모았다가 Flush()에서 논블로킹 sendmsg 한 번으로 보낸다 (공유 버퍼는 iovec로 참조).
+class EpollBackend : public IOBackend {
+public:
+    EpollBackend();
+    ~EpollBackend() override;
+
+    const char* GetName() const override { return "epoll"; }
+    bool Initialize(ReceiveCallback onReceive, DisconnectCallback onDisconnect) override;
+    void Shutdown() override;
+    bool AddClient(SOCKET socket, int clientID) override;
+    void RemoveClient(SOCKET socket, int clientID) override;
+    SendResult Send(SOCKET socket, const void* data, int size) override;
+    SendResult SendShared(SOCKET socket, const BroadcastRef& buffer) override;
+    void Flush() override;
+    void Poll(int timeoutMs) override;
+    void LogStats() const override;
+
+private:
+    static constexpr int MAX_EVENTS = 64;
+    static constexpr int MAX_SEND_SLICES = 64;   // sendmsg 한 번에 넘기는 iovec 수
+    static constexpr int RESERVED_CONNECTIONS = 4096;
+
+    struct Connection {
+        int clientID = 0;
+        SendQueue sendQueue;
+        bool flushQueued = false;
+        RecvRing recvRing;       // 처음 빌릴 때 한 번 만들고 재사용 (풀 객체는 소멸하지 않음)
+        bool receiving = false;  // 워커가 recvRing을 사용 중 - 이때 RemoveClient는 닫기/반납을 워커에 맡김
+        bool closing = false;
+    };
+
+    bool StartReceive(SOCKET socket, int clientID, bool add);
+    Connection* FindConnection(SOCKET socket) const {
+        return socket >= 0 && static_cast<size_t>(socket) < m_connections.size() ? m_connections[socket] : nullptr;
+    }
+    SendResult QueueSend(SOCKET socket, const void* data, int size, const BroadcastRef* shared);
+    void DrainReceive(SOCKET socket, int clientID);
+    void ReleaseConnection(Connection* conn, SOCKET socket);
+
+    int m_epollFd;
+    std::vector<Connection*> m_connections;   // fd로 바로 찾음 (SlabPool에서 빌린 객체)
+    std::vector<SOCKET> m_flushList;   // 송신 대기 데이터가 있는 소켓
+    std::mutex m_mutex;                // 연결/송신 대기열 보호 (accept 스레드와 시뮬레이션 스레드)
+    ReceiveCallback m_onReceive;
+    DisconnectCallback m_onDisconnect;
+};
+#endif
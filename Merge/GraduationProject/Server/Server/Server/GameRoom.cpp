@@ -0,0 +1,535 @@
+#include "GameRoom.h"
+#include "TigerKernels.h"
+#include <iostream>
+#include <algorithm>
+#include <chrono>
+#include <tuple>
+#include <cmath>
+#include <cfloat>
+#include <thread>
+
+void GameRoom::Open(int roomID, uint32_t seed) {
+    // 풀에서 꺼낸 방은 배열 용량만 남아 있음 - 기본 월드를 새로 만듦
+    m_id = roomID;
+    m_randomEngine.seed(seed);
+    m_nextTigerID = 1;
+    m_nextTreeID = 1;
+    InitializeTigers();
+    InitializeTrees();
+    m_costEstimateUs = 0.0f;
+    m_costWindow = CostWindow{};
+}
+
+void GameRoom::Close() {
+    m_id = 0;
+    m_members.clear();
+    m_players.clear();
+    m_tigers.Clear();
+    m_trees.clear();
+    m_treeBootstrap.clear();
+    m_aoiGrid.Clear();
+    m_playerGrid.Clear();
+}
+
+void GameRoom::RemoveMember(int clientID) {
+    m_members.erase(std::remove(m_members.begin(), m_members.end(), clientID), m_members.end());
+}
+
+void GameRoom::Simulate(float deltaTime, JobSystem& jobs) {
+    // 호랑이 행동이 조회할 플레이어 위치 격자 (이번 틱 명령까지 반영된 위치)
+    m_playerGrid.Clear();
+    for (const Player& player : m_players) {
+        if (player.hasPosition) {
+            m_playerGrid.Insert(AoiGrid::MakeKey(ENTITY_TYPE_PLAYER, player.clientID), player.x, player.z);
+        }
+    }
+
+    SimulateTigers(deltaTime, jobs);
+    UpdateInterestSets(jobs);
+}
+
+void GameRoom::UpdateInterestSets(JobSystem& jobs) {
+    // 1. 격자를 이번 틱 위치로 다시 채움
+    m_aoiGrid.Clear();
+    for (const Player& player : m_players) {
+        if (player.hasPosition) {
+            m_aoiGrid.Insert(AoiGrid::MakeKey(ENTITY_TYPE_PLAYER, player.clientID), player.x, player.z);
+        }
+    }
+    for (int i = 0; i < m_tigers.Size(); ++i) {
+        m_aoiGrid.Insert(AoiGrid::MakeKey(ENTITY_TYPE_TIGER, m_tigers.id[i]), m_tigers.x[i], m_tigers.z[i]);
+    }
+
+    m_aoiGrid.Build();   // 워커들이 동시에 조회
+
+    // 2. 멤버별 새 가시 집합 (진입은 ENTER 반경, 이탈은 더 넓은 LEAVE 반경 기준)
+    if (m_nextVisible.size() < m_players.size()) m_nextVisible.resize(m_players.size());
+    const float enterRadiusSq = AOI_ENTER_RADIUS * AOI_ENTER_RADIUS;
+    jobs.ParallelFor(static_cast<int>(m_players.size()), INTEREST_JOB_GRAIN, [&](int begin, int end) {
+        for (int p = begin; p < end; ++p) {
+            const Player& player = m_players[p];
+            std::vector<uint64_t>& next = m_nextVisible[p];
+            next.clear();
+            if (!player.updatesInterest || !player.hasPosition) continue;
+            const std::vector<uint64_t>& visible = *player.visible;
+            const uint64_t self = AoiGrid::MakeKey(ENTITY_TYPE_PLAYER, player.clientID);
+            m_aoiGrid.Query(player.x, player.z, AOI_LEAVE_RADIUS, [&](uint64_t key, float distSq) {
+                if (key == self) return;
+                if (distSq <= enterRadiusSq || std::binary_search(visible.begin(), visible.end(), key)) {
+                    next.push_back(key);
+                }
+            });
+            std::sort(next.begin(), next.end());
+        }
+    });
+}
+
+void GameRoom::RecordTickCost(float us) {
+    // 배분용 추정치는 지수 평균 (한 틱 튀는 값에 방이 워커 사이를 오가지 않도록)
+    m_costEstimateUs = m_costEstimateUs == 0.0f ? us : m_costEstimateUs * 0.9f + us * 0.1f;
+    m_costWindow.ticks++;
+    m_costWindow.totalUs += us;
+    m_costWindow.maxUs = std::max(m_costWindow.maxUs, us);
+}
+
+GameRoom::CostWindow GameRoom::TakeCostWindow() {
+    CostWindow window = m_costWindow;
+    m_costWindow = CostWindow{};
+    return window;
+}
+
+void GameRoom::InitializeTigers() {
+    // 성능 개선을 위해 호랑이 수를 5마리로 줄임
+    float basePosX = 500.0f;
+    float basePosZ = 500.0f;
+    float offset = 150.0f;  // 간격을 좀 더 넓게
+    
+    // 5마리 호랑이를 적절히 배치
+    std::vector<std::pair<float, float>> positions = {
+        {basePosX - offset, basePosZ - offset},      // 좌상단
+        {basePosX + offset, basePosZ - offset},      // 우상단
+        {basePosX, basePosZ},                        // 중앙
+        {basePosX - offset, basePosZ + offset},      // 좌하단
+        {basePosX + offset, basePosZ + offset}       // 우하단
+    };
+    
+    // 고정된 값들을 사용하여 모든 클라이언트가 동일한 호랑이를 보도록 함
+    std::vector<float> fixedRotations = {0.0f, 90.0f, 180.0f, 270.0f, 45.0f};  // 고정된 회전값
+    std::vector<float> fixedMoveTimers = {1.0f, 1.5f, 2.0f, 0.5f, 1.2f};       // 고정된 이동 타이머
+    
+    for (size_t i = 0; i < positions.size(); ++i) {
+        if (m_nextTigerID > QUANT_MAX_ENTITY_ID) {
+            std::cout << "[InitializeTigers] Tiger ID exceeds quantized ID range (" << QUANT_MAX_ENTITY_ID << "), stopping" << std::endl;
+            break;
+        }
+        int tigerID = m_nextTigerID++;
+        float x = positions[i].first;
+        float z = positions[i].second;
+
+        // 고정된 초기 목표 위치 설정
+        float moveAngle = (i * 72.0f) * (3.141592f / 180.0f);  // 72도씩 회전 (360/5)
+        float moveDistance = 60.0f;  // 고정된 거리
+
+        // 고정된 회전값 / 이동 타이머 사용, 애니메이션은 IDLE, 타이머는 0에서 시작
+        int index = m_tigers.Add(tigerID, x, z, fixedRotations[i], fixedMoveTimers[i],
+            x + cos(moveAngle) * moveDistance, z + sin(moveAngle) * moveDistance);
+        QuantizeTigerState(index);   // 첫 전송 전에도 양자화된 상태로 시작
+    }
+
+}
+
+void GameRoom::InitializeTrees() {
+    // 플레이어 주변에 3개의 나무를 고정된 위치에 생성
+    const int TREE_COUNT = 3;
+    
+    // 고정된 나무 위치들
+    std::vector<std::tuple<float, float, float>> treePositions = {
+        {500.0f + 100.0f, 0.0f, 500.0f + 50.0f},   // 우측 앞
+        {500.0f - 80.0f, 0.0f, 500.0f + 120.0f},   // 좌측 뒤
+        {500.0f + 60.0f, 0.0f, 500.0f - 90.0f}     // 우측 뒤
+    };
+    
+    std::vector<float> fixedRotations = {45.0f, 180.0f, 270.0f};  // 고정된 회전값
+    
+    for (int i = 0; i < TREE_COUNT; ++i) {
+        TreeInfo tree;
+        tree.treeID = m_nextTreeID++;
+        
+        // 고정된 위치에 배치
+        tree.x = std::get<0>(treePositions[i]);
+        tree.y = std::get<1>(treePositions[i]);
+        tree.z = std::get<2>(treePositions[i]);
+        tree.rotY = fixedRotations[i];  // 고정된 회전값 사용
+        tree.treeType = 0; // long_tree
+        
+        m_trees[tree.treeID] = tree;
+
+    }
+    
+    // 부트스트랩 나무 구간을 미리 인코딩 (접속마다 그대로 복사)
+    m_treeBootstrap.resize(m_trees.size() * BOOTSTRAP_TREE_BYTES);
+    uint8_t* out = m_treeBootstrap.data();
+    for (const auto& [treeID, tree] : m_trees) {
+        EncodeBootstrapTree(tree.x, tree.z, tree.rotY, tree.treeType, out);
+        out += BOOTSTRAP_TREE_BYTES;
+    }
+
+}
+
+void GameRoom::SimulateTigers(float deltaTime, JobSystem& jobs) {
+    // 단계 사이에만 동기화 (ParallelFor 가 돌아오면 그 단계의 모든 구간이 끝난 것)
+    if (m_targetScratch.size() < static_cast<size_t>(jobs.WorkerCount())) m_targetScratch.resize(jobs.WorkerCount());
+    TigerPool& tigers = m_tigers;
+    ForEachTigerRange(jobs, [&](int begin, int end) { TigerAdvanceTimers(tigers, deltaTime, begin, end); });
+    FindTigerTargets(jobs);
+    ForEachTigerRange(jobs, [&](int begin, int end) { TigerClassifyTargets(tigers, TIGER_CHASE_RADIUS, TIGER_ATTACK_RADIUS, begin, end); });
+    TigerStateContext context{ deltaTime, m_randomEngine };
+    m_tigerStates.Decide(tigers, context, jobs);
+    ForEachTigerRange(jobs, [&](int begin, int end) {
+        std::copy(tigers.x.begin() + begin, tigers.x.begin() + end, tigers.prevX.begin() + begin);
+        std::copy(tigers.z.begin() + begin, tigers.z.begin() + end, tigers.prevZ.begin() + begin);
+        TigerSteer(tigers, deltaTime, begin, end);
+    });
+    m_tigerStates.FinishMove(tigers, context, jobs);
+    ForEachTigerRange(jobs, [&](int begin, int end) {
+        TigerQuantize(tigers, deltaTime, begin, end);
+        for (int i = begin; i < std::min(end, tigers.Size()); ++i) {
+            EncodeTigerState(i);
+        }
+    });
+}
+
+void GameRoom::FindTigerTargets(JobSystem& jobs) {
+    // 추격 반경 안에서 가장 가까운 플레이어 찾기
+    //  - 호랑이를 플레이어 격자 칸별로 묶고, 칸마다 후보 플레이어를 한 번만 모아 그 칸의 호랑이 전체를 SIMD 로 비교
+    //  - 먼저 주변 3x3 칸만 봄. 가장 가까운 후보가 모은 칸 바깥보다 멀면 (바깥에 더 가까운 플레이어가 있을 수 있음)
+    //    그 호랑이만 범위를 두 배씩 넓혀 다시 비교, 추격 반경이 닿는 칸 전체까지 (넓어질수록 플레이어가 드문 곳)
+    //  - 격자 한 줄씩 잡으로 나눔 (칸마다 자기 호랑이만 쓰므로 워커 수와 무관하게 같은 결과)
+    TigerPool& t = m_tigers;
+    const AoiGrid& grid = m_playerGrid;
+    const int cells = grid.CellsPerAxis();
+    const int reach = static_cast<int>(std::ceil(TIGER_CHASE_RADIUS / grid.CellSize()));
+    const float chaseSq = TIGER_CHASE_RADIUS * TIGER_CHASE_RADIUS;
+
+    // 1. 칸 순서로 계수 정렬
+    m_targetCells.resize(t.Size());
+    m_targetCellStart.assign(cells * cells + 1, 0);
+    for (int i = 0; i < t.Size(); ++i) {
+        int cell = grid.CellCoord(t.z[i]) * cells + grid.CellCoord(t.x[i]);
+        m_targetCells[i] = cell;
+        m_targetCellStart[cell + 1]++;
+    }
+    for (size_t c = 1; c < m_targetCellStart.size(); ++c) {
+        m_targetCellStart[c] += m_targetCellStart[c - 1];
+    }
+    m_targetCursor.assign(m_targetCellStart.begin(), m_targetCellStart.end() - 1);
+    m_targetOrder.resize(t.Size());
+    for (int i = 0; i < t.Size(); ++i) {
+        m_targetOrder[m_targetCursor[m_targetCells[i]]++] = i;
+    }
+    grid.Build();   // 워커들이 동시에 조회
+
+    // 2. 칸마다 후보를 모아 그 칸의 호랑이 전체에 사용 (호랑이가 잡 하나 분량보다 적으면 줄을 나누지 않음)
+    const int rowGrain = t.Size() < TIGER_JOB_GRAIN ? cells : 1;
+    jobs.ParallelFor(cells, rowGrain, [&](int rowBegin, int rowEnd) {
+        TargetScratch& s = m_targetScratch[JobSystem::CurrentWorker()];
+        for (int cell = rowBegin * cells; cell < rowEnd * cells; ++cell) {
+            const int begin = m_targetCellStart[cell], end = m_targetCellStart[cell + 1];
+            if (begin == end) continue;
+            const int cx = cell % cells, cz = cell / cells;
+            s.pending.assign(m_targetOrder.begin() + begin, m_targetOrder.begin() + end);
+            for (int radius = 1; !s.pending.empty(); radius = std::min(radius * 2, reach)) {
+                // 칸 (cx, cz) 에서 radius 칸 안의 플레이어가 후보
+                s.candidates.clear();
+                s.candidateX.clear();
+                s.candidateZ.clear();
+                grid.ForEachInCells(cx - radius, cx + radius, cz - radius, cz + radius, [&](const AoiGrid::Entry& entry) {
+                    s.candidates.push_back(&entry);
+                    s.candidateX.push_back(entry.x);
+                    s.candidateZ.push_back(entry.z);
+                });
+                // 비교할 호랑이 위치를 연속 배열로 (SIMD 폭 배수로 패딩)
+                const int count = static_cast<int>(s.pending.size());
+                const size_t padded = (count + TIGER_SIMD_LANES - 1) / TIGER_SIMD_LANES * TIGER_SIMD_LANES;
+                s.pendingX.resize(padded);
+                s.pendingZ.resize(padded);
+                s.nearestDistSq.resize(padded);
+                s.nearestIndex.resize(padded);
+                for (int k = 0; k < count; ++k) {
+                    s.pendingX[k] = t.x[s.pending[k]];
+                    s.pendingZ[k] = t.z[s.pending[k]];
+                }
+                TigerNearestCandidates(s.pendingX.data(), s.pendingZ.data(), count, s.candidateX.data(), s.candidateZ.data(),
+                                       static_cast<int>(s.candidateX.size()), s.nearestDistSq.data(), s.nearestIndex.data());
+
+                s.retry.clear();
+                for (int k = 0; k < count; ++k) {
+                    const int i = s.pending[k];
+                    const float distSq = s.nearestDistSq[k];
+                    float gap = radius >= reach ? FLT_MAX : grid.BlockGap(t.x[i], t.z[i], cx - radius, cx + radius, cz - radius, cz + radius);
+                    if (distSq > gap * gap && gap < TIGER_CHASE_RADIUS) {
+                        s.retry.push_back(i);
+                        continue;
+                    }
+                    const AoiGrid::Entry* nearest = (s.nearestIndex[k] >= 0 && distSq <= chaseSq) ? s.candidates[s.nearestIndex[k]] : nullptr;
+                    t.playerDistSq[i] = nearest ? distSq : FLT_MAX;
+                    t.playerX[i] = nearest ? nearest->x : t.x[i];
+                    t.playerZ[i] = nearest ? nearest->z : t.z[i];
+                }
+                s.pending.swap(s.retry);
+            }
+        }
+    });
+}
+
+void GameRoom::EncodeTigerState(int i) {
+    // TigerQuantize 결과를 와이어 상태로 모아 인코딩 (QuantizeEntityState 와 같은 값)
+    TigerPool& t = m_tigers;
+    QuantizedEntityState& q = t.quantized[i];
+    q.entityID = static_cast<uint32_t>(t.id[i]) & QuantMask(QUANT_ENTITY_ID_BITS);
+    q.x = t.quantX[i];
+    q.z = t.quantZ[i];
+    q.yaw = t.quantYaw[i];
+    q.clip = QuantizeClip(t.animation[i]);
+    q.animTime = t.quantAnimTime[i];
+    EncodeEntityState(q, t.encoded[i].data());
+}
+
+void GameRoom::QuantizeTigerState(int i) {
+    // 전송할 양자화 값을 시뮬레이션 상태에도 되돌려 써서
+    // 다음 틱도 클라이언트가 복원하는 것과 같은 값에서 이어지게 함
+    TigerPool& t = m_tigers;
+    QuantizedEntityState& q = t.quantized[i];
+    q = QuantizeEntityState(t.id[i], t.x[i], t.z[i], t.rotY[i], t.animation[i], t.animationTime[i]);
+    t.x[i] = DequantizePosition(q.x);
+    t.z[i] = DequantizePosition(q.z);
+    t.rotY[i] = DequantizeYaw(q.yaw);
+    t.animationTime[i] = DequantizeAnimTime(q.animTime, GetAnimationClipDuration(t.animation[i]));
+    EncodeEntityState(q, t.encoded[i].data());
+}
+
+float GameRoom::GetRandomFloat(float min, float max) {
+    std::uniform_real_distribution<float> dist(min, max);
+    return dist(m_randomEngine);
+}
+
+bool GameRoom::IsPlayerNearby(float x, float z, float radius) {
+    float distSq;
+    return m_playerGrid.FindNearest(x, z, radius, distSq) != nullptr;
+}
+
+float GameRoom::GetNearestPlayerPosition(float x, float z, float radius, float& targetX, float& targetZ) {
+    // 반경 안에 플레이어가 없으면 FLT_MAX (목표는 (x, z) 자신)
+    targetX = x;
+    targetZ = z;
+    float distSq;
+    const AoiGrid::Entry* nearest = m_playerGrid.FindNearest(x, z, radius, distSq);
+    if (!nearest) return FLT_MAX;
+    targetX = nearest->x;
+    targetZ = nearest->z;
+    return std::sqrt(distSq);
+}
+
+void GameRoom::SetupTigerBenchmark(int tigerCount, int playerCount, std::mt19937& random, std::vector<BenchPlayer>& players) {
+    // 무작위로 흩어진 호랑이/플레이어 (플레이어는 호랑이보다 빠르게 직선으로 달리다 가끔 방향을 바꿈 - 추격/공격/배회가 계속 섞이도록)
+    std::uniform_real_distribution<float> coord(0.0f, 1000.0f);
+    std::uniform_real_distribution<float> angle(0.0f, TIGER_PI * 2.0f);
+    m_randomEngine.seed(22);
+    m_tigers.Clear();
+    for (int i = 0; i < tigerCount; ++i) {
+        float x = coord(random), z = coord(random);
+        QuantizeTigerState(m_tigers.Add(i + 1, x, z, 0.0f, 1.0f, x, z));
+    }
+    players.resize(playerCount);
+    for (auto& p : players) {
+        float a = angle(random);
+        p = { coord(random), coord(random), std::cos(a), std::sin(a) };
+    }
+}
+
+void GameRoom::MoveBenchPlayers(std::mt19937& random, std::vector<BenchPlayer>& players, float deltaTime) {
+    std::uniform_real_distribution<float> angle(0.0f, TIGER_PI * 2.0f);
+    const float PLAYER_SPEED = TIGER_MOVE_SPEED * 1.5f;
+    m_playerGrid.Clear();
+    for (size_t p = 0; p < players.size(); ++p) {
+        BenchPlayer& player = players[p];
+        if (random() % 50 == 0) {
+            float a = angle(random);
+            player.dirX = std::cos(a);
+            player.dirZ = std::sin(a);
+        }
+        player.x += player.dirX * PLAYER_SPEED * deltaTime;
+        player.z += player.dirZ * PLAYER_SPEED * deltaTime;
+        if (player.x < 0.0f || player.x > 1000.0f) player.dirX = -player.dirX;   // 월드 경계에서 반사
+        if (player.z < 0.0f || player.z > 1000.0f) player.dirZ = -player.dirZ;
+        m_playerGrid.Insert(AoiGrid::MakeKey(ENTITY_TYPE_PLAYER, static_cast<int>(p)), player.x, player.z);
+    }
+}
+
+int GameRoom::RunTigerSimulationBenchmark(int tigerCount, int playerCount, int ticks, int tickRate, int workers) {
+    // SetupTigerBenchmark 의 월드로 SimulateTigers 를 반복 (틱마다 플레이어 이동 + 격자 재구성 포함)
+    // 먼저 커널마다 SIMD 판과 스칼라 판을 같은 입력으로 돌려 결과가 같은지 확인
+    JobSystem jobs(workers);
+    GameRoom room;
+    std::mt19937 random(22);
+    std::vector<BenchPlayer> players;
+    room.SetupTigerBenchmark(tigerCount, playerCount, random, players);
+    const float deltaTime = 1.0f / tickRate;
+    auto movePlayers = [&]() { room.MoveBenchPlayers(random, players, deltaTime); };
+    for (int tick = 0; tick < 30; ++tick) {   // 상태/이동 목표가 골고루 섞이도록 예열
+        movePlayers();
+        room.SimulateTigers(deltaTime, jobs);
+    }
+
+    // 1. 커널별 SIMD / 스칼라 비교
+    const int REPEAT = 200;
+    auto timeKernel = [&](const char* name, auto&& simd, auto&& scalar, auto&& same) {
+        TigerPool a = room.m_tigers, b = room.m_tigers;
+        simd(a);
+        scalar(b);
+        if (!same(a, b)) {
+            std::cout << "[TigerSim] " << name << ": SIMD result differs from scalar" << std::endl;
+            return false;
+        }
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < REPEAT; ++i) simd(a);
+        auto middle = std::chrono::steady_clock::now();
+        for (int i = 0; i < REPEAT; ++i) scalar(b);
+        auto end = std::chrono::steady_clock::now();
+        std::cout << "[TigerSim] " << name << ": SIMD " << std::chrono::duration<float, std::micro>(middle - start).count() / REPEAT
+                  << " us, scalar " << std::chrono::duration<float, std::micro>(end - middle).count() / REPEAT << " us" << std::endl;
+        return true;
+    };
+    bool ok = timeKernel("timers",
+        [&](TigerPool& t) { TigerAdvanceTimers(t, deltaTime, 0, t.PaddedSize()); },
+        [&](TigerPool& t) { TigerAdvanceTimersScalar(t, deltaTime, 0, t.PaddedSize()); },
+        [](const TigerPool& a, const TigerPool& b) {
+            return a.moveTimer == b.moveTimer && a.animationTime == b.animationTime && a.attackTime == b.attackTime &&
+                   a.searchTime == b.searchTime && a.elapseTime == b.elapseTime;
+        });
+    ok = ok && timeKernel("classify",
+        [&](TigerPool& t) { TigerClassifyTargets(t, TIGER_CHASE_RADIUS, TIGER_ATTACK_RADIUS, 0, t.PaddedSize()); },
+        [&](TigerPool& t) { TigerClassifyTargetsScalar(t, TIGER_CHASE_RADIUS, TIGER_ATTACK_RADIUS, 0, t.PaddedSize()); },
+        [](const TigerPool& a, const TigerPool& b) { return a.event == b.event; });
+    ok = ok && timeKernel("steer",
+        [&](TigerPool& t) { TigerSteer(t, deltaTime, 0, t.PaddedSize()); },
+        [&](TigerPool& t) { TigerSteerScalar(t, deltaTime, 0, t.PaddedSize()); },
+        [](const TigerPool& a, const TigerPool& b) {
+            return a.x == b.x && a.z == b.z && a.rotY == b.rotY && a.moved == b.moved;
+        });
+    ok = ok && timeKernel("quantize",
+        [&](TigerPool& t) { TigerQuantize(t, deltaTime, 0, t.PaddedSize()); },
+        [&](TigerPool& t) { TigerQuantizeScalar(t, deltaTime, 0, t.PaddedSize()); },
+        [](const TigerPool& a, const TigerPool& b) {
+            return a.quantX == b.quantX && a.quantZ == b.quantZ && a.quantYaw == b.quantYaw &&
+                   a.quantAnimTime == b.quantAnimTime && a.x == b.x && a.z == b.z && a.rotY == b.rotY &&
+                   a.animationTime == b.animationTime && a.speed == b.speed;
+        });
+    {
+        // 목표 탐색 커널 (모든 호랑이 x 플레이어 최대 32명)
+        const int candidates = std::min(playerCount, 32);
+        std::vector<float> candX(candidates), candZ(candidates);
+        for (int p = 0; p < candidates; ++p) {
+            candX[p] = players[p].x;
+            candZ[p] = players[p].z;
+        }
+        const int padded = room.m_tigers.PaddedSize();
+        std::vector<float> simdDistSq(padded), scalarDistSq(padded);
+        std::vector<int> simdIndex(padded), scalarIndex(padded);
+        auto nearest = [&](auto kernel, std::vector<float>& distSq, std::vector<int>& index) {
+            kernel(room.m_tigers.x.data(), room.m_tigers.z.data(), room.m_tigers.Size(), candX.data(), candZ.data(), candidates, distSq.data(), index.data());
+        };
+        ok = ok && timeKernel("nearest",
+            [&](TigerPool&) { nearest(TigerNearestCandidates, simdDistSq, simdIndex); },
+            [&](TigerPool&) { nearest(TigerNearestCandidatesScalar, scalarDistSq, scalarIndex); },
+            [&](const TigerPool&, const TigerPool&) {
+                return std::equal(simdDistSq.begin(), simdDistSq.begin() + room.m_tigers.Size(), scalarDistSq.begin()) &&
+                       std::equal(simdIndex.begin(), simdIndex.begin() + room.m_tigers.Size(), scalarIndex.begin());
+            });
+    }
+    if (!ok) return 1;
+
+    // 2. 전체 틱 (평균 / 중앙값 / 최악 - 공유 머신에서는 중앙값이 가장 안정적)
+    std::vector<float> tickUs(ticks);
+    for (int tick = 0; tick < ticks; ++tick) {
+        auto start = std::chrono::steady_clock::now();
+        movePlayers();
+        room.SimulateTigers(deltaTime, jobs);
+        tickUs[tick] = std::chrono::duration<float, std::micro>(std::chrono::steady_clock::now() - start).count();
+    }
+    float totalUs = 0.0f;
+    for (float us : tickUs) totalUs += us;
+    std::sort(tickUs.begin(), tickUs.end());
+    int counts[TIGER_STATE_COUNT] = {};
+    for (int i = 0; i < room.m_tigers.Size(); ++i) counts[room.m_tigers.state[i]]++;
+    std::cout << "[TigerSim] " << tigerCount << " tigers x " << playerCount << " players, SIMD width " << TIGER_SIMD_WIDTH
+              << ", " << jobs.WorkerCount() << " workers: " << totalUs / ticks << " us/tick avg, " << tickUs[ticks / 2] << " us median, " << tickUs.back() << " us worst (";
+    for (int state = 0; state < TIGER_STATE_COUNT; ++state) {
+        std::cout << (state > 0 ? ", " : "") << TIGER_STATES[state].name << " " << counts[state];
+    }
+    std::cout << ")" << std::endl;
+    return 0;
+}
+
+int GameRoom::RunTigerScalingBenchmark(int tigerCount, int playerCount, int ticks, int tickRate) {
+    // 같은 시드의 월드를 워커 수만 바꿔 반복 (방과 잡 시스템을 새로 만들어 처음부터)
+    //  - 틱 결과(인코딩된 상태, 행동 상태, 발사 이벤트 순서)의 해시가 워커 1개일 때와 같아야 함
+    //  - 코어 수보다 워커가 많으면 나머지는 시간 분할이라 빨라지지 않음 (오버헤드만 보임)
+    const int WORKER_COUNTS[] = { 1, 2, 4, 8, 16 };
+    std::cout << "[TigerScale] " << tigerCount << " tigers x " << playerCount << " players, " << ticks << " ticks, "
+              << std::thread::hardware_concurrency() << " hardware threads" << std::endl;
+    float baselineUs = 0.0f;
+    uint64_t baselineHash = 0;
+    bool ok = true;
+    for (int workers : WORKER_COUNTS) {
+        JobSystem jobs(workers);
+        GameRoom bench;
+        std::mt19937 random(22);
+        std::vector<BenchPlayer> players;
+        bench.SetupTigerBenchmark(tigerCount, playerCount, random, players);
+        const float deltaTime = 1.0f / tickRate;
+
+        uint64_t hash = 14695981039346656037ull;   // FNV-1a
+        auto mix = [&hash](const void* data, size_t size) {
+            const uint8_t* bytes = static_cast<const uint8_t*>(data);
+            for (size_t i = 0; i < size; ++i) {
+                hash = (hash ^ bytes[i]) * 1099511628211ull;
+            }
+        };
+        std::vector<float> tickUs(ticks);
+        std::vector<std::vector<int>> attackChunks;
+        std::vector<int> attackEvents;   // 이번 틱에 발사한 호랑이 ID
+        size_t attackEventCount = 0;
+        for (int tick = 0; tick < ticks; ++tick) {
+            auto start = std::chrono::steady_clock::now();
+            bench.MoveBenchPlayers(random, players, deltaTime);
+            bench.SimulateTigers(deltaTime, jobs);
+            tickUs[tick] = std::chrono::duration<float, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+            const TigerPool& t = bench.m_tigers;
+            mix(t.encoded.data(), t.Size() * sizeof(t.encoded[0]));
+            mix(t.state.data(), t.Size());
+            // 발사 결과도 비교 - 구간별로 모아 구간 순서로 합침 (= 인덱스 순서, 워커 수와 무관)
+            jobs.ParallelCollect(t.Size(), TIGER_JOB_GRAIN, attackChunks, attackEvents,
+                [&](int begin, int end, std::vector<int>& out) {
+                    for (int i = begin; i < end; ++i) {
+                        if (t.fired[i]) out.push_back(t.id[i]);
+                    }
+                });
+            mix(attackEvents.data(), attackEvents.size() * sizeof(int));
+            attackEventCount += attackEvents.size();
+        }
+        std::sort(tickUs.begin(), tickUs.end());
+        const float medianUs = tickUs[ticks / 2];
+        if (workers == 1) {
+            baselineUs = medianUs;
+            baselineHash = hash;
+        }
+        const bool same = hash == baselineHash;
+        ok = ok && same;
+        std::cout << "[TigerScale] " << workers << " workers: " << medianUs << " us median, " << baselineUs / medianUs << "x, "
+                  << attackEventCount << " attack events, result " << (same ? "identical" : "DIFFERS") << std::endl;
+    }
+    return ok ? 0 : 1;
+}
+
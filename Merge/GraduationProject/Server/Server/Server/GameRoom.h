@@ -0,0 +1,147 @@
+#pragma once
+#include <vector>
+#include <random>
+#include <unordered_map>
+#include <cstdint>
+#include "Packet.h"
+#include "AoiGrid.h"
+#include "JobSystem.h"
+#include "TigerStateMachine.h"
+
+// 방 = 독립된 게임 월드 하나 (2인 사냥 세션). 서버 프로세스 하나가 여러 방을 동시에 호스팅
+//  - 방마다 호랑이/나무/격자/난수를 각자 소유하고 틱도 방마다 (엔티티 ID 는 방 안에서만 유일, 플레이어 키는 clientID)
+//  - 세션은 로그인 때 GameServer 가 빈자리가 있는 방에 배정. 방은 멤버 clientID 만 들고 세션 필드는 GameServer 소유
+//  - Simulate 는 네트워크를 건드리지 않음 -> GameServer 가 방들을 시뮬레이션 워커에 부하 순으로 나눠 동시에 진행하고,
+//    전송(관심 영역 진입/이탈, 스냅샷)은 시뮬레이션 스레드에서 방 순서대로
+//  - 빈 방은 GameServer 의 풀로 돌아갔다가 Open 으로 재사용 (배열 용량 유지)
+
+struct TreeInfo {
+    int treeID;
+    float x, y, z;
+    float rotY;
+    int treeType;  // 0: long_tree, 1: normal_tree
+};
+
+class GameRoom {
+public:
+    static constexpr int CAPACITY = 2;        // 방 하나의 플레이어 수
+    static constexpr int MAX_TIGERS = 5;      // 성능 개선을 위해 5마리로 줄임
+    static constexpr int MAX_TREES = 289;     // 17x17 나무
+    static constexpr float AOI_ENTER_RADIUS = 200.0f;  // 이 안으로 들어오면 보이기 시작
+    static constexpr float AOI_LEAVE_RADIUS = 250.0f;  // 이 밖으로 나가야 사라짐 (경계에서 스폰/디스폰 반복 방지)
+    static constexpr float PLAYER_GRID_CELL_SIZE = 50.0f;   // 목표 탐색 격자 칸 (클수록 칸별 준비 비용은 줄고 호랑이당 후보 비교는 늘어남)
+    static constexpr int TIGER_JOB_GRAIN = 1024;   // 호랑이 커널 잡 하나가 맡는 수 (TIGER_SIMD_LANES 배수)
+    static_assert(TIGER_JOB_GRAIN % TIGER_SIMD_LANES == 0, "Kernel jobs must split on SIMD boundaries");
+    static constexpr int INTEREST_JOB_GRAIN = 16;  // 관심 영역 잡 하나가 맡는 멤버 수 (2인 방은 잡으로 나누지 않음)
+
+    // 이번 틱 멤버 상태 (GameServer 가 Simulate 전에 멤버 순서로 채움)
+    struct Player {
+        int clientID;
+        float x, z;
+        bool hasPosition;
+        bool updatesInterest;                   // 관심 영역 갱신 대상 (준비 완료 + 연결)
+        const std::vector<uint64_t>* visible;   // 지금 가시 집합 (이탈 히스테리시스용, 읽기만)
+    };
+
+    // 보고 주기 동안의 틱 비용 (시뮬레이션 + 전송)
+    struct CostWindow {
+        int ticks = 0;
+        float totalUs = 0.0f;
+        float maxUs = 0.0f;
+    };
+
+    // 풀에서 꺼낼 때 기본 월드(호랑이 5, 나무 3)로 초기화 / 풀로 돌아갈 때 비움
+    void Open(int roomID, uint32_t seed);
+    void Close();
+    bool IsOpen() const { return m_id != 0; }
+    int ID() const { return m_id; }
+
+    const std::vector<int>& Members() const { return m_members; }
+    bool IsFull() const { return static_cast<int>(m_members.size()) >= CAPACITY; }
+    void AddMember(int clientID) { m_members.push_back(clientID); }
+    void RemoveMember(int clientID);
+
+    // 한 틱: 플레이어 격자 -> 호랑이 AI -> 관심 영역 격자와 멤버별 새 가시 집합 (방 안의 큰 루프는 다시 잡으로 나뉨)
+    std::vector<Player>& Players() { return m_players; }
+    void Simulate(float deltaTime, JobSystem& jobs);
+    std::vector<uint64_t>& NextVisible(int player) { return m_nextVisible[player]; }   // Players() 인덱스
+
+    const TigerPool& Tigers() const { return m_tigers; }
+    const AoiGrid& InterestGrid() const { return m_aoiGrid; }   // 마지막 Simulate 의 위치
+    int TreeCount() const { return static_cast<int>(m_trees.size()); }
+    const std::vector<uint8_t>& TreeBootstrap() const { return m_treeBootstrap; }
+
+    // 틱 비용 기록 / 부하 배분용 추정치 (최근 틱 지수 평균) / 워커 묶음
+    void RecordTickCost(float us);
+    float CostEstimateUs() const { return m_costEstimateUs; }
+    CostWindow TakeCostWindow();
+    int Worker() const { return m_worker; }
+    void SetWorker(int worker) { m_worker = worker; }
+
+    // 네트워크 없이 호랑이 AI 틱만 반복 측정 (--tiger-sim-bench). 종료 코드 반환
+    static int RunTigerSimulationBenchmark(int tigerCount, int playerCount, int ticks, int tickRate, int workers);
+    // 같은 시드의 틱을 워커 1/2/4/8/16 개로 측정하고 결과가 같은지 비교 (--tiger-scale-bench). 종료 코드 반환
+    static int RunTigerScalingBenchmark(int tigerCount, int playerCount, int ticks, int tickRate);
+
+private:
+    void InitializeTigers();
+    void InitializeTrees();
+    // 호랑이 AI 한 틱 (플레이어 격자가 채워져 있어야 함): SIMD 커널과 상태별 처리를 번갈아, 각각 잡 워커들이 구간을 나눠 실행
+    void SimulateTigers(float deltaTime, JobSystem& jobs);
+    // 호랑이 배열을 TIGER_JOB_GRAIN 구간으로 나눠 func(begin, end) (패딩 칸 포함, SIMD 폭 경계)
+    template<typename Func>
+    void ForEachTigerRange(JobSystem& jobs, Func&& func) {
+        const int blocks = m_tigers.PaddedSize() / TIGER_SIMD_LANES;
+        jobs.ParallelFor(blocks, TIGER_JOB_GRAIN / TIGER_SIMD_LANES, [&](int begin, int end) {
+            func(begin * TIGER_SIMD_LANES, end * TIGER_SIMD_LANES);
+        });
+    }
+    void FindTigerTargets(JobSystem& jobs);
+    void EncodeTigerState(int index);
+    void QuantizeTigerState(int index);   // 한 마리만 (생성 시)
+    void UpdateInterestSets(JobSystem& jobs);
+    float GetRandomFloat(float min, float max);
+    bool IsPlayerNearby(float x, float z, float radius);
+    float GetNearestPlayerPosition(float x, float z, float radius, float& targetX, float& targetZ);
+
+    // 벤치마크 월드 (--tiger-sim-bench / --tiger-scale-bench 공용): 같은 시드면 같은 호랑이 배치와 플레이어 움직임
+    struct BenchPlayer { float x, z, dirX, dirZ; };
+    void SetupTigerBenchmark(int tigerCount, int playerCount, std::mt19937& random, std::vector<BenchPlayer>& players);
+    void MoveBenchPlayers(std::mt19937& random, std::vector<BenchPlayer>& players, float deltaTime);   // 플레이어 격자도 다시 채움
+
+    int m_id = 0;                        // 0 = 닫힘 (풀에 있음)
+    std::vector<int> m_members;          // 배정된 clientID (들어온 순서)
+    std::vector<Player> m_players;
+    std::vector<std::vector<uint64_t>> m_nextVisible;   // 멤버별 새 가시 집합 (워커들이 나눠 계산, 전송은 GameServer 가 멤버 순서로)
+
+    int m_nextTigerID = 1;
+    int m_nextTreeID = 1;
+    TigerPool m_tigers;                  // 호랑이 AI 상태 (필드별 배열, 인덱스 = ID 오름차순)
+    TigerStateMachine m_tigerStates;     // 호랑이 행동 (공용 상태 표 TigerBehavior.h)
+    std::unordered_map<int, TreeInfo> m_trees;
+    std::vector<uint8_t> m_treeBootstrap;   // 부트스트랩 나무 구간 (나무는 움직이지 않으므로 열 때 한 번만 만듦)
+    std::mt19937 m_randomEngine;         // 호랑이 배회 (방마다 따로 - 다른 방의 진행과 무관하게 같은 순서)
+    AoiGrid m_aoiGrid;                   // 틱마다 다시 채우는 관심 영역 격자
+    AoiGrid m_playerGrid{ PLAYER_GRID_CELL_SIZE };  // 호랑이 목표 탐색용 플레이어 격자 (Simulate 시작에 다시 채움)
+
+    // 목표 탐색용 (틱마다 재사용): 호랑이를 격자 칸 순서로 묶은 것
+    std::vector<int> m_targetCells;
+    std::vector<int> m_targetCellStart;
+    std::vector<int> m_targetCursor;
+    std::vector<int> m_targetOrder;
+    // 칸별 후보 플레이어 비교용 (워커마다 하나, JobSystem::CurrentWorker 로 선택)
+    struct TargetScratch {
+        std::vector<int> pending;   // 지금 범위로 비교할 호랑이
+        std::vector<int> retry;     // 지금 범위로 결정하지 못한 호랑이 (범위를 넓혀 다시 비교)
+        std::vector<const AoiGrid::Entry*> candidates;
+        std::vector<float> candidateX, candidateZ;
+        std::vector<float> pendingX, pendingZ;   // 비교할 호랑이 위치 (SIMD 폭 배수로 패딩)
+        std::vector<float> nearestDistSq;        // 호랑이별 가장 가까운 후보까지 거리 제곱
+        std::vector<int> nearestIndex;           // 그 후보 인덱스 (candidates)
+    };
+    std::vector<TargetScratch> m_targetScratch;
+
+    float m_costEstimateUs = 0.0f;
+    CostWindow m_costWindow;
+    int m_worker = 0;
+};
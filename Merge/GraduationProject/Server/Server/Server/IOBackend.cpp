@@ -0,0 +1,33 @@
+#include "IOBackend.h"
+#include <iostream>
+#ifdef _WIN32
+#include "IocpBackend.h"
+#else
+#include "EpollBackend.h"
+#include "UringBackend.h"
+#endif
+
+const char* IOBackend::GetDefaultName() {
+#ifdef _WIN32
+    return "iocp";
+#else
+    return "epoll";
+#endif
+}
+
+std::unique_ptr<IOBackend> IOBackend::Create(const std::string& name) {
+#ifdef _WIN32
+    if (!name.empty() && name != "iocp") {
+        std::cout << "[Warning] I/O backend '" << name << "' is not available on Windows, using IOCP" << std::endl;
+    }
+    return std::make_unique<IocpBackend>();
+#else
+    if (name == "uring" || name == "io_uring") {
+        return std::make_unique<UringBackend>();
+    }
+    if (!name.empty() && name != "epoll") {
+        std::cout << "[Warning] Unknown I/O backend '" << name << "', using epoll" << std::endl;
+    }
+    return std::make_unique<EpollBackend>();
+#endif
+}
@@ -0,0 +1,56 @@
+#pragma once
+#include "Platform.h"
+#include "BroadcastBuffer.h"
+#include <functional>
+#include <memory>
+#include <string>
+
+// 소켓 I/O 백엔드 인터페이스
+// GameServer는 이 인터페이스만 사용하고, 실제 구현은 플랫폼별로 분리한다.
+//  - Windows: IocpBackend (IOCP + WSARecv)
+//  - Linux  : EpollBackend (edge-triggered epoll), UringBackend (io_uring, --io=uring)
+class IOBackend {
+public:
+    static constexpr int SEND_HIGH_WATER = 64 * 1024;        // 이 이상 쌓이면 SEND_BACKPRESSURE
+    static constexpr int SEND_QUEUE_LIMIT = 4 * SEND_HIGH_WATER;  // 이 이상은 버림 (SEND_FAILED)
+
+    enum SendResult {
+        SEND_OK,
+        SEND_BACKPRESSURE,   // 대기열에 넣었지만 high-water 초과 - 클라이언트가 못 따라오는 중
+        SEND_FAILED,         // 연결 없음 또는 대기열 한도 초과로 버림
+    };
+
+    // 수신 콜백: data는 연결별 RecvRing에 쌓인 아직 처리하지 않은 바이트 전체 (항상 연속)
+    // 처리한(소비한) 바이트 수를 반환 - 남은 부분 패킷은 다음 수신 뒤 이어서 다시 전달됨
+    // 음수를 반환하면 해당 소켓의 다음 수신을 등록하지 않음 (클라이언트 제거됨)
+    using ReceiveCallback = std::function<int(int clientID, const char* data, int size)>;
+    // 연결 종료 콜백: error가 0이면 상대방이 정상 종료한 경우
+    using DisconnectCallback = std::function<void(int clientID, int error)>;
+
+    virtual ~IOBackend() = default;
+
+    virtual const char* GetName() const = 0;
+    virtual bool Initialize(ReceiveCallback onReceive, DisconnectCallback onDisconnect) = 0;
+    virtual void Shutdown() = 0;
+
+    // 새 클라이언트 소켓을 등록하고 첫 수신을 시작 (ProcessNewClient)
+    // 호출한 뒤로 소켓은 백엔드 소유 - 실패해도 백엔드가 닫음
+    virtual bool AddClient(SOCKET socket, int clientID) = 0;
+    // 백엔드가 잡고 있는 소켓 자원을 정리하고 소켓을 닫음 (호출한 쪽은 closesocket 하지 않음)
+    // 워커가 그 소켓을 읽는 중이면 마지막 수신이 끝난 뒤에 닫음 - 닫기 전에는 fd 번호가 재사용되지 않음
+    virtual void RemoveClient(SOCKET socket, int /*clientID*/) { closesocket(socket); }
+    // 송신 (SendPacket). 블로킹하지 않고 소켓별 대기열에 쌓기만 함
+    virtual SendResult Send(SOCKET socket, const void* data, int size) = 0;
+    // 공유 버퍼 송신 (브로드캐스트). 기본 구현은 Send로 복사, scatter-gather를 지원하는 백엔드는 참조만 쌓음
+    virtual SendResult SendShared(SOCKET socket, const BroadcastRef& buffer) { return Send(socket, buffer->Data(), buffer->Size()); }
+    // 쌓아둔 송신을 소켓당 한 번의 쓰기로 제출 (시뮬레이션 틱마다 호출)
+    virtual void Flush() = 0;
+    // 완료된 I/O를 최대 timeoutMs 동안 기다려 콜백으로 전달 (WorkerThread 한 번의 루프)
+    virtual void Poll(int timeoutMs) = 0;
+    // 백엔드 내부 풀/버퍼 사용량 출력 (틱 요약 보고와 함께)
+    virtual void LogStats() const {}
+
+    // 이름으로 백엔드 생성 ("iocp", "epoll", "uring"). 빈 문자열이면 플랫폼 기본값
+    static std::unique_ptr<IOBackend> Create(const std::string& name = "");
+    static const char* GetDefaultName();
+};
@@ -0,0 +1,298 @@
+#ifdef _WIN32
+#include "IocpBackend.h"
+#include <algorithm>
+#include <iostream>
+
+IocpBackend::IocpBackend()
+    : m_hIOCP(NULL)
+{
+}
+
+IocpBackend::~IocpBackend() {
+    Shutdown();
+}
+
+bool IocpBackend::Initialize(ReceiveCallback onReceive, DisconnectCallback onDisconnect) {
+    m_onReceive = std::move(onReceive);
+    m_onDisconnect = std::move(onDisconnect);
+
+    m_hIOCP = CreateIoCompletionPort(INVALID_HANDLE_VALUE, NULL, 0, 0);
+    if (m_hIOCP == NULL) {
+        std::cout << "[Error] CreateIoCompletionPort failed" << std::endl;
+        return false;
+    }
+
+    // 접속 폭주 중에 힙 할당이 일어나지 않도록 미리 확보
+    m_connections.Reserve(RESERVED_CONNECTIONS);
+    m_flushList.reserve(RESERVED_CONNECTIONS);
+    SlabPool<Connection>::Instance().Reserve(RESERVED_CONNECTIONS);
+    SlabPool<IOContext>::Instance().Reserve(RESERVED_CONNECTIONS);
+    return true;
+}
+
+void IocpBackend::Shutdown() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_connections.ForEach([](SOCKET socket, Connection* conn) {
+            closesocket(socket);
+            conn->sendQueue.Clear();
+            SlabPool<Connection>::Instance().Free(conn);
+        });
+        m_connections.Clear();
+        m_flushList.clear();
+    }
+
+    if (m_hIOCP) {
+        CloseHandle(m_hIOCP);
+        m_hIOCP = NULL;
+    }
+}
+
+bool IocpBackend::AddClient(SOCKET socket, int clientID) {
+    // 1. IOCP 설정
+    if (CreateIoCompletionPort((HANDLE)socket, m_hIOCP, clientID, 0) == NULL) {
+        std::cout << "[Error] Failed to associate with IOCP" << std::endl;
+        closesocket(socket);
+        return false;
+    }
+
+    // 2. 송신 대기열 생성
+    Connection* conn = SlabPool<Connection>::Instance().Allocate();
+    IOContext* ioContext = SlabPool<IOContext>::Instance().Allocate();
+    if (!conn || !ioContext) {
+        SlabPool<Connection>::Instance().Free(conn);
+        SlabPool<IOContext>::Instance().Free(ioContext);
+        closesocket(socket);
+        return false;
+    }
+
+    // 풀에서 재사용된 객체 - 상태 초기화 (송신 대기열 capacity는 유지)
+    conn->operation = OP_SEND;
+    conn->socket = socket;
+    conn->clientID = clientID;
+    conn->sendQueue.Clear();
+    conn->sendInFlight = false;
+    conn->flushQueued = false;
+    conn->closing = false;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_connections.Insert(socket, conn);
+    }
+
+    // 3. 수신 시작
+    if (!ioContext->ring.IsCreated() && !ioContext->ring.Create()) {
+        std::cout << "[Error] Failed to create receive ring" << std::endl;
+        SlabPool<IOContext>::Instance().Free(ioContext);
+        RemoveClient(socket, clientID);
+        return false;
+    }
+    ioContext->ring.Reset();
+    ioContext->operation = OP_RECV;
+    ioContext->socket = socket;
+    if (!StartReceive(ioContext)) {
+        std::cout << "[Error] Failed to start receive" << std::endl;
+        SlabPool<IOContext>::Instance().Free(ioContext);
+        RemoveClient(socket, clientID);
+        return false;
+    }
+    return true;
+}
+
+void IocpBackend::RemoveClient(SOCKET socket, int clientID) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    Connection** found = m_connections.Find(socket);
+    if (!found || (*found)->clientID != clientID) {
+        return;
+    }
+
+    Connection* conn = *found;
+    m_connections.Erase(socket);
+    m_flushList.erase(std::remove(m_flushList.begin(), m_flushList.end(), conn), m_flushList.end());
+    closesocket(socket);   // 진행 중인 WSARecv/WSASend는 취소된 완료 통지로 끝남
+
+    // 진행 중인 WSASend가 있으면 closesocket으로 취소된 완료 통지가 온 뒤에 해제
+    if (conn->sendInFlight) {
+        conn->closing = true;
+    } else {
+        conn->sendQueue.Clear();
+        SlabPool<Connection>::Instance().Free(conn);
+    }
+}
+
+IOBackend::SendResult IocpBackend::Send(SOCKET socket, const void* data, int size) {
+    return QueueSend(socket, data, size, nullptr);
+}
+
+IOBackend::SendResult IocpBackend::SendShared(SOCKET socket, const BroadcastRef& buffer) {
+    return QueueSend(socket, nullptr, 0, &buffer);
+}
+
+IOBackend::SendResult IocpBackend::QueueSend(SOCKET socket, const void* data, int size, const BroadcastRef* shared) {
+    if (socket == INVALID_SOCKET) return SEND_FAILED;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    Connection** found = m_connections.Find(socket);
+    if (!found) {
+        return SEND_FAILED;
+    }
+
+    Connection* conn = *found;
+    bool queued = shared ? conn->sendQueue.AppendShared(*shared, SEND_QUEUE_LIMIT)
+                         : conn->sendQueue.Append(data, size, SEND_QUEUE_LIMIT);
+    if (!queued) {
+        std::cout << "[SendPacket] Send queue full, dropping packet (socket: " << socket << ")" << std::endl;
+        return SEND_FAILED;
+    }
+    if (!conn->flushQueued) {
+        conn->flushQueued = true;
+        m_flushList.push_back(conn);
+    }
+    return conn->sendQueue.QueuedBytes() > SEND_HIGH_WATER ? SEND_BACKPRESSURE : SEND_OK;
+}
+
+void IocpBackend::Flush() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    // 소켓당 WSASend 한 번: 이번 틱에 쌓인 패킷들이 하나의 쓰기로 나간다
+    size_t keep = 0;
+    for (Connection* conn : m_flushList) {
+        if (conn->sendInFlight) {
+            // 이전 송신이 아직 진행 중 - 완료 후 다음 Flush에서 이어서 보냄
+            m_flushList[keep++] = conn;
+            continue;
+        }
+        conn->flushQueued = false;
+        StartSend(conn);
+    }
+    m_flushList.resize(keep);
+}
+
+bool IocpBackend::StartSend(Connection* conn) {
+    if (conn->sendQueue.BeginWrite() == 0) {
+        return true;
+    }
+
+    // 남은 구간이 MAX_SEND_SLICES보다 많으면 나머지는 완료 후 다음 Flush에서
+    SendQueue::Slice slices[MAX_SEND_SLICES];
+    int count = conn->sendQueue.GetSlices(slices, MAX_SEND_SLICES);
+    for (int i = 0; i < count; ++i) {
+        conn->wsaBufs[i].buf = const_cast<char*>(slices[i].data);
+        conn->wsaBufs[i].len = static_cast<ULONG>(slices[i].size);
+    }
+    memset(&conn->overlapped, 0, sizeof(OVERLAPPED));
+
+    DWORD sentBytes;
+    if (WSASend(conn->socket, conn->wsaBufs, static_cast<DWORD>(count), &sentBytes, 0, &conn->overlapped, NULL) == SOCKET_ERROR) {
+        int error = WSAGetLastError();
+        if (error != WSA_IO_PENDING) {
+            // 연결 에러 - 종료는 수신 쪽에서 감지되므로 대기열만 비움
+            std::cout << "[SendPacket] Connection error (socket: " << conn->socket << ", Error: " << error << ")" << std::endl;
+            conn->sendQueue.Clear();
+            return false;
+        }
+    }
+    // 즉시 완료되어도 완료 통지는 IOCP로 온다
+    conn->sendInFlight = true;
+    return true;
+}
+
+void IocpBackend::CompleteSend(Connection* conn, BOOL result, DWORD bytesTransferred) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    conn->sendInFlight = false;
+
+    if (conn->closing) {
+        // RemoveClient가 이미 맵에서 뺀 연결
+        conn->sendQueue.Clear();
+        SlabPool<Connection>::Instance().Free(conn);
+        return;
+    }
+
+    if (!result) {
+        std::cout << "[SendPacket] Send failed (socket: " << conn->socket << ", Error: " << WSAGetLastError() << ")" << std::endl;
+        conn->sendQueue.Clear();
+        return;
+    }
+
+    conn->sendQueue.CompleteWrite(static_cast<int>(bytesTransferred));
+    if (!conn->sendQueue.Empty() && !conn->flushQueued) {
+        conn->flushQueued = true;
+        m_flushList.push_back(conn);
+    }
+}
+
+void IocpBackend::LogStats() const {
+    SlabPool<IOContext>::Instance().LogStats("IOCP recv contexts");
+    SlabPool<Connection>::Instance().LogStats("IOCP connections");
+}
+
+void IocpBackend::Poll(int timeoutMs) {
+    DWORD bytesTransferred;
+    ULONG_PTR completionKey;
+    OVERLAPPED* pOverlapped;
+
+    BOOL result = GetQueuedCompletionStatus(m_hIOCP, &bytesTransferred,
+        &completionKey, &pOverlapped, timeoutMs);
+
+    // 타임아웃 발생 시 (pOverlapped가 NULL)
+    if (!pOverlapped) {
+        return;  // 타임아웃은 정상적인 상황
+    }
+
+    OverlappedEx* overlappedEx = CONTAINING_RECORD(pOverlapped, OverlappedEx, overlapped);
+    if (overlappedEx->operation == OP_SEND) {
+        CompleteSend(static_cast<Connection*>(overlappedEx), result, bytesTransferred);
+        return;
+    }
+
+    IOContext* ioContext = static_cast<IOContext*>(overlappedEx);
+    int clientID = static_cast<int>(completionKey);
+
+    // 연결 해제 감지: 에러이거나 0바이트 수신 (상대방 정상 종료)
+    if (!result || bytesTransferred == 0) {
+        int error = result ? 0 : WSAGetLastError();
+        m_onDisconnect(clientID, error);
+        SlabPool<IOContext>::Instance().Free(ioContext);
+        return;
+    }
+
+    RecvRing& ring = ioContext->ring;
+    ring.Commit(bytesTransferred);
+    int consumed = m_onReceive(clientID, ring.ReadPtr(), static_cast<int>(ring.Readable()));
+    if (consumed < 0) {
+        SlabPool<IOContext>::Instance().Free(ioContext);
+        return;
+    }
+    ring.Consume(static_cast<size_t>(consumed));
+    if (ring.Writable() == 0) {
+        std::cout << "[Error] Receive ring full for client " << clientID << std::endl;
+        m_onDisconnect(clientID, WSAENOBUFS);
+        SlabPool<IOContext>::Instance().Free(ioContext);
+        return;
+    }
+
+    // 다음 수신 준비
+    if (!StartReceive(ioContext)) {
+        std::cout << "[Error] Failed to start next receive for client " << clientID << std::endl;
+        m_onDisconnect(clientID, WSAGetLastError());
+        SlabPool<IOContext>::Instance().Free(ioContext);
+    }
+}
+
+bool IocpBackend::StartReceive(IOContext* ioContext) {
+    memset(&ioContext->overlapped, 0, sizeof(OVERLAPPED));
+    ioContext->wsaBuf.buf = ioContext->ring.WritePtr();
+    ioContext->wsaBuf.len = static_cast<ULONG>(ioContext->ring.Writable());
+    ioContext->flags = 0;
+
+    DWORD recvBytes;
+    if (WSARecv(ioContext->socket, &ioContext->wsaBuf, 1, &recvBytes,
+        &ioContext->flags, &ioContext->overlapped, NULL) == SOCKET_ERROR) {
+        int error = WSAGetLastError();
+        if (error != ERROR_IO_PENDING && error != WSAEWOULDBLOCK) {
+            std::cout << "[Error] WSARecv failed with error: " << error << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+#endif
@@ -0,0 +1,73 @@
+#pragma once
+#ifdef _WIN32
+#include "IOBackend.h"
+#include "SendQueue.h"
+#include "SlabPool.h"
+#include "SocketMap.h"
+#include "../../../Common/RecvRing.h"
+#include <vector>
+#include <mutex>
+
+// Windows IOCP 백엔드 (기존 GameServer::WorkerThread 구현을 옮긴 것)
+// 송신은 소켓별 SendQueue에 모았다가 Flush()에서 overlapped WSASend 한 번으로 보낸다 (공유 버퍼는 WSABUF로 참조).
+// 소켓당 WSASend는 한 번에 하나만 진행 (완료 전까지 쓰는 버퍼가 바뀌지 않음)
+class IocpBackend : public IOBackend {
+public:
+    IocpBackend();
+    ~IocpBackend() override;
+
+    const char* GetName() const override { return "IOCP"; }
+    bool Initialize(ReceiveCallback onReceive, DisconnectCallback onDisconnect) override;
+    void Shutdown() override;
+    bool AddClient(SOCKET socket, int clientID) override;
+    void RemoveClient(SOCKET socket, int clientID) override;
+    SendResult Send(SOCKET socket, const void* data, int size) override;
+    SendResult SendShared(SOCKET socket, const BroadcastRef& buffer) override;
+    void Flush() override;
+    void Poll(int timeoutMs) override;
+    void LogStats() const override;
+
+private:
+    static constexpr int MAX_SEND_SLICES = 64;   // WSASend 한 번에 넘기는 WSABUF 수
+    static constexpr int RESERVED_CONNECTIONS = 4096;
+
+    enum Operation { OP_RECV, OP_SEND };
+
+    // 완료 통지에서 어떤 작업인지 구분하기 위한 공통 머리
+    struct OverlappedEx {
+        OVERLAPPED overlapped;
+        Operation operation;
+    };
+
+    // 수신 링을 포함한 컨텍스트 - SlabPool에서 빌려 쓰고 연결이 끊기면 반납
+    // WSARecv는 링의 WritePtr()에 바로 받는다 (링은 처음 빌릴 때 한 번 만들고 재사용)
+    struct IOContext : OverlappedEx {
+        WSABUF wsaBuf;
+        SOCKET socket;
+        RecvRing ring;
+        DWORD flags;
+    };
+
+    struct Connection : OverlappedEx {   // OP_SEND 완료 통지는 Connection 자체를 가리킴
+        SOCKET socket = INVALID_SOCKET;
+        int clientID = 0;
+        WSABUF wsaBufs[MAX_SEND_SLICES];  // 송신 완료 전까지 유지
+        SendQueue sendQueue;
+        bool sendInFlight = false;
+        bool flushQueued = false;
+        bool closing = false;           // RemoveClient 후 진행 중인 송신 완료를 기다리는 중
+    };
+
+    bool StartReceive(IOContext* ioContext);
+    SendResult QueueSend(SOCKET socket, const void* data, int size, const BroadcastRef* shared);
+    bool StartSend(Connection* conn);
+    void CompleteSend(Connection* conn, BOOL result, DWORD bytesTransferred);
+
+    HANDLE m_hIOCP;
+    SocketMap<Connection*> m_connections;   // Connection은 SlabPool에서 빌림
+    std::vector<Connection*> m_flushList;   // 송신 대기 데이터가 있는 연결
+    std::mutex m_mutex;                     // 연결/송신 대기열 보호
+    ReceiveCallback m_onReceive;
+    DisconnectCallback m_onDisconnect;
+};
+#endif
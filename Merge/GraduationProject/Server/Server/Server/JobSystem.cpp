@@ -0,0 +1,165 @@
+#include "JobSystem.h"
+
+namespace {
+    constexpr int MAX_INLINE_JOBS = 64;    // 이보다 조각이 적으면 잡 배열을 스택에 (할당 없음)
+    constexpr int IDLE_SPINS = 64;         // 잠들기 전에 일을 다시 찾아보는 횟수
+}
+
+thread_local int JobSystem::t_workerIndex = 0;
+
+JobSystem::JobSystem(int workerCount)
+    : m_workerCount(std::max(workerCount, 1))
+{
+    for (int i = 0; i < m_workerCount; ++i) {
+        m_deques.push_back(std::make_unique<WorkDeque>());
+    }
+    for (int i = 1; i < m_workerCount; ++i) {
+        m_threads.emplace_back(&JobSystem::WorkerLoop, this, i);
+    }
+}
+
+JobSystem::~JobSystem() {
+    m_running.store(false);
+    m_signal.fetch_add(1);
+    m_signal.notify_all();
+    for (std::thread& thread : m_threads) {
+        thread.join();
+    }
+}
+
+void JobSystem::Dispatch(RunFunc run, void* context, int count, int grain) {
+    const int chunkCount = (count + grain - 1) / grain;
+
+    // 워커가 하나면 조각 순서대로 바로 실행 (조각 경계는 병렬일 때와 같음)
+    if (m_workerCount == 1 || chunkCount == 1) {
+        for (int begin = 0; begin < count; begin += grain) {
+            run(context, begin, std::min(begin + grain, count));
+        }
+        return;
+    }
+
+    Job inlineJobs[MAX_INLINE_JOBS];
+    std::vector<Job> heapJobs;
+    Job* jobs = inlineJobs;
+    if (chunkCount > MAX_INLINE_JOBS) {
+        heapJobs.resize(chunkCount);
+        jobs = heapJobs.data();
+    }
+
+    std::atomic<int> pending{ chunkCount };
+    const int self = t_workerIndex;
+    WorkDeque& deque = *m_deques[self];
+
+    // 뒤 조각부터 넣음 -> 자기는 앞 조각부터 꺼내고, 다른 워커는 뒤 조각부터 훔쳐 감
+    for (int c = chunkCount - 1; c >= 0; --c) {
+        Job& job = jobs[c];
+        job.run = run;
+        job.context = context;
+        job.begin = c * grain;
+        job.end = std::min(job.begin + grain, count);
+        job.pending = &pending;
+        if (!deque.Push(&job)) {
+            run(context, job.begin, job.end);   // 덱이 가득 참 - 바로 실행
+            pending.fetch_sub(1, std::memory_order_release);
+        }
+    }
+    m_signal.fetch_add(1, std::memory_order_release);
+    m_signal.notify_all();
+
+    // 남은 조각을 같이 처리하며 대기 (다른 ParallelFor 의 조각을 훔쳐 실행할 수도 있음)
+    while (pending.load(std::memory_order_acquire) > 0) {
+        if (!RunOne(self)) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+bool JobSystem::RunOne(int worker) {
+    Job* job = m_deques[worker]->Pop();
+    for (int k = 1; !job && k < m_workerCount; ++k) {
+        job = m_deques[(worker + k) % m_workerCount]->Steal();
+    }
+    if (!job) {
+        return false;
+    }
+
+    std::atomic<int>* pending = job->pending;
+    job->run(job->context, job->begin, job->end);
+    pending->fetch_sub(1, std::memory_order_release);   // 이후 job 은 이미 사라졌을 수 있음
+    return true;
+}
+
+void JobSystem::WorkerLoop(int worker) {
+    t_workerIndex = worker;
+    while (m_running.load(std::memory_order_relaxed)) {
+        if (RunOne(worker)) {
+            continue;
+        }
+
+        bool found = false;
+        for (int spin = 0; spin < IDLE_SPINS && !found; ++spin) {
+            std::this_thread::yield();
+            found = RunOne(worker);
+        }
+        if (found) {
+            continue;
+        }
+
+        // 신호 값을 읽은 뒤 한 번 더 확인하고 잠듦 (그 사이 들어온 작업은 신호 값이 바뀌어 바로 깨어남)
+        const uint32_t seen = m_signal.load(std::memory_order_acquire);
+        if (RunOne(worker)) {
+            continue;
+        }
+        if (m_running.load(std::memory_order_relaxed)) {
+            m_signal.wait(seen, std::memory_order_acquire);
+        }
+    }
+}
+
+// ---- Chase-Lev 덱 ----
+
+bool JobSystem::WorkDeque::Push(Job* job) {
+    const int64_t bottom = m_bottom.load(std::memory_order_relaxed);
+    const int64_t top = m_top.load(std::memory_order_acquire);
+    if (bottom - top >= CAPACITY) {
+        return false;
+    }
+    m_jobs[bottom & (CAPACITY - 1)].store(job, std::memory_order_relaxed);
+    m_bottom.store(bottom + 1, std::memory_order_release);
+    return true;
+}
+
+JobSystem::Job* JobSystem::WorkDeque::Pop() {
+    const int64_t bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+    m_bottom.store(bottom, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t top = m_top.load(std::memory_order_relaxed);
+
+    if (top > bottom) {
+        m_bottom.store(bottom + 1, std::memory_order_relaxed);   // 비어 있음
+        return nullptr;
+    }
+    Job* job = m_jobs[bottom & (CAPACITY - 1)].load(std::memory_order_relaxed);
+    if (top == bottom) {
+        // 마지막 하나 - 훔치는 쪽과 경쟁
+        if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+            job = nullptr;
+        }
+        m_bottom.store(bottom + 1, std::memory_order_relaxed);
+    }
+    return job;
+}
+
+JobSystem::Job* JobSystem::WorkDeque::Steal() {
+    int64_t top = m_top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    const int64_t bottom = m_bottom.load(std::memory_order_acquire);
+    if (top >= bottom) {
+        return nullptr;
+    }
+    Job* job = m_jobs[top & (CAPACITY - 1)].load(std::memory_order_relaxed);
+    if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+        return nullptr;   // 다른 워커가 먼저 가져감
+    }
+    return job;
+}
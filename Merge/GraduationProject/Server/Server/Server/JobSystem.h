@@ -0,0 +1,92 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <type_traits>
+#include <vector>
+#include <algorithm>
+
+// 작업 훔치기(work-stealing) 잡 시스템 - 시뮬레이션 틱 안의 엔티티 범위 작업을 여러 코어로 나눔
+//  - 워커마다 자기 덱(Chase-Lev): 자기 작업은 아래쪽에서 LIFO 로 꺼내고, 비면 다른 워커 덱의 위쪽에서 훔침
+//  - ParallelFor 를 부른 스레드도 워커 0 으로 참여하고, 조각이 모두 끝날 때까지 남은 작업을 실행하며 기다림
+//  - 조각 경계는 (count, grain) 으로만 정해지고 워커 수와 무관
+//    -> 조각별 결과를 조각 순서대로 합치면 워커 수와 실행 순서에 상관없이 항상 같은 결과 (ParallelCollect)
+//  - ParallelFor 는 소유 스레드(시뮬레이션 스레드)와 잡 안에서만 호출
+class JobSystem {
+public:
+    explicit JobSystem(int workerCount);   // 호출 스레드 포함 워커 수 (1 이면 스레드 없이 호출 스레드에서 차례로 실행)
+    ~JobSystem();
+
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    int WorkerCount() const { return m_workerCount; }
+    // 지금 스레드의 워커 번호 (소유 스레드 = 0). 워커별 작업 공간 인덱스로 사용
+    static int CurrentWorker() { return t_workerIndex; }
+
+    // [0, count) 를 grain 개씩 나눈 조각마다 func(begin, end)
+    template<typename Func>
+    void ParallelFor(int count, int grain, Func&& func) {
+        if (count <= 0) return;
+        using FuncType = std::remove_reference_t<Func>;
+        Dispatch([](void* context, int begin, int end) { (*static_cast<FuncType*>(context))(begin, end); },
+                 const_cast<void*>(static_cast<const void*>(&func)), count, std::max(grain, 1));
+    }
+
+    // 조각마다 func(begin, end, 조각 출력) 로 모은 뒤 조각 순서대로 out 에 이어 붙임 (chunks = 재사용 작업 공간)
+    template<typename T, typename Func>
+    void ParallelCollect(int count, int grain, std::vector<std::vector<T>>& chunks, std::vector<T>& out, Func&& func) {
+        out.clear();
+        if (count <= 0) return;
+        grain = std::max(grain, 1);
+        const int chunkCount = (count + grain - 1) / grain;
+        if (chunks.size() < static_cast<size_t>(chunkCount)) chunks.resize(chunkCount);
+        ParallelFor(count, grain, [&](int begin, int end) {
+            std::vector<T>& chunk = chunks[begin / grain];
+            chunk.clear();
+            func(begin, end, chunk);
+        });
+        for (int c = 0; c < chunkCount; ++c) {
+            out.insert(out.end(), chunks[c].begin(), chunks[c].end());
+        }
+    }
+
+private:
+    using RunFunc = void (*)(void* context, int begin, int end);
+
+    struct Job {
+        RunFunc run;
+        void* context;
+        int begin, end;
+        std::atomic<int>* pending;   // 같은 ParallelFor 의 남은 조각 수
+    };
+
+    // Chase-Lev 덱 (고정 크기). 주인 스레드만 Push/Pop, 다른 워커는 Steal
+    class WorkDeque {
+    public:
+        static constexpr int64_t CAPACITY = 1024;
+        static_assert((CAPACITY & (CAPACITY - 1)) == 0, "Capacity must be a power of two");
+
+        bool Push(Job* job);   // 가득 차 있으면 false (호출한 쪽이 바로 실행)
+        Job* Pop();
+        Job* Steal();
+
+    private:
+        alignas(64) std::atomic<int64_t> m_top{ 0 };
+        alignas(64) std::atomic<int64_t> m_bottom{ 0 };
+        std::atomic<Job*> m_jobs[CAPACITY] = {};
+    };
+
+    void Dispatch(RunFunc run, void* context, int count, int grain);
+    bool RunOne(int worker);
+    void WorkerLoop(int worker);
+
+    static thread_local int t_workerIndex;
+
+    int m_workerCount;
+    std::vector<std::unique_ptr<WorkDeque>> m_deques;
+    std::vector<std::thread> m_threads;
+    std::atomic<uint32_t> m_signal{ 0 };   // 작업이 들어올 때마다 증가 (쉬는 워커 깨우기)
+    std::atomic<bool> m_running{ true };
+};
@@ -0,0 +1,93 @@
+#pragma once
+#include <atomic>
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+
+// 고정 크기 lock-free 링 버퍼 (다중 생산자 / 단일 소비자)
+// 각 칸마다 sequence 번호를 두어 생산자끼리는 CAS 한 번으로 칸을 예약하고,
+// 소비자는 락 없이 순서대로 꺼낸다. (Vyukov bounded queue 방식)
+//  - 생산자: I/O 워커 스레드들 (Push)
+//  - 소비자: 시뮬레이션 스레드 (Drain, 틱마다 한 번)
+template<typename T, size_t Capacity>
+class MpscRingBuffer {
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+public:
+    MpscRingBuffer()
+        : m_cells(new Cell[Capacity])
+        , m_enqueuePos(0)
+        , m_dequeuePos(0)
+    {
+        for (size_t i = 0; i < Capacity; ++i) {
+            m_cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    MpscRingBuffer(const MpscRingBuffer&) = delete;
+    MpscRingBuffer& operator=(const MpscRingBuffer&) = delete;
+
+    // 가득 차 있으면 false
+    bool TryPush(const T& value) {
+        Cell* cell;
+        size_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &m_cells[pos & MASK];
+            size_t seq = cell->sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+            if (diff == 0) {
+                if (m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = m_enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+
+        cell->data = value;
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    // 가득 차 있으면 소비자가 비울 때까지 양보하며 재시도 (명령을 잃지 않기 위해)
+    void Push(const T& value) {
+        while (!TryPush(value)) {
+            std::this_thread::yield();
+        }
+    }
+
+    // 소비자 전용: 현재 들어와 있는 항목을 최대 maxCount개까지 칸 안에서 바로 처리
+    template<typename Func>
+    size_t Drain(Func&& func, size_t maxCount = Capacity) {
+        size_t count = 0;
+        while (count < maxCount) {
+            Cell& cell = m_cells[m_dequeuePos & MASK];
+            size_t seq = cell.sequence.load(std::memory_order_acquire);
+            if (static_cast<intptr_t>(seq) - static_cast<intptr_t>(m_dequeuePos + 1) < 0) {
+                break;  // 비어 있음 (또는 생산자가 아직 쓰는 중)
+            }
+
+            func(cell.data);
+            cell.sequence.store(m_dequeuePos + Capacity, std::memory_order_release);
+            ++m_dequeuePos;
+            ++count;
+        }
+        return count;
+    }
+
+private:
+    static constexpr size_t MASK = Capacity - 1;
+    static constexpr size_t CACHE_LINE = 64;
+
+    struct alignas(CACHE_LINE) Cell {
+        std::atomic<size_t> sequence;
+        T data;
+    };
+
+    std::unique_ptr<Cell[]> m_cells;
+    alignas(CACHE_LINE) std::atomic<size_t> m_enqueuePos;
+    alignas(CACHE_LINE) size_t m_dequeuePos;   // 소비자 스레드만 접근
+};
@@ -0,0 +1,61 @@
+#pragma once
+
+// 플랫폼 차이 흡수용 헤더 (Windows: Winsock / Linux: BSD 소켓)
+#ifdef _WIN32
+
+#pragma comment(lib, "ws2_32.lib")
+
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#include <windows.h>
+#include <mswsock.h>
+
+#else
+
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#include <cstddef>
+
+typedef int SOCKET;
+typedef sockaddr_in SOCKADDR_IN;
+typedef sockaddr SOCKADDR;
+
+#define INVALID_SOCKET  (-1)
+#define SOCKET_ERROR    (-1)
+
+#define WSAECONNRESET   ECONNRESET
+#define WSAECONNABORTED ECONNABORTED
+#define WSAENOTSOCK     ENOTSOCK
+#define WSAENETDOWN     ENETDOWN
+#define WSAEWOULDBLOCK  EWOULDBLOCK
+
+inline int closesocket(SOCKET s) { return close(s); }
+inline int WSAGetLastError() { return errno; }
+
+// MSVC 보안 문자열 함수 대체 (배열 크기 템플릿 형태만 사용)
+template<size_t N>
+inline int strncpy_s(char (&dst)[N], const char* src, size_t count) {
+    size_t len = strnlen(src, count < N ? count : N - 1);
+    memcpy(dst, src, len);
+    dst[len] = '\0';
+    return 0;
+}
+
+inline int strcpy_s(char* dst, size_t size, const char* src) {
+    if (size == 0) return -1;
+    size_t len = strnlen(src, size - 1);
+    memcpy(dst, src, len);
+    dst[len] = '\0';
+    return 0;
+}
+
+#endif
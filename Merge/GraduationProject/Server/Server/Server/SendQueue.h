@@ -0,0 +1,148 @@
+#pragma once
+#include "BroadcastBuffer.h"
+#include <vector>
+#include <cstring>
+
+// 세션별 송신 대기열 (IocpBackend / EpollBackend 공용)
+// Send()는 여기에 데이터를 이어 붙이기만 하고, 틱마다 Flush()에서 소켓당 한 번에 쓴다.
+// 대기열은 구간(segment) 목록이며, 각 구간은
+//  - 이 세션 전용 바이트 (개별 패킷, 복사해서 보관)
+//  - 여러 세션이 공유하는 BroadcastBuffer 참조 (복사 없음)
+// 중 하나다. 쓰기는 구간들을 scatter-gather(WSASend/sendmsg)로 한 번에 넘긴다.
+//  - m_queued : 이번 틱에 쌓이는 구간 (시뮬레이션 스레드가 추가)
+//  - m_writing: 커널에 넘긴(또는 넘길) 구간. 쓰는 동안에는 주소가 바뀌지 않음 (overlapped WSASend)
+// 스레드 안전하지 않음 - 백엔드의 락 안에서 사용
+class SendQueue {
+public:
+    struct Slice {
+        const char* data;
+        int size;
+    };
+
+    SendQueue() : m_writeSegment(0), m_writeOffset(0), m_writeRemaining(0) {}
+
+    // 전용 바이트 추가. limit을 넘으면 추가하지 않고 false
+    bool Append(const void* data, int size, int limit) {
+        if (QueuedBytes() + size > limit) {
+            return false;
+        }
+        const char* src = static_cast<const char*>(data);
+        Batch& batch = m_queued;
+        if (!batch.segments.empty() && !batch.segments.back().shared &&
+            batch.segments.back().offset + batch.segments.back().size == static_cast<int>(batch.bytes.size())) {
+            batch.segments.back().size += size;   // 앞 구간에 이어 붙임
+        } else {
+            batch.segments.push_back({ BroadcastRef(), static_cast<int>(batch.bytes.size()), size });
+        }
+        batch.bytes.insert(batch.bytes.end(), src, src + size);
+        batch.totalBytes += size;
+        return true;
+    }
+
+    // 공유 버퍼 참조 추가. limit을 넘으면 추가하지 않고 false
+    bool AppendShared(const BroadcastRef& buffer, int limit) {
+        int size = buffer->Size();
+        if (QueuedBytes() + size > limit) {
+            return false;
+        }
+        m_queued.segments.push_back({ buffer, 0, size });
+        m_queued.totalBytes += size;
+        return true;
+    }
+
+    // 쓰기 시작: 아직 못 보낸 구간 뒤에 대기열을 합친다
+    // 반환값은 이번에 쓸 바이트 수 (0이면 보낼 것 없음)
+    int BeginWrite() {
+        if (m_writing.segments.empty()) {
+            std::swap(m_writing, m_queued);     // 보통의 경우: 복사 없이 교체
+            m_writeSegment = 0;
+            m_writeOffset = 0;
+            m_writeRemaining = m_writing.totalBytes;
+        } else if (!m_queued.segments.empty()) {
+            int base = static_cast<int>(m_writing.bytes.size());
+            m_writing.bytes.insert(m_writing.bytes.end(), m_queued.bytes.begin(), m_queued.bytes.end());
+            for (Segment& segment : m_queued.segments) {
+                if (!segment.shared) segment.offset += base;
+                m_writing.segments.push_back(std::move(segment));
+            }
+            m_writing.totalBytes += m_queued.totalBytes;
+            m_writeRemaining += m_queued.totalBytes;
+            m_queued.Clear();
+        }
+        return m_writeRemaining;
+    }
+
+    // 아직 보내지 않은 구간을 최대 maxSlices개까지 채움 (반환값: 채운 개수)
+    int GetSlices(Slice* slices, int maxSlices) const {
+        int count = 0;
+        int offset = m_writeOffset;
+        for (size_t i = m_writeSegment; i < m_writing.segments.size() && count < maxSlices; ++i) {
+            const Segment& segment = m_writing.segments[i];
+            const char* base = segment.shared ? segment.shared->Data() : m_writing.bytes.data();
+            slices[count].data = base + segment.offset + offset;
+            slices[count].size = segment.size - offset;
+            ++count;
+            offset = 0;
+        }
+        return count;
+    }
+
+    // bytes만큼 전송 완료 - 다 보낸 공유 버퍼 참조는 바로 놓음
+    void CompleteWrite(int bytes) {
+        m_writeRemaining -= bytes;
+        while (bytes > 0 && m_writeSegment < m_writing.segments.size()) {
+            Segment& segment = m_writing.segments[m_writeSegment];
+            int left = segment.size - m_writeOffset;
+            if (bytes < left) {
+                m_writeOffset += bytes;
+                return;
+            }
+            bytes -= left;
+            segment.shared.Reset();
+            ++m_writeSegment;
+            m_writeOffset = 0;
+        }
+        if (m_writeSegment >= m_writing.segments.size()) {
+            m_writing.Clear();   // capacity는 유지하여 다음 틱에 재사용
+            m_writeSegment = 0;
+            m_writeOffset = 0;
+            m_writeRemaining = 0;
+        }
+    }
+
+    int QueuedBytes() const { return m_writeRemaining + m_queued.totalBytes; }
+    bool Empty() const { return QueuedBytes() == 0; }
+
+    void Clear() {
+        m_queued.Clear();
+        m_writing.Clear();
+        m_writeSegment = 0;
+        m_writeOffset = 0;
+        m_writeRemaining = 0;
+    }
+
+private:
+    struct Segment {
+        BroadcastRef shared;   // 비어 있으면 Batch::bytes 안의 구간
+        int offset;
+        int size;
+    };
+
+    struct Batch {
+        std::vector<Segment> segments;
+        std::vector<char> bytes;       // 전용 구간 데이터
+        int totalBytes = 0;
+
+        void Clear() {
+            segments.clear();
+            bytes.clear();
+            totalBytes = 0;
+        }
+    };
+
+    Batch m_queued;
+    Batch m_writing;
+    size_t m_writeSegment;   // m_writing에서 다음에 보낼 구간
+    int m_writeOffset;       // 그 구간에서 이미 보낸 바이트 수
+    int m_writeRemaining;    // m_writing에서 아직 보내지 않은 바이트 수
+};
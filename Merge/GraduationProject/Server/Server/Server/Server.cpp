@@ -1,32 +1,42 @@
 ﻿#include "Server.h"
+#include "TigerKernels.h"
 #include <iostream>
-#include <format>
 #include <random>
 #include <algorithm>
-#define NOMINMAX
-#include <windows.h>
+#include <functional>
+#include <chrono>
+#include <tuple>
+#include <cmath>
+#include <cfloat>
+#include <cstdio>
+#include <cstring>
+#include <cstdlib>
 
 GameServer::GameServer()
-    : m_nextClientID(1)
-    , m_nextTigerID(1)
-    , m_nextTreeID(1)
+    : m_listenSocket(INVALID_SOCKET)
+    , m_tickRate(10)
     , m_isRunning(false)
-    , m_hIOCP(NULL)
-    , m_listenSocket(INVALID_SOCKET)
     , m_port(5000)
-    , m_tigerUpdateTimer(0.0f)
     , m_randomEngine(std::random_device{}())
 {
+    SetSimWorkers(1);
+}
+
+void GameServer::SetSimWorkers(int count) {
+    count = std::clamp(count, 1, MAX_SIM_WORKERS);
+    m_jobs = std::make_unique<JobSystem>(count);
+    m_roomsChanged = true;   // 묶음 수가 바뀜
 }
 
 GameServer::~GameServer() {
     Cleanup();
 }
 
-bool GameServer::Initialize(int port) {
+bool GameServer::Initialize(int port, const std::string& ioBackend) {
     m_port = port;
     std::cout << "[Server] Starting server on port " << m_port << std::endl;
 
+#ifdef _WIN32
     WSADATA wsaData;
     if (WSAStartup(MAKEWORD(2, 2), &wsaData) != 0) {
         std::cout << "[Error] WSAStartup failed" << std::endl;
@@ -34,12 +44,21 @@ bool GameServer::Initialize(int port) {
     }
 
     m_listenSocket = WSASocket(AF_INET, SOCK_STREAM, 0, NULL, 0, WSA_FLAG_OVERLAPPED);
+#else
+    m_listenSocket = socket(AF_INET, SOCK_STREAM, 0);
+#endif
     if (m_listenSocket == INVALID_SOCKET) {
         std::cout << "[Error] Failed to create listen socket" << std::endl;
         return false;
     }
 
-    SOCKADDR_IN serverAddr = { 0 };
+#ifndef _WIN32
+    // 서버 재시작 시 TIME_WAIT 포트 재사용
+    int reuse = 1;
+    setsockopt(m_listenSocket, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+#endif
+
+    SOCKADDR_IN serverAddr{};
     serverAddr.sin_family = AF_INET;
     serverAddr.sin_addr.s_addr = htonl(INADDR_ANY);
     serverAddr.sin_port = htons(m_port);
@@ -54,27 +73,48 @@ bool GameServer::Initialize(int port) {
         return false;
     }
 
-    m_hIOCP = CreateIoCompletionPort(INVALID_HANDLE_VALUE, NULL, 0, 0);
-    if (m_hIOCP == NULL) {
-        std::cout << "[Error] CreateIoCompletionPort failed" << std::endl;
-        return false;
+    auto onReceive = [this](int clientID, const char* data, int size) { return HandlePacket(clientID, data, size); };
+    auto onDisconnect = [this](int clientID, int error) { HandleDisconnect(clientID, error); };
+
+    m_io = IOBackend::Create(ioBackend);
+    if (!m_io->Initialize(onReceive, onDisconnect)) {
+        std::cout << "[Error] " << m_io->GetName() << " backend initialization failed" << std::endl;
+
+        // 커널이 지원하지 않는 경우 등 - 플랫폼 기본 백엔드로 대체
+        if (ioBackend.empty() || ioBackend == IOBackend::GetDefaultName()) {
+            return false;
+        }
+        std::cout << "[Server] Falling back to " << IOBackend::GetDefaultName() << " backend" << std::endl;
+        m_io = IOBackend::Create();
+        if (!m_io->Initialize(onReceive, onDisconnect)) {
+            std::cout << "[Error] " << m_io->GetName() << " backend initialization failed" << std::endl;
+            return false;
+        }
+    }
+    std::cout << "[Server] I/O backend: " << m_io->GetName() << std::endl;
+
+    // 위치/스냅샷용 UDP 채널 (같은 포트 번호, 실패하면 모든 패킷을 TCP로)
+    if (!InitializeUdp()) {
+        std::cout << "[Warning] UDP channel unavailable, using TCP only" << std::endl;
     }
 
-    // 호랑이와 나무 초기화
-    InitializeTigers();
-    InitializeTrees();
+    // 월드는 방마다 (첫 로그인 때 엶)
     return true;
 }
 
 void GameServer::Start() {
     m_isRunning = true;
     
-    // Create worker threads
+    // Create worker threads (I/O 전용)
     for (int i = 0; i < 2; ++i) {
-        HANDLE hThread = CreateThread(NULL, 0, WorkerThreadProc, this, 0, NULL);
-        if (hThread) {
-            m_workerThreads.push_back(hThread);
-        }
+        m_workerThreads.emplace_back(&GameServer::WorkerThread, this);
+    }
+
+    // 월드 시뮬레이션은 단일 스레드에서 고정 틱으로 실행
+    m_simThread = std::thread(&GameServer::SimulationThread, this);
+
+    if (m_udpSocket != INVALID_SOCKET) {
+        m_udpThread = std::thread(&GameServer::UdpReceiveThread, this);
     }
 
     // Main accept loop
@@ -91,908 +131,1812 @@ void GameServer::Stop() {
     Cleanup();
 }
 
-DWORD WINAPI GameServer::WorkerThreadProc(LPVOID lpParam) {
-    GameServer* server = static_cast<GameServer*>(lpParam);
-    return server->WorkerThread();
+bool GameServer::InitializeUdp() {
+    m_udpSocket = socket(AF_INET, SOCK_DGRAM, 0);
+    if (m_udpSocket == INVALID_SOCKET) {
+        std::cout << "[Error] Failed to create UDP socket" << std::endl;
+        return false;
+    }
+
+    SOCKADDR_IN udpAddr{};
+    udpAddr.sin_family = AF_INET;
+    udpAddr.sin_addr.s_addr = htonl(INADDR_ANY);
+    udpAddr.sin_port = htons(m_port);
+    if (bind(m_udpSocket, (SOCKADDR*)&udpAddr, sizeof(udpAddr)) == SOCKET_ERROR) {
+        std::cout << "[Error] UDP bind failed" << std::endl;
+        closesocket(m_udpSocket);
+        m_udpSocket = INVALID_SOCKET;
+        return false;
+    }
+
+    // 수신 스레드가 종료 플래그를 확인할 수 있도록 수신 대기에 제한 시간을 둠
+#ifdef _WIN32
+    DWORD timeoutMs = 100;
+    setsockopt(m_udpSocket, SOL_SOCKET, SO_RCVTIMEO, (const char*)&timeoutMs, sizeof(timeoutMs));
+#else
+    timeval timeout = { 0, 100000 };
+    setsockopt(m_udpSocket, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+#endif
+    std::cout << "[Server] UDP channel on port " << m_port << std::endl;
+    return true;
 }
 
-DWORD GameServer::WorkerThread() {
-    DWORD lastTime = GetTickCount();
-    
+void GameServer::UdpReceiveThread() {
+    // 헤더와 크기만 검사해 명령 큐에 넣고, 세션 확인/청크 해석/순서 검사는 시뮬레이션 스레드에서
+    char buffer[MAX_DATAGRAM_SIZE];
     while (m_isRunning) {
-        DWORD currentTime = GetTickCount();
-        float deltaTime = (currentTime - lastTime) / 1000.0f;
-        lastTime = currentTime;
-        
-        // 호랑이 업데이트
-        UpdateTigers(deltaTime);
-        
-        // 기존 IOCP 처리 코드
-        DWORD bytesTransferred;
-        ULONG_PTR completionKey;
-        OVERLAPPED* pOverlapped;
-        
-        BOOL result = GetQueuedCompletionStatus(m_hIOCP, &bytesTransferred, 
-            &completionKey, &pOverlapped, 10); // 타임아웃을 10ms로 설정 (더 자주 업데이트)
-        
-        if (!m_isRunning) break;
-        
-        // 타임아웃 발생 시 (pOverlapped가 NULL)
-        if (!pOverlapped) {
-            continue;  // 타임아웃은 정상적인 상황이므로 계속 진행
+        SOCKADDR_IN from;
+#ifdef _WIN32
+        int fromLen = sizeof(from);
+#else
+        socklen_t fromLen = sizeof(from);
+#endif
+        int received = recvfrom(m_udpSocket, buffer, sizeof(buffer), 0, (SOCKADDR*)&from, &fromLen);
+        if (received <= 0) {
+            continue;   // 제한 시간 초과 또는 ICMP 에러 (연결이 없으므로 무시)
         }
-        
-        IOContext* ioContext = CONTAINING_RECORD(pOverlapped, IOContext, overlapped);
-        int clientID = static_cast<int>(completionKey);
-        
-        if (m_clients.find(clientID) == m_clients.end()) {
-            delete ioContext;
+
+        int bodySize = received - static_cast<int>(sizeof(DatagramHeader));
+        if (bodySize < 0 || bodySize > COMMAND_DATA_SIZE) {
+            m_udpRejected++;
             continue;
         }
-        
-        // 연결 해제 감지: result가 FALSE이고 bytesTransferred가 0인 경우만
-        if (!result && bytesTransferred == 0) {
-            int error = WSAGetLastError();
-            
-            // 연결 관련 에러인 경우에도 연결을 유지 (최대한 관대하게)
-            if (error == WSAENOTSOCK || error == WSAECONNRESET || error == WSAECONNABORTED || error == WSAENETDOWN) {
-                // 클라이언트가 존재하는지 확인
-                auto clientIt = m_clients.find(clientID);
-                if (clientIt != m_clients.end()) {
-                    // 연결 에러 카운트만 증가하고 연결은 유지
-                    clientIt->second.connectionErrorCount++;
-                    
-                    // 에러 카운트가 너무 많으면 연결 제거
-                    if (clientIt->second.connectionErrorCount > 10) {
-                        std::cout << "[Warning] Client " << clientID << " has too many connection errors, removing" << std::endl;
-                        closesocket(clientIt->second.socket);
-                        m_clients.erase(clientIt);
-                        delete ioContext;
-                        continue;
-                    }
-                }
+
+        InboundCommand cmd;
+        cmd.type = InboundCommand::DATAGRAM;
+        cmd.size = static_cast<uint16_t>(bodySize);
+        memcpy(&cmd.datagram, buffer, sizeof(DatagramHeader));
+        cmd.clientID = cmd.datagram.clientID;
+        cmd.error = 0;
+        cmd.from = from;
+        memcpy(cmd.data, buffer + sizeof(DatagramHeader), bodySize);
+        m_commandQueue.Push(cmd);
+    }
+}
+
+bool GameServer::IsUdpLoginDatagram(const char* data, int size) {
+    // 첫 신뢰 세그먼트(번호 0, 조각 1개)가 온전한 LOGIN_REQUEST 하나인지 - 세션 없이 본문만 보고 판단
+    bool login = false;
+    bool parsed = ParseDatagramChunks(data, size,
+        [](const char*, int) {},
+        [&](uint16_t segment, uint8_t fragIndex, uint8_t fragCount, const char* message, int messageSize) {
+            if (segment != 0 || fragIndex != 0 || fragCount != 1 ||
+                messageSize != static_cast<int>(sizeof(PacketLoginRequest))) {
+                return;
             }
-            
-            delete ioContext;
-            continue;
-        }
-        
-        // 정상적인 데이터 수신이지만 bytesTransferred가 0인 경우는 무시
-        if (bytesTransferred == 0) {
-            delete ioContext;
-            continue;
-        }
+            PacketHeader header = ReadPacketHeader(message);
+            login = login || (header.type == PACKET_LOGIN_REQUEST && header.size == sizeof(PacketLoginRequest));
+        });
+    return parsed && login;
+}
 
-        HandlePacket(ioContext, clientID, bytesTransferred);
+int GameServer::FindOrCreateUdpSession(const InboundCommand& cmd) {
+    // 로그인 전 UDP 전용 클라이언트는 아직 clientID/토큰을 모르므로 보낸 주소로 세션을 찾음
+    uint64_t addressKey = MakeAddressKey(cmd.from);
+    auto it = m_udpPeers.find(addressKey);
+    if (it != m_udpPeers.end() && m_clients.Contains(it->second)) {
+        return it->second;
+    }
 
-        // 다음 수신 준비 - 클라이언트 존재 여부 확인
-        auto clientIt = m_clients.find(clientID);
-        if (clientIt == m_clients.end()) {
-            std::cout << "[Error] Client " << clientID << " not found for next receive" << std::endl;
-            delete ioContext;
-            continue;
-        }
-        
-        if (clientIt->second.socket == INVALID_SOCKET) {
-            std::cout << "[Error] Invalid socket for client " << clientID << " for next receive" << std::endl;
-            delete ioContext;
-            continue;
-        }
-        
-        // 다음 수신 준비
-        if (!StartReceive(clientIt->second.socket, clientID, ioContext)) {
-            std::cout << "[Error] Failed to start next receive for client " << clientID << std::endl;
-            delete ioContext;
-            continue;
-        }
+    // 새 주소는 로그인 요청을 실은 데이터그램일 때만 세션/신뢰 채널을 만듦
+    // (보낸 주소는 위조할 수 있으므로 아무 데이터그램에나 할당하지 않음 - 나머지는 상태 없이 버림)
+    if (!IsUdpLoginDatagram(cmd.data, cmd.size)) {
+        return 0;
     }
-    return 0;
+
+    ClientInfo newClient;
+    newClient.socket = INVALID_SOCKET;
+    newClient.isLoggedIn = false;
+    newClient.lastUpdate = {};
+    newClient.udpToken = m_randomEngine() | 1;
+    newClient.udpBound = true;
+    newClient.udpAddr = cmd.from;
+    newClient.reliable = std::make_shared<ReliableChannel>();
+    newClient.lastDatagramTick = m_tickStats.tickCount;
+    int clientID = m_clients.Allocate(newClient);
+    if (clientID == 0) {
+        m_udpSessionsFull++;   // 데이터그램마다 로그를 남기지 않고 LogUdpStats 에서 합계로
+        return 0;
+    }
+    m_udpPeers[addressKey] = clientID;
+    m_udpNewSessions++;
+    return clientID;
 }
 
-void GameServer::HandlePacket(IOContext* ioContext, int clientID, DWORD bytesTransferred) {
-    // 클라이언트 정보 가져오기
-    auto clientIt = m_clients.find(clientID);
-    if (clientIt == m_clients.end()) {
-        std::cout << "[Error] Client " << clientID << " not found in HandlePacket" << std::endl;
-        return;
+void GameServer::ProcessDatagram(InboundCommand& cmd) {
+    const DatagramHeader& header = cmd.datagram;
+    int clientID = cmd.clientID;
+    if (clientID == 0 && header.token == 0) {
+        clientID = FindOrCreateUdpSession(cmd);
     }
-    
-    ClientInfo& client = clientIt->second;
-    
-    // 수신된 데이터를 패킷 버퍼에 추가
-    if (client.packetBufferSize + bytesTransferred > sizeof(client.packetBuffer)) {
-        std::cout << "[Error] Packet buffer overflow for client " << clientID << std::endl;
-        client.packetBufferSize = 0;  // 버퍼 초기화
+    ClientInfo* client = m_clients.Find(clientID);
+    if (!client || client->udpToken == 0 || (header.token != 0 && header.token != client->udpToken) ||
+        (header.token == 0 && !client->reliable)) {
+        m_udpRejected++;
         return;
     }
-    
-    memcpy(client.packetBuffer + client.packetBufferSize, ioContext->buffer, bytesTransferred);
-    client.packetBufferSize += bytesTransferred;
-    
-    // 패킷 버퍼에서 완전한 패킷들을 처리
-    int processedBytes = 0;
-    while (client.packetBufferSize - processedBytes >= sizeof(PacketHeader)) {
-        PacketHeader* header = (PacketHeader*)(client.packetBuffer + processedBytes);
-        
-        // 패킷 헤더 유효성 검사
-        if (header->size < sizeof(PacketHeader) || header->size > MAX_PACKET_SIZE || 
-            header->type <= 0 || header->type > 10) {
-            std::cout << "[Error] Invalid packet header - Size: " << header->size 
-                      << ", Type: " << header->type << ", Client: " << clientID << std::endl;
-            
-            // 잘못된 패킷의 첫 몇 바이트를 출력하여 디버깅
-            std::cout << "[Debug] First 16 bytes: ";
-            for (int i = 0; i < std::min(16, static_cast<int>(client.packetBufferSize - processedBytes)); ++i) {
-                printf("%02X ", static_cast<unsigned char>(client.packetBuffer[processedBytes + i]));
-            }
-            std::cout << std::endl;
-            
-            // 버퍼 초기화
-            client.packetBufferSize = 0;
-            return;
-        }
-        
-        // 완전한 패킷이 있는지 확인
-        if (client.packetBufferSize - processedBytes < header->size) {
-            break;  // 완전한 패킷이 없음
+    client->lastDatagramTick = m_tickStats.tickCount;
+
+    // 오래된 데이터그램의 비신뢰 청크는 버림 (뒤늦게 도착한 위치로 되돌아가지 않도록)
+    // 신뢰 청크와 ack는 순서와 관계없이 처리
+    bool fresh = client->udpRecv.Accept(header.sequence);
+    if (fresh && (!client->udpBound || client->udpAddr.sin_addr.s_addr != cmd.from.sin_addr.s_addr ||
+        client->udpAddr.sin_port != cmd.from.sin_port)) {
+        // 첫 데이터그램을 받으면 그 주소로 UDP 송신 시작 (클라이언트 주소/포트가 바뀌면 따라감)
+        if (!client->udpBound) {
+            std::cout << "[UDP] Client " << clientID << " bound to UDP channel" << std::endl;
         }
-        
-        // 패킷 처리
-        ProcessSinglePacket(client.packetBuffer + processedBytes, clientID, header->size);
-        processedBytes += header->size;
-        
-        // 성공적인 패킷 수신 시 연결 에러 카운트 리셋
-        client.connectionErrorCount = 0;
-    }
-    
-    // 처리된 데이터를 버퍼에서 제거
-    if (processedBytes > 0) {
-        if (processedBytes < client.packetBufferSize) {
-            memmove(client.packetBuffer, client.packetBuffer + processedBytes, 
-                   client.packetBufferSize - processedBytes);
+        if (client->reliable) {
+            m_udpPeers.erase(MakeAddressKey(client->udpAddr));
+            m_udpPeers[MakeAddressKey(cmd.from)] = clientID;
         }
-        client.packetBufferSize -= processedBytes;
+        client->udpAddr = cmd.from;
+        client->udpBound = true;
     }
-}
+    m_udpReceived++;
 
-void GameServer::ProcessSinglePacket(char* buffer, int clientID, int packetSize) {
-    PacketHeader* header = (PacketHeader*)buffer;
-    
-    std::cout << "\n[Receive] From client " << clientID << std::endl;
-    std::cout << "  -> Packet type: " << header->type << std::endl;
-    std::cout << "  -> Packet size: " << header->size << std::endl;
-
-    switch (header->type) {
-        case PACKET_LOGIN_REQUEST: {
-            if (header->size != sizeof(PacketLoginRequest)) {
-                std::cout << "[Error] Invalid LOGIN_REQUEST packet size" << std::endl;
-                break;
-            }
-            PacketLoginRequest* pkt = (PacketLoginRequest*)buffer;
-            
-            // 사용자명 중복 체크
-            bool usernameExists = false;
-            for (const auto& clientPair : m_clients) {
-                const auto& client = clientPair.second;
-                if (client.isLoggedIn && client.username == pkt->username) {
-                    usernameExists = true;
-                    break;
-                }
-            }
-            
-            PacketLoginResponse response;
-            response.header.type = PACKET_LOGIN_RESPONSE;
-            response.header.size = sizeof(PacketLoginResponse);
-            response.clientID = clientID;
-            
-            if (usernameExists) {
-                response.success = false;
-                strncpy_s(response.message, "Username already exists", sizeof(response.message) - 1);
-                std::cout << "[Login] Failed for client " << clientID << " - Username already exists: " << pkt->username << std::endl;
-            } else {
-                response.success = true;
-                strncpy_s(response.message, "Login successful", sizeof(response.message) - 1);
-                
-                // 클라이언트 정보 업데이트
-                m_clients[clientID].username = pkt->username;
-                m_clients[clientID].isLoggedIn = true;
-                
-                std::cout << "[Login] Success for client " << clientID << " - Username: " << pkt->username << std::endl;
-                
-                // 로그인 성공 후 플레이어 스폰 패킷 전송
-                PacketPlayerSpawn spawnPacket;
-                spawnPacket.header.type = PACKET_PLAYER_SPAWN;
-                spawnPacket.header.size = sizeof(PacketPlayerSpawn);
-                spawnPacket.playerID = clientID;
-                strncpy_s(spawnPacket.username, pkt->username, sizeof(spawnPacket.username) - 1);
-                
-                BroadcastPacket(&spawnPacket, sizeof(spawnPacket));
-                
-                // 로그인 성공 후 클라이언트 준비 완료 신호를 기다림
-                std::cout << "[Login] Waiting for client " << clientID << " to send ready signal" << std::endl;
-                
-                // BroadcastNewPlayer 호출 제거 - 클라이언트가 ready 신호를 보낸 후 처리하도록 변경
-            }
-            
-            SendPacket(m_clients[clientID].socket, &response, sizeof(response));
-            break;
-        }
-        
-        case PACKET_PLAYER_DISCONNECT: {
-            if (header->size != sizeof(PacketPlayerDisconnect)) {
-                std::cout << "[Error] Invalid PLAYER_DISCONNECT packet size" << std::endl;
-                break;
-            }
-            PacketPlayerDisconnect* pkt = (PacketPlayerDisconnect*)buffer;
-            
-            std::cout << "[Disconnect] Player " << pkt->username << " (ID: " << pkt->playerID << ") disconnected" << std::endl;
-            
-            // 다른 클라이언트들에게 연결 해제 알림
-            BroadcastPacket(pkt, sizeof(PacketPlayerDisconnect), clientID);
-            
-            // 클라이언트 제거
-            auto clientIt = m_clients.find(clientID);
-            if (clientIt != m_clients.end()) {
-                if (clientIt->second.socket != INVALID_SOCKET) {
-                    closesocket(clientIt->second.socket);
-                    clientIt->second.socket = INVALID_SOCKET;
-                }
-                m_clients.erase(clientIt);
-                std::cout << "[Disconnect] Client " << clientID << " removed. Remaining clients: " << m_clients.size() << std::endl;
-            } else {
-                std::cout << "[Disconnect] Client " << clientID << " not found in client list" << std::endl;
-            }
-            break;
-        }
-        
-        case PACKET_PLAYER_UPDATE: {
-            if (header->size != sizeof(PacketPlayerUpdate)) {
-                std::cout << "[Error] Invalid PLAYER_UPDATE packet size" << std::endl;
-                break;
-            }
-            
-            // 클라이언트 존재 여부 확인
-            auto clientIt = m_clients.find(clientID);
-            if (clientIt == m_clients.end()) {
-                std::cout << "[Error] Client " << clientID << " not found for PLAYER_UPDATE" << std::endl;
-                break;
-            }
-            
-            // 소켓 유효성 확인
-            if (clientIt->second.socket == INVALID_SOCKET) {
-                std::cout << "[Error] Invalid socket for client " << clientID << " in PLAYER_UPDATE" << std::endl;
-                break;
-            }
-            
-            PacketPlayerUpdate* pkt = (PacketPlayerUpdate*)buffer;
-            pkt->clientID = clientID;
-            clientIt->second.lastUpdate = *pkt;
-            
-            // 애니메이션 정보 로그 (디버깅용)
-            std::cout << "[PlayerUpdate] Client " << clientID << " at (" << pkt->x << ", " << pkt->y << ", " << pkt->z 
-                      << ") animation: " << pkt->animationFile << " time: " << pkt->animationTime << std::endl;
-            
-            BroadcastPacket(pkt, sizeof(PacketPlayerUpdate), clientID);
-            break;
-        }
-        case PACKET_PLAYER_SPAWN: {
-            if (header->size != sizeof(PacketPlayerSpawn)) {
-                std::cout << "[Error] Invalid PLAYER_SPAWN packet size" << std::endl;
-                break;
-            }
-            PacketPlayerSpawn* pkt = (PacketPlayerSpawn*)buffer;
-            BroadcastPacket(pkt, sizeof(PacketPlayerSpawn), clientID);
-            break;
-        }
-        case PACKET_TIGER_SPAWN: {
-            if (header->size != sizeof(PacketTigerSpawn)) {
-                std::cout << "[Error] Invalid TIGER_SPAWN packet size" << std::endl;
-                break;
-            }
-            PacketTigerSpawn* pkt = (PacketTigerSpawn*)buffer;
-            BroadcastPacket(pkt, sizeof(PacketTigerSpawn));
-            break;
-        }
-        case PACKET_TIGER_UPDATE: {
-            if (header->size != sizeof(PacketTigerUpdate)) {
-                std::cout << "[Error] Invalid TIGER_UPDATE packet size" << std::endl;
-                break;
-            }
-            PacketTigerUpdate* pkt = (PacketTigerUpdate*)buffer;
-            BroadcastPacket(pkt, sizeof(PacketTigerUpdate));
-            break;
-        }
-        case PACKET_CLIENT_READY: {
-            if (header->size != sizeof(PacketClientReady)) {
-                std::cout << "[Error] Invalid CLIENT_READY packet size" << std::endl;
-                break;
+    // 핸들러가 세션을 제거할 수 있으므로 채널은 참조를 잡아 두고, 패킷마다 세션을 다시 확인
+    std::shared_ptr<ReliableChannel> channel = client->reliable;
+    if (channel) {
+        channel->OnAck(header.reliableAck, header.reliableAckBits, ReliableChannel::Clock::now());
+    }
+    bool parsed = ParseDatagramChunks(cmd.data, cmd.size,
+        [&](const char* packet, int size) {
+            // 비신뢰: 최신 상태만 의미 있는 패킷만
+            if (!fresh || !m_clients.Contains(clientID)) return;
+            if (size < static_cast<int>(sizeof(PacketHeader))) return;
+            PacketHeader packetHeader = ReadPacketHeader(packet);
+            if (packetHeader.size != size ||
+                (packetHeader.type != PACKET_PLAYER_UPDATE && packetHeader.type != PACKET_SNAPSHOT_ACK)) {
+                m_udpRejected++;
+                return;
             }
-            PacketClientReady* pkt = (PacketClientReady*)buffer;
-            std::cout << "[ClientReady] Client " << clientID << " is ready to receive game data" << std::endl;
-            
-            // 클라이언트가 준비되었으므로 호랑이 스폰 패킷들을 순차적으로 전송
-            std::cout << "[ClientReady] Sending tiger spawn packets to client " << clientID << std::endl;
-            std::cout << "[ClientReady] Total tigers to spawn: " << m_tigers.size() << std::endl;
-            
-            // 클라이언트 소켓 상태 재확인
-            if (m_clients[clientID].socket == INVALID_SOCKET) {
-                std::cout << "[Error] Client " << clientID << " socket is invalid, cannot send tiger spawn packets" << std::endl;
-                break;
+            DispatchDatagramPackets(clientID, packet, size);
+        },
+        [&](uint16_t segment, uint8_t fragIndex, uint8_t fragCount, const char* data, int size) {
+            if (!channel) {
+                m_udpRejected++;   // TCP 세션은 신뢰 청크를 쓰지 않음
+                return;
             }
-            
-            for (const auto& [tigerID, tiger] : m_tigers) {
-                // 각 패킷 전송 전 클라이언트 상태 재확인
-                if (m_clients.find(clientID) == m_clients.end() || 
-                    m_clients[clientID].socket == INVALID_SOCKET) {
-                    std::cout << "[Error] Client " << clientID << " disconnected during tiger spawn, stopping" << std::endl;
-                    break;
+            channel->OnSegment(segment, fragIndex, fragCount, data, size, [&](const char* message, int messageSize) {
+                if (m_clients.Contains(clientID)) {
+                    DispatchDatagramPackets(clientID, message, messageSize);
                 }
-                
-                PacketTigerSpawn tigerPacket;
-                tigerPacket.header.type = PACKET_TIGER_SPAWN;
-                tigerPacket.header.size = sizeof(PacketTigerSpawn);
-                tigerPacket.tigerID = tiger.tigerID;
-                tigerPacket.x = tiger.x;
-                tigerPacket.y = tiger.y;
-                tigerPacket.z = tiger.z;
-                
-                std::cout << "[ClientReady] Attempting to send tiger spawn packet for ID: " << tiger.tigerID 
-                          << " at position (" << tiger.x << ", " << tiger.y << ", " << tiger.z << ")" << std::endl;
-                
-                if (!SendPacket(m_clients[clientID].socket, &tigerPacket, sizeof(PacketTigerSpawn))) {
-                    std::cout << "[Error] Failed to send tiger spawn packet for ID: " << tiger.tigerID << std::endl;
-                    // 에러가 발생하면 더 이상 전송하지 않음
-                    break;
-                }
-                std::cout << "[Success] Sent tiger spawn packet for ID: " << tiger.tigerID << std::endl;
-                
-                // 각 호랑이 스폰 사이에 짧은 지연 추가 (클라이언트 처리 시간 확보)
-                Sleep(50);  // 50ms로 줄임
-            }
-            
-            std::cout << "[ClientReady] Completed sending all tiger spawn packets to client " << clientID << std::endl;
-            
-            // 나무 위치 정보 전송
-            SendTreePositions(clientID);
-            
-            // 모든 패킷 전송 완료 후 짧은 지연 (클라이언트 처리 시간 확보)
-            Sleep(100);  // 100ms로 줄임
-            
-            // 클라이언트 상태 최종 확인
-            if (m_clients.find(clientID) != m_clients.end() && 
-                m_clients[clientID].socket != INVALID_SOCKET) {
-                std::cout << "[ClientReady] Client " << clientID << " successfully received all tiger spawn packets" << std::endl;
-                
-                // 호랑이 스폰 완료 후 기존 플레이어 정보 전송
-                BroadcastNewPlayer(clientID);
-            } else {
-                std::cout << "[Error] Client " << clientID << " disconnected after tiger spawn" << std::endl;
-            }
-            break;
+            });
+        });
+    if (!parsed) {
+        m_udpRejected++;
+    }
+}
+
+void GameServer::DispatchDatagramPackets(int clientID, const char* data, int size) {
+    // 메시지 하나에 패킷이 여러 개 이어져 있을 수 있음 (TCP 스트림과 같은 프레이밍)
+    char packet[MAX_PACKET_SIZE];
+    int offset = 0;
+    while (size - offset >= static_cast<int>(sizeof(PacketHeader))) {
+        PacketHeader header = ReadPacketHeader(data + offset);
+        if (header.size < sizeof(PacketHeader) || header.size > MAX_PACKET_SIZE || header.size > size - offset ||
+            !IsKnownPacketType(header.type)) {
+            m_udpRejected++;
+            return;
         }
-        default:
-            std::cout << "  -> Unknown packet type" << std::endl;
-            break;
+        if (!m_clients.Contains(clientID)) return;
+        memcpy(packet, data + offset, header.size);
+        ProcessSinglePacket(packet, clientID, header.size);
+        offset += header.size;
     }
 }
 
-void GameServer::Cleanup() {
-    m_isRunning = false;
+bool GameServer::SendUnreliable(int clientID, ClientInfo& client, const void* packet, int size) {
+    // UDP가 아직 연결되지 않은 클라이언트는 TCP로
+    if (!client.udpBound || m_udpSocket == INVALID_SOCKET) {
+        return SendPacket(client, packet, size);
+    }
 
-    for (auto& [id, client] : m_clients) {
-        closesocket(client.socket);
+    char datagram[MAX_DATAGRAM_SIZE];
+    int body = WriteUnreliableChunk(datagram + sizeof(DatagramHeader), MAX_DATAGRAM_SIZE - static_cast<int>(sizeof(DatagramHeader)), packet, size);
+    if (body == 0) {
+        return SendPacket(client, packet, size);   // 데이터그램보다 큼
     }
-    m_clients.clear();
+    SendDatagram(clientID, client, datagram, body);
+    return true;
+}
 
-    if (m_listenSocket != INVALID_SOCKET) {
-        closesocket(m_listenSocket);
-        m_listenSocket = INVALID_SOCKET;
+void GameServer::SendDatagram(int clientID, ClientInfo& client, char* datagram, int bodySize) {
+    // 헤더를 채우고 (신뢰 채널 ack를 함께 실음) 보냄. 실패해도 다음 틱 상태/재전송이 대신함
+    DatagramHeader header;
+    header.token = client.udpToken;
+    header.clientID = clientID;
+    header.sequence = ++client.udpSendSequence;
+    header.reliableAck = client.reliable ? client.reliable->GetAck() : 0;
+    header.reliableAckBits = client.reliable ? client.reliable->GetAckBits() : 0;
+    memcpy(datagram, &header, sizeof(header));
+    if (client.reliable) {
+        client.reliable->OnAckSent();
     }
 
-    for (HANDLE hThread : m_workerThreads) {
-        WaitForSingleObject(hThread, INFINITE);
-        CloseHandle(hThread);
+    // 손실 주입 (--udp-loss, 테스트용): 보낸 것으로 치고 버림
+    if (m_udpLossPercent > 0 && std::uniform_int_distribution<int>(0, 99)(m_randomEngine) < m_udpLossPercent) {
+        m_udpInjectedDrops++;
+        return;
     }
-    m_workerThreads.clear();
 
-    if (m_hIOCP) {
-        CloseHandle(m_hIOCP);
-        m_hIOCP = NULL;
+    int sent = sendto(m_udpSocket, datagram, static_cast<int>(sizeof(header)) + bodySize, 0,
+        (const SOCKADDR*)&client.udpAddr, sizeof(client.udpAddr));
+    if (sent == SOCKET_ERROR) {
+        m_udpSendErrors++;   // 송신 버퍼가 찼음
+        return;
     }
+    m_udpSent++;
+}
 
-    WSACleanup();
+void GameServer::FlushDatagrams() {
+    // UDP 전용 세션의 신뢰 채널: 새 세그먼트, RTO가 지난 재전송, 보낼 ack가 있으면 데이터그램으로
+    if (m_udpSocket == INVALID_SOCKET) return;
+    const auto now = ReliableChannel::Clock::now();
+    char datagram[MAX_DATAGRAM_SIZE];
+    const int capacity = MAX_DATAGRAM_SIZE - static_cast<int>(sizeof(DatagramHeader));
+    m_clients.ForEach([&](int id, ClientInfo& client) {
+        if (!client.reliable) return;
+        while (true) {
+            int body = client.reliable->WriteSegments(datagram + sizeof(DatagramHeader), capacity, now);
+            if (body == 0 && !client.reliable->NeedsAck()) break;
+            SendDatagram(id, client, datagram, body);
+            if (body == 0) break;
+        }
+    });
 }
 
-// [Broadcast] 관련 반복 로그 주석 처리
-void GameServer::BroadcastPacket(const void* packet, int size, int excludeID) {
-    // Player 테스트를 위해 간소화된 브로드캐스트
-    for (auto& [id, client] : m_clients) {
-        if (!client.isLoggedIn || client.socket == INVALID_SOCKET || id == excludeID)
-            continue;
-            
-        if (!SendPacket(client.socket, packet, size)) {
-            std::cout << "[Broadcast] Failed to send packet to client " << id << std::endl;
-            continue;
+void GameServer::CheckUdpTimeouts() {
+    // UDP 전용 세션은 연결 종료를 알 수 없으므로 일정 시간 아무것도 오지 않으면 제거
+    const uint64_t maxTicks = static_cast<uint64_t>(m_tickRate) * UDP_SESSION_TIMEOUT_SEC;
+    std::vector<int> expired;
+    m_clients.ForEach([&](int id, const ClientInfo& client) {
+        if (client.reliable && m_tickStats.tickCount - client.lastDatagramTick > maxTicks) {
+            expired.push_back(id);
         }
+    });
+    for (int id : expired) {
+        std::cout << "[UDP] Client " << id << " timed out" << std::endl;
+        RemoveClient(id, 0);
     }
 }
 
-void GameServer::ProcessNewClient(SOCKET clientSocket) {
-    int clientID = m_nextClientID++;
-    std::cout << "[Info] ProcessNewClient" << std::endl;
-    
-    ClientInfo newClient;
-    newClient.socket = clientSocket;
-    newClient.clientID = clientID;
-    newClient.username = "";
-    newClient.isLoggedIn = false;
-    newClient.lastUpdate = { 0 };
-    newClient.packetBufferSize = 0;  // 패킷 버퍼 초기화
-    memset(newClient.packetBuffer, 0, sizeof(newClient.packetBuffer));
-    
-    // 1. IOCP 설정
-    if (CreateIoCompletionPort((HANDLE)clientSocket, m_hIOCP, clientID, 0) == NULL) {
-        std::cout << "[Error] Failed to associate with IOCP" << std::endl;
-        closesocket(clientSocket);
-        return;
-    }
-    
-    // 2. 수신 시작 - 먼저 시작
-    IOContext* ioContext = new IOContext();
-    if (!StartReceive(clientSocket, clientID, ioContext)) {
-        std::cout << "[Error] Failed to start receive" << std::endl;
-        delete ioContext;
-        closesocket(clientSocket);
-        return;
+void GameServer::LogUdpStats() {
+    if (m_udpSocket == INVALID_SOCKET) return;
+    uint64_t stale = 0, lost = 0, resends = 0;
+    size_t pending = 0;
+    // 신뢰 채널은 세션마다 출력하지 않고 합계 + RTT 가 가장 나쁜 세션 하나만 (세션 수와 무관하게 두 줄)
+    int reliableSessions = 0;
+    float srttSum = 0.0f;
+    int worstID = 0;
+    const ReliableChannel* worst = nullptr;
+    m_clients.ForEach([&](int id, const ClientInfo& client) {
+        stale += client.udpRecv.GetStaleCount();
+        lost += client.udpRecv.GetLostCount();
+        if (client.reliable) {
+            resends += client.reliable->GetResendCount();
+            pending += client.reliable->GetPendingCount();
+            reliableSessions++;
+            srttSum += client.reliable->GetSmoothedRttMs();
+            if (!worst || client.reliable->GetSmoothedRttMs() > worst->GetSmoothedRttMs()) {
+                worst = client.reliable.get();
+                worstID = id;
+            }
+        }
+    });
+    if (worst) {
+        std::cout << "[UDP] " << reliableSessions << " reliable sessions: srtt avg " << srttSum / reliableSessions
+                  << " ms, worst client " << worstID << " srtt " << worst->GetSmoothedRttMs() << " ms, rto "
+                  << worst->GetRtoMs() << " ms, unacked " << worst->GetPendingCount() << ", resends "
+                  << worst->GetResendCount() << std::endl;
     }
-    
-    // 3. 클라이언트 맵에 추가
-    m_clients[clientID] = newClient;
-    std::cout << "[ProcessNewClient] " << clientID << " added to map. Total clients: " << m_clients.size() << std::endl;
-    
-    // 4. 로그인 대기 상태로 설정 (호랑이 스폰 패킷은 로그인 성공 후에 전송)
-    std::cout << "[ProcessNewClient] Client " << clientID << " waiting for login..." << std::endl;
+    std::cout << "[UDP] sent " << m_udpSent << ", received " << m_udpReceived << ", stale dropped " << stale
+              << ", lost " << lost << ", rejected " << m_udpRejected << ", send errors " << m_udpSendErrors
+              << ", injected drops " << m_udpInjectedDrops << ", reliable resends " << resends
+              << ", unacked " << pending << ", new sessions " << m_udpNewSessions
+              << " (table full " << m_udpSessionsFull << ")" << std::endl;
+    m_udpNewSessions = 0;
+    m_udpSessionsFull = 0;
 }
 
-bool GameServer::SendPacket(SOCKET socket, const void* packet, int size) {
-    if (socket == INVALID_SOCKET) return false;
-    
-    // Player 테스트를 위해 간소화된 send
-    int ret = send(socket, (const char*)packet, size, 0);
-    if (ret == SOCKET_ERROR) {
-        int err = WSAGetLastError();
-        
-        // 연결 관련 에러는 즉시 false 반환
-        if (err == WSAECONNRESET || err == WSAECONNABORTED || err == WSAENOTSOCK) {
-            std::cout << "[SendPacket] Connection error (socket: " << socket << ", Error: " << err << ")" << std::endl;
-            return false;
-        }
-        
-        // 기타 에러도 false 반환
-        std::cout << "[SendPacket] Send failed (socket: " << socket << ", Error: " << err << ")" << std::endl;
-        return false;
+void GameServer::LogCompressionStats() {
+    CompressionStats& stats = m_compressStats;
+    if (stats.packets == 0) return;
+    std::cout << "[LZ] compressed " << stats.packets << " packets, " << stats.rawBytes << " -> " << stats.compressedBytes
+              << " bytes (" << (100.0 * stats.compressedBytes / stats.rawBytes) << "%), "
+              << (stats.elapsedUs * 1024.0f / stats.rawBytes) << " us/KB" << std::endl;
+    stats = CompressionStats{};
+}
+
+void GameServer::WorkerThread() {
+    while (m_isRunning) {
+        // I/O 완료 처리 (수신 데이터는 HandlePacket, 연결 종료는 HandleDisconnect로 전달됨)
+        // 월드 상태는 건드리지 않고 패킷을 잘라서 시뮬레이션 스레드 큐에 넣기만 한다
+        m_io->Poll(10);
     }
-    
-    return true;
 }
 
-bool GameServer::StartReceive(SOCKET clientSocket, int clientID, IOContext* ioContext) {
-    memset(&ioContext->overlapped, 0, sizeof(OVERLAPPED));
-    ioContext->wsaBuf.buf = ioContext->buffer;
-    ioContext->wsaBuf.len = sizeof(ioContext->buffer);
-    ioContext->flags = 0;
+void GameServer::SimulationThread() {
+    using Clock = std::chrono::steady_clock;
+    const auto period = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / m_tickRate));
+    const float deltaTime = 1.0f / m_tickRate;  // 고정 시간 간격
+    const float budgetMs = 1000.0f / m_tickRate;
 
-    DWORD recvBytes;
-    if (WSARecv(clientSocket, &ioContext->wsaBuf, 1, &recvBytes,
-        &ioContext->flags, &ioContext->overlapped, NULL) == SOCKET_ERROR) {
-        int error = WSAGetLastError();
-        if (error != ERROR_IO_PENDING && error != WSAEWOULDBLOCK) {
-            std::cout << "[Error] Initial WSARecv failed with error: " << error << std::endl;
-            return false;
+    std::cout << "[Simulation] Tick thread started at " << m_tickRate << " Hz" << std::endl;
+
+    // 다음 틱 시각을 시작 시각 + n * period 로 계산하여 누적 오차(drift) 없음
+    auto nextTick = Clock::now() + period;
+    while (m_isRunning) {
+        auto tickStart = Clock::now();
+
+        ProcessCommands();
+        UpdateRooms(deltaTime);
+        UpdateSendBackpressure();
+        CheckUdpTimeouts();
+        FlushDatagrams();  // 신뢰 채널 전송/재전송/ack
+        m_io->Flush();  // 이번 틱에 쌓인 송신을 소켓당 한 번의 쓰기로 제출
+
+        auto tickEnd = Clock::now();
+        RecordTick(std::chrono::duration<float, std::milli>(tickEnd - tickStart).count(), budgetMs);
+
+        if (tickEnd < nextTick) {
+            std::this_thread::sleep_until(nextTick);
+            nextTick += period;
+        } else {
+            // 예산 초과 - 한 주기 이상 밀렸으면 따라잡지 않고 건너뜀 (시뮬레이션 폭주 방지)
+            nextTick += period;
+            while (nextTick <= tickEnd) {
+                nextTick += period;
+                m_tickStats.skippedTicks++;
+            }
         }
     }
-    return true;
 }
 
-void GameServer::BroadcastNewPlayer(int newClientID) {
-    std::cout << "\n[BroadcastNewPlayer] New client ID: " << newClientID << std::endl;
-    
-    // 새 클라이언트가 로그인되었는지 확인
-    if (m_clients.find(newClientID) == m_clients.end() || !m_clients[newClientID].isLoggedIn) {
-        std::cout << "[BroadcastNewPlayer] Client " << newClientID << " is not logged in yet, skipping" << std::endl;
-        return;
+void GameServer::RecordTick(float elapsedMs, float budgetMs) {
+    TickStats& stats = m_tickStats;
+    stats.tickCount++;
+    stats.windowMs.push_back(elapsedMs);
+    stats.windowMaxMs = std::max(stats.windowMaxMs, elapsedMs);
+    if (elapsedMs > budgetMs) {
+        stats.overrunCount++;
+        stats.windowOverruns++;
+        std::cout << "[Tick] Overrun at tick " << stats.tickCount << ": " << elapsedMs
+                  << " ms (budget " << budgetMs << " ms)" << std::endl;
     }
-    
-    // 새 클라이언트 소켓 상태 확인
-    if (m_clients[newClientID].socket == INVALID_SOCKET) {
-        std::cout << "[BroadcastNewPlayer] Client " << newClientID << " socket is invalid, skipping" << std::endl;
+
+    // 약 10초마다 요약 보고
+    if (stats.windowMs.size() < static_cast<size_t>(m_tickRate) * 10) {
         return;
     }
-    
-    try {
-        // Player 테스트를 위해 간소화된 브로드캐스트
-        // 기존 플레이어 정보를 새 클라이언트에게 전송
-        for (const auto& [id, client] : m_clients) {
-            if (id != newClientID && client.isLoggedIn && client.socket != INVALID_SOCKET) {
-                PacketPlayerSpawn existingClientPacket;
-                existingClientPacket.header.type = PACKET_PLAYER_SPAWN;
-                existingClientPacket.header.size = sizeof(PacketPlayerSpawn);
-                existingClientPacket.playerID = id;
-                strncpy_s(existingClientPacket.username, client.username.c_str(), sizeof(existingClientPacket.username) - 1);
-                
-                // 새 클라이언트 상태 재확인
-                if (m_clients.find(newClientID) == m_clients.end() || 
-                    m_clients[newClientID].socket == INVALID_SOCKET) {
-                    std::cout << "[BroadcastNewPlayer] Client " << newClientID << " disconnected during broadcast, stopping" << std::endl;
-                    return;
-                }
-                
-                if (!SendPacket(m_clients[newClientID].socket, &existingClientPacket, sizeof(existingClientPacket))) {
-                    std::cout << "[Error] Failed to send existing player info for ID: " << id << std::endl;
-                    continue;
-                }
-                std::cout << "[BroadcastNewPlayer] Sent existing player " << id << " info to new client" << std::endl;
-            }
-        }
-        
-        // 새 클라이언트 정보를 다른 로그인된 클라이언트들에게 전송
-        PacketPlayerSpawn newClientPacket;
-        newClientPacket.header.type = PACKET_PLAYER_SPAWN;
-        newClientPacket.header.size = sizeof(PacketPlayerSpawn);
-        newClientPacket.playerID = newClientID;
-        strncpy_s(newClientPacket.username, m_clients[newClientID].username.c_str(), sizeof(newClientPacket.username) - 1);
-        
-        // 간단한 브로드캐스트 (에러 처리 개선)
-        int broadcastCount = 0;
-        for (auto& [id, client] : m_clients) {
-            if (id != newClientID && client.isLoggedIn && client.socket != INVALID_SOCKET) {
-                if (SendPacket(client.socket, &newClientPacket, sizeof(newClientPacket))) {
-                    broadcastCount++;
-                    std::cout << "[BroadcastNewPlayer] Sent new player info to client " << id << std::endl;
-                } else {
-                    std::cout << "[BroadcastNewPlayer] Failed to send new player info to client " << id << std::endl;
-                }
+
+    float total = 0.0f;
+    for (float ms : stats.windowMs) total += ms;
+    float avg = total / stats.windowMs.size();
+    size_t p99Index = stats.windowMs.size() * 99 / 100;
+    std::nth_element(stats.windowMs.begin(), stats.windowMs.begin() + p99Index, stats.windowMs.end());
+    float p99 = stats.windowMs[p99Index];
+
+    std::cout << "[Tick] " << stats.windowMs.size() << " ticks: avg " << avg << " ms, p99 " << p99
+              << " ms, max " << stats.windowMaxMs << " ms, budget " << budgetMs << " ms ("
+              << (avg / budgetMs * 100.0f) << "% used), overruns " << stats.windowOverruns
+              << " (total " << stats.overrunCount << ", skipped " << stats.skippedTicks << ")" << std::endl;
+    m_io->LogStats();
+    LogUdpStats();
+    LogSnapshotBudgets();
+    LogCompressionStats();
+    LogRoomStats();
+
+    stats.windowMs.clear();
+    stats.windowMaxMs = 0.0f;
+    stats.windowOverruns = 0;
+}
+
+void GameServer::ProcessCommands() {
+    // 이번 틱까지 들어온 명령을 한 번에 처리 (명령은 큐 칸 안에서 바로 사용, 복사 없음)
+    m_commandQueue.Drain([this](InboundCommand& cmd) {
+        if (cmd.type == InboundCommand::PACKET) {
+            if (ClientColdInfo* cold = m_clients.FindCold(cmd.clientID)) {
+                cold->connectionErrorCount = 0;   // 성공적인 패킷 수신 시 연결 에러 카운트 리셋
+                ProcessSinglePacket(cmd.data, cmd.clientID, cmd.size);
             }
+        } else if (cmd.type == InboundCommand::DATAGRAM) {
+            ProcessDatagram(cmd);
+        } else {
+            RemoveClient(cmd.clientID, cmd.error);
         }
-        
-        std::cout << "[BroadcastNewPlayer] Completed sending info to new client. Broadcasted to " << broadcastCount << " clients" << std::endl;
+    });
+}
+
+void GameServer::HandleDisconnect(int clientID, int error) {
+    // I/O 스레드에서 호출됨 - 실제 제거는 시뮬레이션 스레드에서
+    InboundCommand cmd;
+    cmd.type = InboundCommand::DISCONNECT;
+    cmd.size = 0;
+    cmd.clientID = clientID;
+    cmd.error = error;
+    m_commandQueue.Push(cmd);
+}
+
+void GameServer::RemoveClient(int clientID, int error) {
+    ClientInfo* client = m_clients.Find(clientID);
+    if (!client) {
+        return;  // 이미 제거됨 (이전 세대 핸들)
     }
-    catch (const std::exception& e) {
-        std::cout << "[Error] Exception in BroadcastNewPlayer: " << e.what() << std::endl;
+    
+    // 더 이상 수신이 등록되지 않으므로 클라이언트 제거
+    std::cout << "[Warning] Client " << clientID << " connection closed (error: " << error << "), removing" << std::endl;
+    if (client->socket != INVALID_SOCKET) {
+        m_io->RemoveClient(client->socket, clientID);   // 소켓은 백엔드가 닫음
+    }
+    if (client->reliable) {
+        m_udpPeers.erase(MakeAddressKey(client->udpAddr));
     }
-    catch (...) {
-        std::cout << "[Error] Unknown exception in BroadcastNewPlayer" << std::endl;
+
+    // 로그인한 플레이어였으면 같은 방의 다른 플레이어에게 연결 해제 알림 (서버가 만든 패킷)
+    GameRoom* room = FindRoom(*client);
+    if (client->isLoggedIn && room) {
+        PacketPlayerDisconnect notice = MakePacket<PacketPlayerDisconnect>();
+        notice.playerID = clientID;
+        strncpy_s(notice.username, m_clients.FindCold(clientID)->username.c_str(), sizeof(notice.username) - 1);
+        const int roomID = room->ID();
+        const bool closed = LeaveRoom(clientID);
+        m_clients.Free(clientID);
+        if (closed) {
+            std::cout << "[Room] Room " << roomID << " is empty, returned to pool (" << m_openRooms.size() << " open)" << std::endl;
+            return;
+        }
+        BroadcastPacket(*room, &notice, sizeof(notice));
+        return;
     }
+    m_clients.Free(clientID);
 }
 
-void GameServer::InitializeTigers() {
-    std::cout << "\n[InitializeTigers] Starting tiger initialization..." << std::endl;
-    
-    // 성능 개선을 위해 호랑이 수를 5마리로 줄임
-    float basePosX = 500.0f;
-    float basePosZ = 500.0f;
-    float offset = 150.0f;  // 간격을 좀 더 넓게
-    
-    // 5마리 호랑이를 적절히 배치
-    std::vector<std::pair<float, float>> positions = {
-        {basePosX - offset, basePosZ - offset},      // 좌상단
-        {basePosX + offset, basePosZ - offset},      // 우상단
-        {basePosX, basePosZ},                        // 중앙
-        {basePosX - offset, basePosZ + offset},      // 좌하단
-        {basePosX + offset, basePosZ + offset}       // 우하단
-    };
-    
-    // 고정된 값들을 사용하여 모든 클라이언트가 동일한 호랑이를 보도록 함
-    std::vector<float> fixedRotations = {0.0f, 90.0f, 180.0f, 270.0f, 45.0f};  // 고정된 회전값
-    std::vector<float> fixedMoveTimers = {1.0f, 1.5f, 2.0f, 0.5f, 1.2f};       // 고정된 이동 타이머
+int GameServer::HandlePacket(int clientID, const char* data, int bytesAvailable) {
+    // data는 백엔드 수신 링의 미처리 구간 (항상 연속) - 여기서는 프레임 경계만 찾고 복사/이동하지 않음
+    // I/O 스레드: 세션 테이블은 Contains(핸들 세대 확인)만 - 슬롯 내용은 시뮬레이션 스레드에서만 읽고 씀
+    if (!m_clients.Contains(clientID)) {
+        std::cout << "[Error] Client " << clientID << " not found in HandlePacket" << std::endl;
+        return -1;
+    }
     
-    for (size_t i = 0; i < positions.size(); ++i) {
-        TigerInfo tiger;
-        tiger.tigerID = m_nextTigerID++;
+    // 완전한 패킷들을 처리
+    int processedBytes = 0;
+    while (bytesAvailable - processedBytes >= static_cast<int>(sizeof(PacketHeader))) {
+        PacketHeader header = ReadPacketHeader(data + processedBytes);
         
-        // 위치에 배치
-        tiger.x = positions[i].first;
-        tiger.y = 0.0f;
-        tiger.z = positions[i].second;
-        tiger.rotY = fixedRotations[i];  // 고정된 회전값 사용
-        tiger.moveTimer = fixedMoveTimers[i];  // 고정된 이동 타이머 사용
-        tiger.isChasing = false;
-        tiger.currentAnimation = "0722_tiger_idle2.fbx";  // 초기 애니메이션
-        tiger.animationTime = 0.0f;  // 초기 애니메이션 시간
-        tiger.attackTime = 0.0f;     // 초기 공격 타이머
-        tiger.searchTime = 0.0f;     // 초기 탐색 타이머
-        tiger.elapseTime = 0.0f;     // 초기 애니메이션 경과 시간
-        tiger.isFired = false;       // 초기 공격 발사 상태
+        // 패킷 헤더 유효성 검사 (타입 범위는 공용 스키마 테이블, 정확한 크기는 디스패치 때)
+        if (header.size < sizeof(PacketHeader) || header.size > MAX_PACKET_SIZE || 
+            !IsKnownPacketType(header.type)) {
+            std::cout << "[Error] Invalid packet header - Size: " << header.size 
+                      << ", Type: " << header.type << ", Client: " << clientID << std::endl;
+            
+            // 잘못된 패킷의 첫 몇 바이트를 출력하여 디버깅
+            std::cout << "[Debug] First 16 bytes: ";
+            for (int i = 0; i < std::min(16, bytesAvailable - processedBytes); ++i) {
+                printf("%02X ", static_cast<unsigned char>(data[processedBytes + i]));
+            }
+            std::cout << std::endl;
+            
+            // 프레임 경계를 잃었으므로 받은 데이터를 모두 버림
+            return bytesAvailable;
+        }
         
-        // 고정된 초기 목표 위치 설정
-        float moveAngle = (i * 72.0f) * (3.141592f / 180.0f);  // 72도씩 회전 (360/5)
-        float moveDistance = 60.0f;  // 고정된 거리
-        tiger.targetX = tiger.x + cos(moveAngle) * moveDistance;
-        tiger.targetZ = tiger.z + sin(moveAngle) * moveDistance;
+        // 완전한 패킷이 있는지 확인
+        if (bytesAvailable - processedBytes < header.size) {
+            break;  // 나머지는 링에 남겨두고 다음 수신 때 이어서 처리
+        }
         
-        m_tigers[tiger.tigerID] = tiger;
-
-        std::cout << "[Tiger] Created tiger ID: " << tiger.tigerID 
-                  << " at position (" << tiger.x << ", " << tiger.y << ", " << tiger.z << ")"
-                  << " with rotation " << tiger.rotY << " degrees" << std::endl;
+        // 패킷 처리는 시뮬레이션 스레드에서 (여기서는 고정 크기 명령으로 만들어 큐에 넣기만 함)
+        // 링 구간은 이 콜백이 끝나면 덮어써지므로 스레드 간 전달에만 한 번 복사
+        int packetSize = header.size;
+        if (packetSize <= MAX_COMMAND_SIZE) {
+            InboundCommand cmd;
+            cmd.type = InboundCommand::PACKET;
+            cmd.size = static_cast<uint16_t>(packetSize);
+            cmd.clientID = clientID;
+            cmd.error = 0;
+            memcpy(cmd.data, data + processedBytes, packetSize);
+            m_commandQueue.Push(cmd);
+        } else {
+            std::cout << "[Error] Packet too large for command queue - Size: " << packetSize
+                      << ", Type: " << header.type << ", Client: " << clientID << std::endl;
+        }
+        processedBytes += packetSize;
     }
-    
-    std::cout << "[InitializeTigers] Completed. Total tigers created: " << m_tigers.size() << std::endl;
-    std::cout << "[InitializeTigers] Note: Tiger spawn packets will be sent when clients log in" << std::endl;
+    return processedBytes;
 }
 
-void GameServer::InitializeTrees() {
-    std::cout << "\n[InitializeTrees] Starting tree position initialization..." << std::endl;
-    
-    // 플레이어 주변에 3개의 나무를 고정된 위치에 생성
-    const int TREE_COUNT = 3;
+void GameServer::ProcessSinglePacket(char* buffer, int clientID, int packetSize) {
+    PacketHeader header = ReadPacketHeader(buffer);
     
-    // 고정된 나무 위치들
-    std::vector<std::tuple<float, float, float>> treePositions = {
-        {500.0f + 100.0f, 0.0f, 500.0f + 50.0f},   // 우측 앞
-        {500.0f - 80.0f, 0.0f, 500.0f + 120.0f},   // 좌측 뒤
-        {500.0f + 60.0f, 0.0f, 500.0f - 90.0f}     // 우측 뒤
-    };
+    std::cout << "\n[Receive] From client " << clientID << std::endl;
+    std::cout << "  -> Packet type: " << header.type << std::endl;
+    std::cout << "  -> Packet size: " << header.size << std::endl;
+
+    // 타입 번호로 핸들러 테이블을 바로 찾아 호출 (크기 검사는 스키마 테이블)
+    switch (PacketDispatcher<GameServer, int>::Dispatch(*this, buffer, packetSize, clientID)) {
+        case PacketDispatcher<GameServer, int>::UNKNOWN_TYPE:
+            std::cout << "  -> Unknown packet type" << std::endl;
+            break;
+        case PacketDispatcher<GameServer, int>::INVALID_SIZE:
+            std::cout << "[Error] Invalid " << GetPacketName(header.type) << " packet size" << std::endl;
+            break;
+        default:
+            break;
+    }
+}
+
+template<typename T>
+void GameServer::OnPacket(PacketView<T> /*pkt*/, int /*clientID*/) {
+    std::cout << "  -> Unhandled packet type: " << GetPacketName(PacketTypeOf<T>::VALUE) << std::endl;
+}
+
+void GameServer::OnPacket(PacketView<PacketLoginRequest> pkt, int clientID) {
+    std::string username(pkt.GetString(&PacketLoginRequest::username));
     
-    std::vector<float> fixedRotations = {45.0f, 180.0f, 270.0f};  // 고정된 회전값
+    // 사용자명 중복 체크
+    bool usernameExists = false;
+    m_clients.ForEach([&](int id, const ClientInfo& client) {
+        if (client.isLoggedIn && m_clients.FindCold(id)->username == username) {
+            usernameExists = true;
+        }
+    });
     
-    for (int i = 0; i < TREE_COUNT; ++i) {
-        TreeInfo tree;
-        tree.treeID = m_nextTreeID++;
+    PacketLoginResponse response = MakePacket<PacketLoginResponse>();
+    response.clientID = clientID;
+    
+    if (usernameExists) {
+        response.success = false;
+        strncpy_s(response.message, "Username already exists", sizeof(response.message) - 1);
+        std::cout << "[Login] Failed for client " << clientID << " - Username already exists: " << username << std::endl;
+    } else if (JoinRoom(clientID) < 0) {
+        response.success = false;
+        strncpy_s(response.message, "Server is full", sizeof(response.message) - 1);
+        std::cout << "[Login] Failed for client " << clientID << " - No room available (" << m_openRooms.size() << " rooms open)" << std::endl;
+    } else {
+        response.success = true;
+        strncpy_s(response.message, "Login successful", sizeof(response.message) - 1);
+        if (m_udpSocket != INVALID_SOCKET) {
+            ClientInfo* client = m_clients.Find(clientID);
+            if (client->udpToken == 0) {
+                client->udpToken = m_randomEngine() | 1;   // 0이 아닌 임의 값 (다른 세션의 데이터그램 차단)
+            }
+            response.udpPort = static_cast<unsigned short>(m_port);
+            response.udpToken = client->udpToken;
+        }
+        
+        // 클라이언트 정보 업데이트
+        m_clients.FindCold(clientID)->username = username;
+        m_clients.FindCold(clientID)->snapshotBudget = m_snapshotBudget;
+        m_clients.Find(clientID)->isLoggedIn = true;
+        
+        const GameRoom& room = *FindRoom(*m_clients.Find(clientID));
+        std::cout << "[Login] Success for client " << clientID << " - Username: " << username << ", room " << room.ID()
+                  << " (" << room.Members().size() << "/" << GameRoom::CAPACITY << ")" << std::endl;
+        
+        // 로그인 성공 후 플레이어 스폰 패킷 전송 (본인에게만, 다른 플레이어에게는 관심 영역에 들어올 때 전송)
+        PacketPlayerSpawn spawnPacket = MakePacket<PacketPlayerSpawn>();
+        spawnPacket.playerID = clientID;
+        strncpy_s(spawnPacket.username, username.c_str(), sizeof(spawnPacket.username) - 1);
         
-        // 고정된 위치에 배치
-        tree.x = std::get<0>(treePositions[i]);
-        tree.y = std::get<1>(treePositions[i]);
-        tree.z = std::get<2>(treePositions[i]);
-        tree.rotY = fixedRotations[i];  // 고정된 회전값 사용
-        tree.treeType = 0; // long_tree
+        SendPacket(*m_clients.Find(clientID), &spawnPacket, sizeof(spawnPacket));
         
-        m_trees[tree.treeID] = tree;
+        // 로그인 성공 후 클라이언트 준비 완료 신호를 기다림
+        std::cout << "[Login] Waiting for client " << clientID << " to send ready signal" << std::endl;
         
-        std::cout << "[Tree] Created tree ID: " << tree.treeID 
-                  << " at position (" << tree.x << ", " << tree.y << ", " << tree.z << ")"
-                  << " with rotation " << tree.rotY << " degrees" << std::endl;
+        // 호랑이/다른 플레이어는 ready 신호 이후 관심 영역 갱신에서 전송
     }
     
-    std::cout << "[InitializeTrees] Completed. Total tree positions created: " << m_trees.size() << std::endl;
-    std::cout << "[InitializeTrees] Note: Tree positions will be sent when clients log in" << std::endl;
+    SendPacket(*m_clients.Find(clientID), &response, sizeof(response));
 }
 
-void GameServer::UpdateTigerBehavior(TigerInfo& tiger, float deltaTime) {
-    const float CHASE_RADIUS = 200.0f;
-    const float ATTACK_RADIUS = 17.0f;
-    const float MOVE_SPEED = 30.0f;
-    
-    tiger.moveTimer -= deltaTime;
-    tiger.animationTime += deltaTime;
-    tiger.attackTime += deltaTime;
-    tiger.searchTime += deltaTime;
-    tiger.elapseTime += deltaTime;
+void GameServer::OnPacket(PacketView<PacketPlayerDisconnect> pkt, int clientID) {
+    std::cout << "[Disconnect] Player " << pkt.GetString(&PacketPlayerDisconnect::username)
+              << " (ID: " << pkt.Get(&PacketPlayerDisconnect::playerID) << ") disconnected" << std::endl;
     
-    // 가장 가까운 플레이어 찾기
-    float nearestDist = FLT_MAX;
-    float targetX = tiger.x, targetZ = tiger.z;
-    for (const auto& [id, client] : m_clients) {
-        if (!client.isLoggedIn) continue;
-        
-        float dx = client.lastUpdate.x - tiger.x;
-        float dz = client.lastUpdate.z - tiger.z;
-        float distSq = dx * dx + dz * dz;
-        if (distSq < nearestDist) {
-            nearestDist = distSq;
-            targetX = client.lastUpdate.x;
-            targetZ = client.lastUpdate.z;
-        }
+    // 클라이언트 제거 (다른 클라이언트들에게 연결 해제 알림 포함)
+    if (m_clients.Contains(clientID)) {
+        RemoveClient(clientID, 0);
+        std::cout << "[Disconnect] Client " << clientID << " removed. Remaining clients: " << m_clients.Count() << std::endl;
+    } else {
+        std::cout << "[Disconnect] Client " << clientID << " not found in client list" << std::endl;
+    }
+}
+
+void GameServer::OnPacket(PacketView<PacketPlayerUpdate> pkt, int clientID) {
+    // 클라이언트 존재 여부 확인
+    ClientInfo* client = m_clients.Find(clientID);
+    if (!client) {
+        std::cout << "[Error] Client " << clientID << " not found for PLAYER_UPDATE" << std::endl;
+        return;
     }
     
-    float dist = sqrt(nearestDist);
+    // 연결 상태 확인
+    if (!IsConnected(*client)) {
+        std::cout << "[Error] Invalid socket for client " << clientID << " in PLAYER_UPDATE" << std::endl;
+        return;
+    }
     
-    if (dist < CHASE_RADIUS) {
-        tiger.isChasing = true;
-        
-        if (dist < ATTACK_RADIUS) {
-            // 공격 상태 (원본과 동일한 조건)
-            if (tiger.attackTime >= 2.0f) {
-                if (tiger.currentAnimation != "0208_tiger_attack.fbx") {
-                    tiger.currentAnimation = "0208_tiger_attack.fbx";
-                    tiger.animationTime = 0.0f;  // 애니메이션 변경 시 시간 리셋
-                    tiger.elapseTime = 0.0f;     // 애니메이션 경과 시간 리셋
-                    tiger.isFired = false;       // 공격 발사 상태 리셋
-                }
-                tiger.attackTime = 0.0f;  // 공격 후 타이머 리셋
-            }
-            
-            // 공격 애니메이션 중일 때 공격 발사
-            if (tiger.currentAnimation == "0208_tiger_attack.fbx") {
-                if (tiger.elapseTime >= 0.4f && !tiger.isFired) {
-                    tiger.isFired = true;
-                    // 여기서 공격 패킷을 클라이언트에 전송할 수 있음
-                }
-            }
-        } else {
-            // 달리기 상태 (원본과 동일한 조건)
-            if (tiger.attackTime >= 2.0f) {
-                if (tiger.currentAnimation != "0722_tiger_run.fbx") {
-                    tiger.currentAnimation = "0722_tiger_run.fbx";
-                    tiger.animationTime = 0.0f;  // 애니메이션 변경 시 시간 리셋
-                }
-                
-                // 플레이어 방향으로 이동
-                float dx = targetX - tiger.x;
-                float dz = targetZ - tiger.z;
-                float moveDist = sqrt(dx * dx + dz * dz);
-                if (moveDist > 0.1f) {
-                    tiger.x += (dx / moveDist) * MOVE_SPEED * deltaTime;
-                    tiger.z += (dz / moveDist) * MOVE_SPEED * deltaTime;
-                    tiger.rotY = atan2(dx, dz) * (180.0f / 3.141592f);
-                }
-            }
-        }
-    } else {
-        // 탐색 상태 (원본과 동일)
-        tiger.isChasing = false;
-        
-        if (tiger.searchTime > 2.0f) {
-            tiger.searchTime = 0.0f;
-            // 새로운 랜덤 방향 설정
-            float angle = GetRandomFloat(0.0f, 360.0f) * (3.141592f / 180.0f);
-            tiger.targetX = tiger.x + cos(angle) * GetRandomFloat(40.0f, 120.0f);
-            tiger.targetZ = tiger.z + sin(angle) * GetRandomFloat(40.0f, 120.0f);
-        }
-        
-        // 목표 지점으로 이동
-        float dx = tiger.targetX - tiger.x;
-        float dz = tiger.targetZ - tiger.z;
-        float moveDist = sqrt(dx * dx + dz * dz);
-        if (moveDist > 0.1f) {
-            tiger.x += (dx / moveDist) * MOVE_SPEED * 0.7f * deltaTime;
-            tiger.z += (dz / moveDist) * MOVE_SPEED * 0.7f * deltaTime;
-            tiger.rotY = atan2(dx, dz) * (180.0f / 3.141592f);
-            if (tiger.currentAnimation != "0113_tiger_walk.fbx") {
-                tiger.currentAnimation = "0113_tiger_walk.fbx";
-                tiger.animationTime = 0.0f;  // 애니메이션 변경 시 시간 리셋
-            }
-        } else {
-            if (tiger.currentAnimation != "0722_tiger_idle2.fbx") {
-                tiger.currentAnimation = "0722_tiger_idle2.fbx";
-                tiger.animationTime = 0.0f;  // 애니메이션 변경 시 시간 리셋
-            }
-        }
+    // 호랑이 AI가 읽는 마지막 상태로 저장 (보낸 쪽 ID는 서버가 정함)
+    client->lastUpdate = pkt.Copy();
+    client->lastUpdate.clientID = clientID;
+    if (!IsValidAnimationClip(client->lastUpdate.animationClip)) {
+        client->lastUpdate.animationClip = ANIM_CLIP_NONE;  // 테이블에 없는 클립은 그대로 중계하지 않음
     }
+    const PacketPlayerUpdate& update = client->lastUpdate;
+    
+    // 애니메이션 정보 로그 (디버깅용)
+    std::cout << "[PlayerUpdate] Client " << clientID << " at (" << update.x << ", " << update.y << ", " << update.z 
+              << ") animation: " << GetAnimationClipName(update.animationClip) << " time: " << update.animationTime << std::endl;
+    
+    SendToObservers(clientID, &update, sizeof(PacketPlayerUpdate));
 }
 
-void GameServer::UpdateTigers(float deltaTime) {
-    m_tigerUpdateTimer += deltaTime;
-    if (m_tigerUpdateTimer < 0.1f) return; // 100ms마다 업데이트 (성능 개선)
+void GameServer::OnPacket(PacketView<PacketPlayerSpawn> pkt, int clientID) {
+    ClientInfo* client = m_clients.Find(clientID);
+    if (GameRoom* room = client ? FindRoom(*client) : nullptr) {
+        BroadcastPacket(*room, pkt.Data(), sizeof(PacketPlayerSpawn), clientID);
+    }
+}
 
-    for (auto& tigerPair : m_tigers) {
-        auto& tiger = tigerPair.second;
-        UpdateTigerBehavior(tiger, 0.1f); // 고정된 시간 간격 사용
+void GameServer::OnPacket(PacketView<PacketTigerSpawn> pkt, int clientID) {
+    ClientInfo* client = m_clients.Find(clientID);
+    if (GameRoom* room = client ? FindRoom(*client) : nullptr) {
+        BroadcastPacket(*room, pkt.Data(), sizeof(PacketTigerSpawn));
     }
+}
 
-    BroadcastTigerUpdates();
-    m_tigerUpdateTimer = 0.0f;
+void GameServer::OnPacket(PacketView<PacketTigerUpdate> pkt, int clientID) {
+    ClientInfo* client = m_clients.Find(clientID);
+    if (GameRoom* room = client ? FindRoom(*client) : nullptr) {
+        BroadcastPacket(*room, pkt.Data(), sizeof(PacketTigerUpdate));
+    }
 }
 
-void GameServer::BroadcastTigerUpdates() {
-    // 로그인된 클라이언트가 없으면 업데이트 전송하지 않음
-    int loggedInCount = 0;
-    for (const auto& clientPair : m_clients) {
-        const auto& client = clientPair.second;
-        if (client.isLoggedIn && client.socket != INVALID_SOCKET) {
-            loggedInCount++;
-        }
+void GameServer::OnPacket(PacketView<PacketSnapshotAck> pkt, int clientID) {
+    ClientInfo* client = m_clients.Find(clientID);
+    if (!client) return;
+
+    // 0 = 클라이언트가 복원에 실패 -> 다음 틱에 전체 상태
+    // 그 외에는 더 최신 ack만 반영 (순서가 뒤바뀐 ack는 무시, 유실된 ack는 이전 기준점을 계속 사용)
+    uint32_t tick = pkt.Get(&PacketSnapshotAck::tick);
+    if (tick == 0) {
+        client->ackedSnapshotTick = 0;
+    } else if (tick > client->ackedSnapshotTick) {
+        client->ackedSnapshotTick = tick;
     }
+}
+
+void GameServer::OnPacket(PacketView<PacketClientReady> pkt, int clientID) {
+    std::cout << "[ClientReady] Client " << clientID << " is ready to receive game data" << std::endl;
     
-    if (loggedInCount == 0) {
+    // 클라이언트 소켓 상태 재확인
+    ClientInfo* client = m_clients.Find(clientID);
+    if (!client || !IsConnected(*client)) {
+        std::cout << "[Error] Client " << clientID << " socket is invalid, cannot send game data" << std::endl;
         return;
     }
     
-    // 호랑이 업데이트 전송 (매번 전송)
-    // static int updateCounter = 0;
-    // updateCounter++;
+    ClientColdInfo* cold = m_clients.FindCold(clientID);
+    if (!cold) return;
     
-    // 매번 업데이트 전송 (더 부드러운 움직임)
-    // if (updateCounter % 2 != 0) {
-    //     return;
-    // }
+    // 아직 위치를 받지 않았으면 준비 패킷의 위치로 시작 (호랑이 AI와 관심 영역이 바로 사용)
+    if (!HasPosition(*client)) {
+        PacketPlayerUpdate& update = client->lastUpdate;
+        update = MakePacket<PacketPlayerUpdate>();
+        update.clientID = clientID;
+        update.x = pkt.Get(&PacketClientReady::x);
+        update.z = pkt.Get(&PacketClientReady::z);
+        update.animationClip = ANIM_CLIP_NONE;
+    }
     
-    for (const auto& tigerPair : m_tigers) {
-        const auto& tiger = tigerPair.second;
-        PacketTigerUpdate updatePacket;
-        updatePacket.header.type = PACKET_TIGER_UPDATE;
-        updatePacket.header.size = sizeof(PacketTigerUpdate);
-        updatePacket.tigerID = tiger.tigerID;
-        updatePacket.x = tiger.x;
-        updatePacket.y = tiger.y;
-        updatePacket.z = tiger.z;
-        updatePacket.rotY = tiger.rotY;
-        
-        // 애니메이션 정보 추가
-        strcpy_s(updatePacket.animationFile, sizeof(updatePacket.animationFile), tiger.currentAnimation.c_str());
-        updatePacket.animationTime = tiger.animationTime;
-        
-        BroadcastPacket(&updatePacket, sizeof(updatePacket));
+    // 나무/주변 호랑이/주변 플레이어를 패킷 하나로 - 이후 변화는 관심 영역(AOI) 갱신과 스냅샷이 이어서 전송
+    client->isReady = true;
+    SendWorldBootstrap(clientID, *client, *cold);
+}
+
+void GameServer::Cleanup() {
+    m_isRunning = false;
+
+    m_clients.ForEach([this](int id, ClientInfo& client) {
+        if (client.socket == INVALID_SOCKET) return;
+        if (m_io) {
+            m_io->RemoveClient(client.socket, id);   // 소켓은 백엔드가 닫음
+        } else {
+            closesocket(client.socket);
+        }
+        client.socket = INVALID_SOCKET;
+    });
+
+    if (m_listenSocket != INVALID_SOCKET) {
+        closesocket(m_listenSocket);
+        m_listenSocket = INVALID_SOCKET;
+    }
+
+    if (m_udpThread.joinable()) {
+        m_udpThread.join();
+    }
+    if (m_udpSocket != INVALID_SOCKET) {
+        closesocket(m_udpSocket);
+        m_udpSocket = INVALID_SOCKET;
+    }
+
+    for (std::thread& thread : m_workerThreads) {
+        if (thread.joinable()) {
+            thread.join();
+        }
     }
+    m_workerThreads.clear();
+
+    if (m_simThread.joinable()) {
+        m_simThread.join();
+    }
+
+    if (m_io) {
+        m_io->Shutdown();
+    }
+
+#ifdef _WIN32
+    WSACleanup();
+#endif
 }
 
-void GameServer::SendTreePositions(int clientID) {
-    std::cout << "[Tree] Starting to send tree positions to client " << clientID << std::endl;
-    std::cout << "[Tree] Total trees to send: " << m_trees.size() << std::endl;
+// [Broadcast] 관련 반복 로그 주석 처리
+void GameServer::BroadcastPacket(const GameRoom& room, const void* packet, int size, int excludeID) {
+    // 한 번만 복사해 두고 방의 모든 세션이 같은 버퍼를 참조
+    BroadcastRef buffer = BroadcastBuffer::Create();
+    buffer->Append(packet, size);
+    BroadcastShared(room, buffer, excludeID);
+}
+
+void GameServer::BroadcastShared(const GameRoom& room, const BroadcastRef& buffer, int excludeID) {
+    // 다른 방의 세션은 이 방의 엔티티를 모르므로 같은 방 멤버에게만
+    for (int id : room.Members()) {
+        ClientInfo* client = m_clients.Find(id);
+        if (!client || !client->isLoggedIn || !IsConnected(*client) || id == excludeID)
+            continue;
+            
+        if (!SendPacket(*client, buffer)) {
+            std::cout << "[Broadcast] Failed to send packet to client " << id << std::endl;
+        }
+    }
+}
+
+void GameServer::SendToObservers(int playerID, const void* packet, int size) {
+    // 이 플레이어를 가시 집합에 가진 클라이언트에게만 전송
+    // (격자는 틱마다 갱신되므로 한 틱 동안 움직일 수 있는 거리만큼 여유를 두고 후보를 찾음)
+    ClientInfo* sender = m_clients.Find(playerID);
+    GameRoom* room = sender ? FindRoom(*sender) : nullptr;
+    if (!room || !HasPosition(*sender)) return;
+
+    const uint64_t key = AoiGrid::MakeKey(ENTITY_TYPE_PLAYER, playerID);
+    BroadcastRef buffer;
+    room->InterestGrid().Query(sender->lastUpdate.x, sender->lastUpdate.z, AOI_LEAVE_RADIUS + AoiGrid::CELL_SIZE, [&](uint64_t observerKey, float) {
+        if (AoiGrid::KeyType(observerKey) != ENTITY_TYPE_PLAYER || observerKey == key) return;
+        int observerID = AoiGrid::KeyID(observerKey);
+        ClientInfo* observer = m_clients.Find(observerID);
+        ClientColdInfo* observerCold = m_clients.FindCold(observerID);
+        if (!observer || !observerCold || !IsConnected(*observer)) return;
+        if (!std::binary_search(observerCold->visible.begin(), observerCold->visible.end(), key)) return;
+
+        if (observer->udpBound) {
+            SendUnreliable(observerID, *observer, packet, size);
+            return;
+        }
+        if (!buffer) {
+            buffer = BroadcastBuffer::Create();   // TCP로 받는 쪽이 있을 때만 한 번 복사
+            buffer->Append(packet, size);
+        }
+        if (!SendPacket(*observer, buffer)) {
+            std::cout << "[Broadcast] Failed to send packet to client " << observerID << std::endl;
+        }
+    });
+}
+
+void GameServer::ProcessNewClient(SOCKET clientSocket) {
+    std::cout << "[Info] ProcessNewClient" << std::endl;
+    
+    ClientInfo newClient;
+    newClient.socket = clientSocket;
+    newClient.isLoggedIn = false;
+    newClient.lastUpdate = {};
     
-    // 클라이언트 소켓 상태 확인
-    if (m_clients[clientID].socket == INVALID_SOCKET) {
-        std::cout << "[Tree] Client socket is invalid" << std::endl;
+    // 1. 세션 테이블에 추가 (수신 완료가 먼저 도착해도 찾을 수 있도록)
+    //    반환된 핸들(세대 포함)이 clientID 이자 I/O 백엔드의 completion key
+    int clientID = m_clients.Allocate(newClient);
+    if (clientID == 0) {
+        std::cout << "[Error] Session table is full, rejecting client" << std::endl;
+        closesocket(clientSocket);
         return;
     }
     
-    // 모든 나무 위치 정보를 하나의 패킷으로 묶어서 전송
-    PacketTreeSpawn treePacket;
-    treePacket.header.type = PACKET_TREE_SPAWN;
-    treePacket.header.size = sizeof(PacketTreeSpawn);
-    treePacket.treeCount = 0;
+    // 2. I/O 백엔드 등록 및 수신 시작
+    //    이후 소켓은 백엔드 소유 (실패해도 백엔드가 닫음)
+    if (!m_io->AddClient(clientSocket, clientID)) {
+        m_clients.Free(clientID);   // accept 스레드에서의 해제 - 슬롯 재사용은 QUARANTINE 이후 (SessionTable.h)
+        return;
+    }
+    std::cout << "[ProcessNewClient] " << clientID << " added to session table. Total clients: " << m_clients.Count() << std::endl;
     
-    for (const auto& [treeID, tree] : m_trees) {
-        if (treePacket.treeCount >= 3) break; // 최대 3개까지만 (안정성을 위해)
-        
-        treePacket.trees[treePacket.treeCount].x = tree.x;
-        treePacket.trees[treePacket.treeCount].y = tree.y;
-        treePacket.trees[treePacket.treeCount].z = tree.z;
-        treePacket.trees[treePacket.treeCount].rotY = tree.rotY;
-        treePacket.trees[treePacket.treeCount].treeType = tree.treeType;
-        treePacket.treeCount++;
+    // 3. 로그인 대기 상태로 설정 (호랑이 스폰 패킷은 로그인 성공 후에 전송)
+    std::cout << "[ProcessNewClient] Client " << clientID << " waiting for login..." << std::endl;
+}
+
+bool GameServer::SendPacket(ClientInfo& client, const void* packet, int size) {
+    if (!client.reliable && client.socket == INVALID_SOCKET) return false;
+    if (client.streamBroken) return false;   // 이후 압축 패킷은 클라이언트가 풀 수 없음 - 연결 종료 대기
+    
+    // 큰 패킷은 세션 스트림 사전으로 압축 (TCP / 신뢰 채널 모두 순서가 보장되므로 클라이언트 사전과 어긋나지 않음)
+    bool compressedPacket = false;
+    if (size >= PACKET_COMPRESS_THRESHOLD) {
+        if (!client.compressor) {
+            client.compressor = std::make_shared<LzStreamEncoder>();
+        }
+        auto start = std::chrono::steady_clock::now();
+        int compressed = CompressPacket(*client.compressor, packet, size, m_compressScratch);
+        if (compressed > 0) {
+            m_compressStats.packets++;
+            m_compressStats.rawBytes += size;
+            m_compressStats.compressedBytes += compressed;
+            m_compressStats.elapsedUs += std::chrono::duration<float, std::micro>(std::chrono::steady_clock::now() - start).count();
+            packet = m_compressScratch.data();
+            size = compressed;
+            compressedPacket = true;
+        }
     }
     
-    if (!SendPacket(m_clients[clientID].socket, &treePacket, sizeof(PacketTreeSpawn))) {
-        std::cout << "[Tree] Failed to send tree positions packet" << std::endl;
-        return;
+    // 신뢰 채널 대기열, 또는 블로킹 없이 세션 송신 대기열에 추가 (실제 쓰기는 틱 끝의 Flush에서 소켓당 한 번)
+    bool sent = client.reliable ? SendReliable(client, packet, size)
+                                : CheckSendResult(client, m_io->Send(client.socket, packet, size));
+    if (!sent && compressedPacket) {
+        // 인코더 사전은 이미 이 패킷만큼 나아갔으므로 클라이언트 디코더와 어긋남 - 버리고 이어 보낼 수 없음
+        client.streamBroken = true;
     }
+    return sent;
+}
+
+bool GameServer::SendPacket(ClientInfo& client, const BroadcastRef& buffer) {
+    if (client.reliable) {
+        return SendReliable(client, buffer->Data(), buffer->Size());
+    }
+    if (client.socket == INVALID_SOCKET) return false;
     
-    std::cout << "[Tree] Successfully sent " << treePacket.treeCount << " tree positions to client " << clientID << std::endl;
+    // 공유 버퍼는 복사하지 않고 참조만 대기열에 추가 (세션마다 사전이 달라 압축하지 않음 - 작은 알림 패킷용)
+    return CheckSendResult(client, m_io->SendShared(client.socket, buffer));
+}
+
+bool GameServer::SendReliable(ClientInfo& client, const void* packet, int size) {
+    // UDP 전용 세션 - 신뢰 채널 대기열에 추가 (전송/재전송은 틱 끝의 FlushDatagrams)
+    if (!client.reliable->Send(packet, size)) {
+        return false;
+    }
+    if (client.reliable->GetPendingCount() > RELIABLE_HIGH_WATER) {
+        client.sendBackpressure = true;   // ack가 따라오지 못함 - TCP 송신 대기열과 같은 규칙으로 정리
+    }
+    return true;
 }
 
-float GameServer::GetRandomFloat(float min, float max) {
-    std::uniform_real_distribution<float> dist(min, max);
-    return dist(m_randomEngine);
+bool GameServer::CheckSendResult(ClientInfo& client, IOBackend::SendResult result) {
+    if (result == IOBackend::SEND_BACKPRESSURE) {
+        client.sendBackpressure = true;
+    }
+    return result != IOBackend::SEND_FAILED;
 }
 
-bool GameServer::IsPlayerNearby(const TigerInfo& tiger, float radius) {
-    for (const auto& [id, client] : m_clients) {
-        float dx = client.lastUpdate.x - tiger.x;
-        float dz = client.lastUpdate.z - tiger.z;
-        float distSq = dx * dx + dz * dz;
-        if (distSq < radius * radius) {
-            return true;
+void GameServer::UpdateSendBackpressure() {
+    // 송신 대기열이 계속 high-water를 넘는 클라이언트는 따라오지 못하는 것으로 보고 연결 종료
+    // (느린 클라이언트 하나 때문에 서버 메모리가 계속 늘어나지 않도록)
+    // 압축 패킷을 보내지 못한 클라이언트는 바로 연결 종료 (SendPacket)
+    const int maxTicks = m_tickRate * SLOW_CLIENT_TIMEOUT_SEC;
+    std::vector<int> slowClients;
+    std::vector<int> brokenClients;
+    m_clients.ForEach([&](int id, ClientInfo& client) {
+        if (client.streamBroken) {
+            brokenClients.push_back(id);   // 압축 패킷 송신 실패 - 기다려도 회복되지 않음
+            return;
+        }
+        if (!client.sendBackpressure) {
+            client.backpressureTicks = 0;
+            return;
+        }
+        client.sendBackpressure = false;
+        if (++client.backpressureTicks == 1) {
+            std::cout << "[Backpressure] Client " << id << " send queue above high-water mark" << std::endl;
         }
+        if (client.backpressureTicks >= maxTicks) {
+            slowClients.push_back(id);
+        }
+    });
+
+    for (int id : slowClients) {
+        std::cout << "[Backpressure] Client " << id << " too slow, disconnecting" << std::endl;
+        RemoveClient(id, WSAEWOULDBLOCK);
+    }
+    for (int id : brokenClients) {
+        std::cout << "[Compress] Client " << id << " lost a compressed packet, disconnecting" << std::endl;
+        RemoveClient(id, WSAECONNABORTED);
     }
-    return false;
 }
 
-void GameServer::GetNearestPlayerPosition(const TigerInfo& tiger, float& targetX, float& targetZ) {
-    float nearestDist = FLT_MAX;
-    targetX = tiger.x;
-    targetZ = tiger.z;
-    
-    for (const auto& [id, client] : m_clients) {
-        if (!client.isLoggedIn) continue;
-        
-        float dx = client.lastUpdate.x - tiger.x;
-        float dz = client.lastUpdate.z - tiger.z;
-        float distSq = dx * dx + dz * dz;
-        if (distSq < nearestDist) {
-            nearestDist = distSq;
-            targetX = client.lastUpdate.x;
-            targetZ = client.lastUpdate.z;
+int GameServer::JoinRoom(int clientID) {
+    // 빈자리가 있는 방 먼저 (2인 세션이 채워지도록), 없으면 풀에서 꺼내거나 새로 만듦
+    int slot = -1;
+    for (int open : m_openRooms) {
+        if (!m_rooms[open]->IsFull()) {
+            slot = open;
+            break;
         }
     }
+    if (slot < 0) {
+        if (!m_freeRooms.empty()) {
+            slot = m_freeRooms.back();
+            m_freeRooms.pop_back();
+        } else if (static_cast<int>(m_rooms.size()) < MAX_ROOMS) {
+            slot = static_cast<int>(m_rooms.size());
+            m_rooms.push_back(std::make_unique<GameRoom>());
+            m_roomSimUs.push_back(0.0f);
+        } else {
+            return -1;
+        }
+        m_rooms[slot]->Open(m_nextRoomID++, m_randomEngine());
+        m_openRooms.insert(std::lower_bound(m_openRooms.begin(), m_openRooms.end(), slot), slot);
+        m_roomsChanged = true;
+    }
+
+    m_rooms[slot]->AddMember(clientID);
+    m_clients.Find(clientID)->room = slot;
+    return slot;
+}
+
+bool GameServer::LeaveRoom(int clientID) {
+    ClientInfo* client = m_clients.Find(clientID);
+    if (!client || client->room < 0) return false;
+    const int slot = client->room;
+    client->room = -1;
+
+    GameRoom& room = *m_rooms[slot];
+    room.RemoveMember(clientID);
+    if (!room.Members().empty()) return false;
+
+    // 마지막 멤버가 나감 - 월드를 비우고 풀로 (배열 용량은 유지)
+    room.Close();
+    m_openRooms.erase(std::lower_bound(m_openRooms.begin(), m_openRooms.end(), slot));
+    m_freeRooms.push_back(slot);
+    m_roomsChanged = true;
+    return true;
 }
 
+void GameServer::UpdateRooms(float deltaTime) {
+    // 시뮬레이션 스레드에서 틱마다 한 번 호출됨 (deltaTime = 1 / 틱레이트)
+    // 1. 방마다 이번 틱 멤버 상태 (이번 틱 명령까지 반영된 위치)
+    for (int slot : m_openRooms) {
+        GameRoom& room = *m_rooms[slot];
+        std::vector<GameRoom::Player>& players = room.Players();
+        players.clear();
+        for (int id : room.Members()) {
+            ClientInfo* client = m_clients.Find(id);
+            ClientColdInfo* cold = m_clients.FindCold(id);
+            if (!client || !cold || !client->isLoggedIn) continue;
+            players.push_back({ id, client->lastUpdate.x, client->lastUpdate.z, HasPosition(*client),
+                                client->isReady && IsConnected(*client), &cold->visible });
+        }
+    }
+
+    // 2. 방이 바뀌었거나 약 1초마다 워커 묶음을 다시 나눔
+    if (m_roomsChanged || m_tickStats.tickCount - m_lastRebalanceTick >= static_cast<uint64_t>(m_tickRate)) {
+        RebalanceRooms();
+    }
+
+    // 3. 묶음 하나 = 잡 하나 (먼저 끝난 워커는 남은 묶음이나 큰 방 안의 잡을 훔쳐 감)
+    //    방끼리는 공유하는 상태가 없으므로 워커 수와 실행 순서에 상관없이 같은 결과
+    m_jobs->ParallelFor(static_cast<int>(m_roomBuckets.size()), 1, [&](int begin, int end) {
+        for (int bucket = begin; bucket < end; ++bucket) {
+            for (int slot : m_roomBuckets[bucket]) {
+                auto start = std::chrono::steady_clock::now();
+                m_rooms[slot]->Simulate(deltaTime, *m_jobs);
+                m_roomSimUs[slot] = std::chrono::duration<float, std::micro>(std::chrono::steady_clock::now() - start).count();
+            }
+        }
+    });
 
+    // 4. 전송은 방 순서대로 (송신 경로는 시뮬레이션 스레드 전용)
+    const uint32_t tick = static_cast<uint32_t>(m_tickStats.tickCount + 1);  // 0은 "기준점 없음"으로 예약
+    for (int slot : m_openRooms) {
+        GameRoom& room = *m_rooms[slot];
+        auto start = std::chrono::steady_clock::now();
+        SendInterestChanges(room);
+        BroadcastTigerUpdates(room, tick);
+        room.RecordTickCost(m_roomSimUs[slot] + std::chrono::duration<float, std::micro>(std::chrono::steady_clock::now() - start).count());
+    }
+}
+
+void GameServer::RebalanceRooms() {
+    // 추정 비용이 큰 방부터 지금 가장 가벼운 묶음에 넣음 (LPT - 가장 무거운 묶음이 틱 시간을 정함)
+    const int workers = m_jobs->WorkerCount();
+    m_roomBuckets.resize(workers);
+    for (std::vector<int>& bucket : m_roomBuckets) {
+        bucket.clear();
+    }
+    m_bucketLoadUs.assign(workers, 0.0f);
+
+    auto cost = [&](int slot) { return std::max(m_rooms[slot]->CostEstimateUs(), ROOM_MIN_COST_US); };
+    m_rebalanceOrder = m_openRooms;
+    std::sort(m_rebalanceOrder.begin(), m_rebalanceOrder.end(), [&](int a, int b) {
+        float costA = cost(a), costB = cost(b);
+        return costA != costB ? costA > costB : a < b;
+    });
+    for (int slot : m_rebalanceOrder) {
+        int bucket = static_cast<int>(std::min_element(m_bucketLoadUs.begin(), m_bucketLoadUs.end()) - m_bucketLoadUs.begin());
+        m_roomBuckets[bucket].push_back(slot);
+        m_bucketLoadUs[bucket] += cost(slot);
+        m_rooms[slot]->SetWorker(bucket);
+    }
+
+    m_roomsChanged = false;
+    m_lastRebalanceTick = m_tickStats.tickCount;
+}
+
+void GameServer::LogRoomStats() {
+    if (m_openRooms.empty()) return;
+
+    // 방별 틱 비용 (시뮬레이션 + 전송): 전체 분포와 가장 무거운 방
+    int players = 0;
+    float totalUs = 0.0f, maxUs = 0.0f;
+    std::vector<std::pair<float, int>> rooms;   // (평균 us, 칸)
+    for (int slot : m_openRooms) {
+        GameRoom& room = *m_rooms[slot];
+        players += static_cast<int>(room.Members().size());
+        GameRoom::CostWindow window = room.TakeCostWindow();
+        if (window.ticks == 0) continue;
+        float avgUs = window.totalUs / window.ticks;
+        totalUs += avgUs;
+        maxUs = std::max(maxUs, window.maxUs);
+        rooms.push_back({ avgUs, slot });
+    }
+    if (rooms.empty()) return;
+
+    std::cout << "[Room] " << m_openRooms.size() << " open, " << m_freeRooms.size() << " pooled, " << players
+              << " players: per-room tick avg " << totalUs / rooms.size() << " us, worst tick " << maxUs
+              << " us, sum " << totalUs / 1000.0f << " ms/tick" << std::endl;
+
+    std::cout << "[Room] worker loads (estimated):";
+    for (size_t bucket = 0; bucket < m_roomBuckets.size(); ++bucket) {
+        std::cout << " " << m_bucketLoadUs[bucket] << " us/" << m_roomBuckets[bucket].size() << " rooms";
+    }
+    std::cout << std::endl;
+
+    const size_t top = std::min<size_t>(rooms.size(), 5);
+    std::partial_sort(rooms.begin(), rooms.begin() + top, rooms.end(), std::greater<>());
+    for (size_t i = 0; i < top; ++i) {
+        const GameRoom& room = *m_rooms[rooms[i].second];
+        std::cout << "[Room] Room " << room.ID() << ": " << rooms[i].first << " us/tick, " << room.Members().size()
+                  << " players, worker " << room.Worker() << std::endl;
+    }
+}
+
+void GameServer::SendInterestChanges(GameRoom& room) {
+    // 이전 집합과 병합 비교해 진입/이탈만 전송 (멤버 순서대로 - 전송 순서는 워커 수와 무관)
+    const std::vector<GameRoom::Player>& players = room.Players();
+    for (size_t p = 0; p < players.size(); ++p) {
+        if (!players[p].updatesInterest) continue;
+        ClientInfo* client = m_clients.Find(players[p].clientID);
+        ClientColdInfo* cold = m_clients.FindCold(players[p].clientID);
+        if (!client || !cold) continue;
+        std::vector<uint64_t>& visible = cold->visible;
+        std::vector<uint64_t>& next = room.NextVisible(static_cast<int>(p));
+        size_t v = 0, n = 0;
+        while (v < visible.size() || n < next.size()) {
+            if (n == next.size() || (v < visible.size() && visible[v] < next[n])) {
+                SendEntityLeave(*client, visible[v++]);
+            } else if (v == visible.size() || next[n] < visible[v]) {
+                SendEntityEnter(room, *client, next[n++]);
+            } else {
+                ++v;
+                ++n;
+            }
+        }
+        visible.swap(next);
+    }
+}
+
+void GameServer::SendEntityEnter(const GameRoom& room, ClientInfo& client, uint64_t key) {
+    int entityID = AoiGrid::KeyID(key);
+    if (AoiGrid::KeyType(key) == ENTITY_TYPE_TIGER) {
+        const TigerPool& tigers = room.Tigers();
+        int index = tigers.Find(entityID);
+        if (index < 0) return;
+        PacketTigerSpawn spawn = MakePacket<PacketTigerSpawn>();
+        spawn.tigerID = entityID;
+        spawn.x = tigers.x[index];
+        spawn.y = 0.0f;   // 지면
+        spawn.z = tigers.z[index];
+        SendPacket(client, &spawn, sizeof(spawn));
+    } else {
+        ClientColdInfo* other = m_clients.FindCold(entityID);
+        if (!other) return;
+        PacketPlayerSpawn spawn = MakePacket<PacketPlayerSpawn>();
+        spawn.playerID = entityID;
+        strncpy_s(spawn.username, other->username.c_str(), sizeof(spawn.username) - 1);
+        SendPacket(client, &spawn, sizeof(spawn));
+    }
+}
+
+void GameServer::SendEntityLeave(ClientInfo& client, uint64_t key) {
+    // 접속을 끊은 플레이어는 이미 PLAYER_DISCONNECT로 모두에게 알렸으므로 생략
+    if (AoiGrid::KeyType(key) == ENTITY_TYPE_PLAYER && !m_clients.Contains(AoiGrid::KeyID(key))) {
+        return;
+    }
+    PacketEntityLeave leave = MakePacket<PacketEntityLeave>();
+    leave.entityType = AoiGrid::KeyType(key);
+    leave.entityID = AoiGrid::KeyID(key);
+    SendPacket(client, &leave, sizeof(leave));
+}
+
+void GameServer::BroadcastTigerUpdates(GameRoom& room, uint32_t tick) {
+    // 방 멤버마다 관심 영역 안의 호랑이를 우선순위 순으로 예산만큼만 골라,
+    // 마지막 ack 스냅샷 대비 델타를 보냄
+    std::vector<uint8_t>& bits = m_snapshotBits;
+    std::vector<char>& packet = m_snapshotPacket;
+    for (const GameRoom::Player& player : room.Players()) {
+        if (!player.updatesInterest) continue;
+        const int id = player.clientID;
+        ClientInfo* found = m_clients.Find(id);
+        ClientColdInfo* cold = m_clients.FindCold(id);
+        if (!found || !cold) continue;
+        ClientInfo& client = *found;
+
+        const SnapshotEntities* baseline = cold->snapshots.Find(client.ackedSnapshotTick);
+        uint32_t baselineTick = baseline ? client.ackedSnapshotTick : 0;
+        m_snapshotScratch.clear();
+        int usedBytes = BuildBudgetedSnapshot(room, client, *cold, baseline, m_snapshotScratch);
+
+        int count = EncodeSnapshotDelta(baseline, m_snapshotScratch, bits);
+        if (count == 0 && baseline) {
+            continue;   // 바뀐 것이 없으면 보내지 않음 (정지했거나 아무것도 보이지 않으면 0바이트)
+        }
+
+        PacketTigerSnapshot header = MakePacket<PacketTigerSnapshot>();
+        header.header.size = static_cast<unsigned short>(sizeof(PacketTigerSnapshot) + bits.size());
+        header.tick = tick;
+        header.baselineTick = baselineTick;
+        header.count = static_cast<unsigned short>(count);
+        packet.resize(header.header.size);
+        memcpy(packet.data(), &header, sizeof(header));
+        memcpy(packet.data() + sizeof(header), bits.data(), bits.size());
+
+        if (!SendUnreliable(id, client, packet.data(), static_cast<int>(packet.size()))) {
+            std::cout << "[Snapshot] Failed to send snapshot to client " << id << std::endl;
+            continue;
+        }
+        cold->snapshots.Store(tick, m_snapshotScratch);   // 밀려난 슬롯 벡터가 다음 클라이언트의 작업 공간이 됨
+
+        SnapshotBudgetStats& stats = cold->budgetStats;
+        stats.sentBytes += usedBytes;
+        stats.budgetBytes += cold->snapshotBudget;
+        stats.peakBytes = std::max(stats.peakBytes, usedBytes);
+        stats.packets++;
+    }
+}
+
+int GameServer::BuildBudgetedSnapshot(const GameRoom& room, const ClientInfo& client, ClientColdInfo& cold,
+    const SnapshotEntities* baseline, SnapshotEntities& out) {
+    const TigerPool& tigers = room.Tigers();
+    // 1. 보이는 호랑이마다 기준점 대비 바뀐 필드를 구하고, 바뀐 것이 있으면 우선순위를 누적
+    //    (한 번 밀린 호랑이는 우선순위가 계속 쌓이므로 결국 보내짐)
+    m_priorityScratch.clear();
+    m_priorityNext.clear();
+    int usedBits = 0;
+
+    auto first = std::lower_bound(cold.visible.begin(), cold.visible.end(), AoiGrid::MakeKey(ENTITY_TYPE_TIGER, 0));
+    for (auto it = first; it != cold.visible.end() && AoiGrid::KeyType(*it) == ENTITY_TYPE_TIGER; ++it) {
+        uint32_t tigerID = static_cast<uint32_t>(AoiGrid::KeyID(*it));
+        int index = tigers.Find(static_cast<int>(tigerID));   // 풀은 ID 오름차순
+        if (index < 0) continue;
+        const QuantizedEntityState& current = tigers.quantized[index];
+
+        const QuantizedEntityState* base = nullptr;
+        if (baseline) {
+            auto b = std::lower_bound(baseline->begin(), baseline->end(), tigerID,
+                [](const QuantizedEntityState& s, uint32_t id) { return s.entityID < id; });
+            if (b != baseline->end() && b->entityID == tigerID) base = &*b;
+        }
+        uint32_t mask = base ? DiffSnapshotFields(*base, current) : SNAPSHOT_FIELD_ALL;
+        if (mask == 0) {
+            out.push_back(current);   // 바뀐 것이 없으면 0바이트, 우선순위도 초기화
+            continue;
+        }
+
+        float accumulated = 0.0f;
+        auto prev = std::lower_bound(cold.priorities.begin(), cold.priorities.end(), tigerID,
+            [](const EntityPriority& p, uint32_t id) { return p.entityID < id; });
+        if (prev != cold.priorities.end() && prev->entityID == tigerID) accumulated = prev->accumulated;
+
+        float dx = tigers.x[index] - client.lastUpdate.x;
+        float dz = tigers.z[index] - client.lastUpdate.z;
+        float nearness = 1.0f - std::min(std::sqrt(dx * dx + dz * dz) / AOI_LEAVE_RADIUS, 1.0f);
+        float gain = PRIORITY_BASE + PRIORITY_DISTANCE_WEIGHT * nearness + PRIORITY_SPEED_WEIGHT * tigers.speed[index];
+        if (mask & SNAPSHOT_FIELD_CLIP) {
+            gain += (tigers.animation[index] == ANIM_CLIP_TIGER_ATTACK) ? PRIORITY_ATTACK_BONUS : PRIORITY_CLIP_BONUS;
+        }
+        if (!base) {
+            gain += PRIORITY_ATTACK_BONUS;   // 처음 보이는 호랑이는 빨리 전체 상태를 보냄
+        }
+
+        Candidate candidate;
+        candidate.tiger = index;
+        candidate.base = base;
+        candidate.priority = accumulated + gain;
+        candidate.bits = SnapshotEntryBits(mask);
+        m_priorityScratch.push_back(candidate);
+    }
+
+    // 관심 영역에서 빠진 호랑이의 제거 항목은 예산과 관계없이 먼저 씀
+    if (baseline) {
+        for (const QuantizedEntityState& base : *baseline) {
+            if (!std::binary_search(cold.visible.begin(), cold.visible.end(), AoiGrid::MakeKey(ENTITY_TYPE_TIGER, base.entityID))) {
+                usedBits += SnapshotEntryBits(0);
+            }
+        }
+    }
+
+    // 2. 우선순위가 높은 순으로 예산 안에 들어가는 만큼 현재 상태, 나머지는 기준점 상태를 유지
+    std::sort(m_priorityScratch.begin(), m_priorityScratch.end(),
+        [](const Candidate& a, const Candidate& b) { return a.priority > b.priority; });
+    const int budgetBits = (cold.snapshotBudget - static_cast<int>(sizeof(PacketTigerSnapshot))) * 8;
+    for (const Candidate& candidate : m_priorityScratch) {
+        if (usedBits + candidate.bits <= budgetBits) {
+            usedBits += candidate.bits;
+            out.push_back(tigers.quantized[candidate.tiger]);
+            continue;
+        }
+        // 밀림 - 기준점에 있던 호랑이는 그 상태 그대로 (델타 0), 새 호랑이는 다음 틱까지 스냅샷에 넣지 않음
+        if (candidate.base) {
+            out.push_back(*candidate.base);
+        }
+        m_priorityNext.push_back({ static_cast<uint32_t>(tigers.id[candidate.tiger]), candidate.priority });
+        cold.budgetStats.deferred++;
+    }
+
+    std::sort(out.begin(), out.end(),
+        [](const QuantizedEntityState& a, const QuantizedEntityState& b) { return a.entityID < b.entityID; });
+    std::sort(m_priorityNext.begin(), m_priorityNext.end(),
+        [](const EntityPriority& a, const EntityPriority& b) { return a.entityID < b.entityID; });
+    cold.priorities.swap(m_priorityNext);   // 이전 목록은 다음 클라이언트의 작업 공간으로
+    return static_cast<int>(sizeof(PacketTigerSnapshot)) + (usedBits + 7) / 8;
+}
+
+void GameServer::LogSnapshotBudgets() {
+    // 클라이언트마다 출력하지 않고 한 줄로 합침 (방 수천 개면 보고마다 수천 줄이 됨)
+    int clients = 0;
+    int64_t budgetSum = 0;
+    float fillMin = 0.0f, fillMax = 0.0f, fillSum = 0.0f;
+    int peakBytes = 0;
+    uint64_t packets = 0, deferred = 0;
+    m_clients.ForEach([&](int id, const ClientInfo& client) {
+        ClientColdInfo* cold = m_clients.FindCold(id);
+        if (!cold || !client.isReady) return;
+        SnapshotBudgetStats& stats = cold->budgetStats;
+        float fill = stats.budgetBytes > 0 ? static_cast<float>(stats.sentBytes) / stats.budgetBytes * 100.0f : 0.0f;
+        fillMin = clients == 0 ? fill : std::min(fillMin, fill);
+        fillMax = clients == 0 ? fill : std::max(fillMax, fill);
+        fillSum += fill;
+        budgetSum += cold->snapshotBudget;
+        peakBytes = std::max(peakBytes, stats.peakBytes);
+        packets += stats.packets;
+        deferred += stats.deferred;
+        clients++;
+        stats = SnapshotBudgetStats{};
+    });
+    if (clients == 0) return;
+    std::cout << "[Budget] " << clients << " clients: budget avg " << budgetSum / clients << " B/tick, fill min "
+              << fillMin << "% avg " << fillSum / clients << "% max " << fillMax << "%, peak " << peakBytes << " B, "
+              << packets << " snapshots, " << deferred << " deferred updates" << std::endl;
+}
+
+void GameServer::SendWorldBootstrap(int clientID, ClientInfo& client, ClientColdInfo& cold) {
+    GameRoom* room = FindRoom(client);
+    if (!room) return;
+    const TigerPool& tigers = room->Tigers();
+
+    // 관심 영역 안의 엔티티를 가시 집합으로 정함 (격자는 지난 틱 위치, 다음 갱신은 이 집합과 비교)
+    const uint64_t self = AoiGrid::MakeKey(ENTITY_TYPE_PLAYER, clientID);
+    std::vector<uint64_t>& visible = cold.visible;
+    visible.clear();
+    room->InterestGrid().Query(client.lastUpdate.x, client.lastUpdate.z, AOI_ENTER_RADIUS, [&](uint64_t key, float) {
+        if (key != self) {
+            visible.push_back(key);
+        }
+    });
+    std::sort(visible.begin(), visible.end());
+
+    // 헤더 + 미리 만든 나무 구간
+    std::vector<char>& packet = m_bootstrapScratch;
+    const std::vector<uint8_t>& trees = room->TreeBootstrap();
+    packet.resize(sizeof(PacketWorldBootstrap) + trees.size());
+    memcpy(packet.data() + sizeof(PacketWorldBootstrap), trees.data(), trees.size());
+    PacketWorldBootstrap header = MakePacket<PacketWorldBootstrap>();
+    header.treeCount = static_cast<unsigned short>(room->TreeCount());
+
+    // 호랑이 (틱마다 인코딩해 둔 바이트) -> 플레이어 순서. 16비트 크기에 들어가지 않는 엔티티는
+    // 가시 집합에서 빼서 다음 틱 AOI 갱신이 스폰 패킷으로 보내게 함
+    auto appendVisible = [&](uint8_t type, auto&& append) {
+        visible.erase(std::remove_if(visible.begin(), visible.end(), [&](uint64_t key) {
+            if (AoiGrid::KeyType(key) != type) return false;
+            return !append(AoiGrid::KeyID(key));
+        }), visible.end());
+    };
+    appendVisible(ENTITY_TYPE_TIGER, [&](int tigerID) {
+        int index = tigers.Find(tigerID);
+        if (index < 0 || packet.size() + BOOTSTRAP_TIGER_BYTES > 0xFFFF) return false;
+        const char* encoded = reinterpret_cast<const char*>(tigers.encoded[index].data());
+        packet.insert(packet.end(), encoded, encoded + BOOTSTRAP_TIGER_BYTES);
+        header.tigerCount++;
+        return true;
+    });
+    appendVisible(ENTITY_TYPE_PLAYER, [&](int playerID) {
+        const ClientInfo* other = m_clients.Find(playerID);
+        const ClientColdInfo* otherCold = m_clients.FindCold(playerID);
+        if (!other || !otherCold || !other->isLoggedIn || packet.size() + BOOTSTRAP_PLAYER_MAX_BYTES > 0xFFFF) return false;
+        const PacketPlayerUpdate& update = other->lastUpdate;
+        QuantizedEntityState state = QuantizeEntityState(0, update.x, update.z, update.rotY, update.animationClip, update.animationTime);
+        size_t offset = packet.size();
+        packet.resize(offset + BOOTSTRAP_PLAYER_MAX_BYTES);
+        int written = EncodeBootstrapPlayer(playerID, state, otherCold->username, reinterpret_cast<uint8_t*>(packet.data() + offset));
+        packet.resize(offset + written);
+        header.playerCount++;
+        return true;
+    });
+
+    header.header.size = static_cast<unsigned short>(packet.size());
+    memcpy(packet.data(), &header, sizeof(header));
+    if (!SendPacket(client, packet.data(), static_cast<int>(packet.size()))) {
+        std::cout << "[Bootstrap] Failed to send world bootstrap to client " << clientID << std::endl;
+        return;
+    }
+
+    std::cout << "[Bootstrap] Client " << clientID << ": " << header.treeCount << " trees, " << header.tigerCount << " tigers, "
+              << header.playerCount << " players in " << packet.size() << " bytes" << std::endl;
+}
+
+// LZ 압축 처리량 측정 (서버를 띄우지 않고 결과만 출력)
+//  - 17x17 격자 나무 289그루: 예전 float 배열 형식 / 부트스트랩 양자화 형식
+//  - 스폰 패킷 연속 (스트림 사전이 앞 패킷을 참조)
+//  - 스트림 중간의 압축 패킷 하나가 빠지면 (송신 실패) 다음 패킷에서 디코더가 알아채는지 확인
+static int RunLzBenchmark() {
+    struct Payload {
+        const char* name;
+        std::vector<char> data;
+    };
+    std::vector<Payload> payloads;
+
+    std::vector<char> floats;
+    std::vector<char> quantized(289 * BOOTSTRAP_TREE_BYTES);
+    for (int i = 0; i < 289; ++i) {
+        float tree[5] = { 100.0f + (i % 17) * 50.0f, 0.0f, 100.0f + (i / 17) * 50.0f, (i % 4) * 90.0f, 0.0f };
+        floats.insert(floats.end(), reinterpret_cast<char*>(tree), reinterpret_cast<char*>(tree) + sizeof(tree));
+        EncodeBootstrapTree(tree[0], tree[2], tree[3], 0, reinterpret_cast<uint8_t*>(quantized.data()) + i * BOOTSTRAP_TREE_BYTES);
+    }
+    payloads.push_back({ "trees (float)", floats });
+    payloads.push_back({ "trees (bootstrap)", quantized });
+
+    std::vector<char> spawns;
+    for (int i = 0; i < 64; ++i) {
+        PacketPlayerSpawn spawn = MakePacket<PacketPlayerSpawn>();
+        spawn.playerID = 8192 + i * 1024;
+        snprintf(spawn.username, sizeof(spawn.username), "player%d", i);
+        spawns.insert(spawns.end(), reinterpret_cast<char*>(&spawn), reinterpret_cast<char*>(&spawn) + sizeof(spawn));
+    }
+    payloads.push_back({ "player spawns", spawns });
+
+    const int ITERATIONS = 2000;
+    std::vector<char> compressed(LzCompressBound(LZ_MAX_BLOCK_SIZE));
+    std::vector<char> restored(LZ_MAX_BLOCK_SIZE);
+    for (const Payload& payload : payloads) {
+        const int size = static_cast<int>(payload.data.size());
+        int compressedSize = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < ITERATIONS; ++i) {
+            compressedSize = LzCompress(payload.data.data(), size, compressed.data(), static_cast<int>(compressed.size()));
+        }
+        auto middle = std::chrono::steady_clock::now();
+        int restoredSize = 0;
+        for (int i = 0; i < ITERATIONS; ++i) {
+            restoredSize = LzDecompress(compressed.data(), compressedSize, restored.data(), static_cast<int>(restored.size()));
+        }
+        auto end = std::chrono::steady_clock::now();
+        if (restoredSize != size || memcmp(restored.data(), payload.data.data(), size) != 0) {
+            std::cout << "[LZ] " << payload.name << ": round trip mismatch" << std::endl;
+            return 1;
+        }
+        float kb = size * static_cast<float>(ITERATIONS) / 1024.0f;
+        std::cout << "[LZ] " << payload.name << ": " << size << " -> " << compressedSize << " bytes ("
+                  << (100.0f * compressedSize / size) << "%), compress "
+                  << std::chrono::duration<float, std::micro>(middle - start).count() / kb << " us/KB, decompress "
+                  << std::chrono::duration<float, std::micro>(end - middle).count() / kb << " us/KB" << std::endl;
+    }
+
+    // 스트림: 스폰 패킷을 하나씩 (세션 송신과 같은 경로)
+    LzStreamEncoder encoder;
+    LzStreamDecoder decoder;
+    std::vector<char> packet;
+    std::vector<char> original;
+    size_t rawBytes = 0, wireBytes = 0;
+    for (int round = 0; round < 64; ++round) {   // 사전 창(64KB)을 여러 번 밀어낼 만큼
+        for (size_t offset = 0; offset < spawns.size(); offset += sizeof(PacketPlayerSpawn)) {
+            int size = CompressPacket(encoder, spawns.data() + offset, sizeof(PacketPlayerSpawn), packet);
+            if (size == 0 || !DecompressPacket(decoder, packet.data(), original) ||
+                memcmp(original.data(), spawns.data() + offset, sizeof(PacketPlayerSpawn)) != 0) {
+                std::cout << "[LZ] stream round trip mismatch" << std::endl;
+                return 1;
+            }
+            rawBytes += sizeof(PacketPlayerSpawn);
+            wireBytes += size;
+        }
+    }
+    std::cout << "[LZ] stream of " << rawBytes / sizeof(PacketPlayerSpawn) << " spawn packets: " << rawBytes << " -> "
+              << wireBytes << " bytes (" << (100.0 * wireBytes / rawBytes) << "%)" << std::endl;
+
+    // 유실: 인코더는 사전에 넣었지만 보내지 못한 패킷 (SendPacket 은 이때 연결을 끊음)
+    const int DROPPED = 10;
+    encoder.Reset();
+    decoder.Reset();
+    for (int i = 0; i <= DROPPED + 1; ++i) {
+        const char* spawn = spawns.data() + i * sizeof(PacketPlayerSpawn);
+        int size = CompressPacket(encoder, spawn, sizeof(PacketPlayerSpawn), packet);
+        if (i == DROPPED) continue;
+        bool restored = size != 0 && DecompressPacket(decoder, packet.data(), original) &&
+            memcmp(original.data(), spawn, sizeof(PacketPlayerSpawn)) == 0;
+        if (i < DROPPED && !restored) {
+            std::cout << "[LZ] stream round trip mismatch before drop" << std::endl;
+            return 1;
+        }
+        if (i > DROPPED && restored) {
+            std::cout << "[LZ] dropped packet " << DROPPED << " was not detected" << std::endl;
+            return 1;
+        }
+    }
+    std::cout << "[LZ] dropped packet " << DROPPED << " detected by the next packet" << std::endl;
+    return 0;
+}
+
+// 호랑이 목표 탐색 비교 (서버를 띄우지 않고 결과만 출력)
+//  - 1000마리 x 플레이어 500명, 예전 방식(호랑이마다 전체 플레이어 순회) / 플레이어 격자 조회
+//  - 격자 쪽은 틱마다 하는 재구성 비용까지 포함, 두 방식의 결과가 같은지 확인
+static int RunTigerBenchmark() {
+    const int TIGER_COUNT = 1000;
+    const int PLAYER_COUNT = 500;
+    const int K = 4;
+    const float CHASE_RADIUS = 200.0f;
+    const int ITERATIONS = 50;
+
+    std::mt19937 random(21);
+    std::uniform_real_distribution<float> coord(0.0f, 1000.0f);
+    std::vector<std::pair<float, float>> players(PLAYER_COUNT), tigers(TIGER_COUNT);
+    for (auto& p : players) p = { coord(random), coord(random) };
+    for (auto& t : tigers) t = { coord(random), coord(random) };
+
+    std::vector<int> bruteResult(TIGER_COUNT), gridResult(TIGER_COUNT);
+    auto start = std::chrono::steady_clock::now();
+    for (int iter = 0; iter < ITERATIONS; ++iter) {
+        for (int t = 0; t < TIGER_COUNT; ++t) {
+            float nearestDist = CHASE_RADIUS * CHASE_RADIUS;
+            int nearest = -1;
+            for (int p = 0; p < PLAYER_COUNT; ++p) {
+                float dx = players[p].first - tigers[t].first;
+                float dz = players[p].second - tigers[t].second;
+                float distSq = dx * dx + dz * dz;
+                if (distSq < nearestDist) {
+                    nearestDist = distSq;
+                    nearest = p;
+                }
+            }
+            bruteResult[t] = nearest;
+        }
+    }
+    auto middle = std::chrono::steady_clock::now();
+    AoiGrid grid;
+    for (int iter = 0; iter < ITERATIONS; ++iter) {
+        grid.Clear();
+        for (int p = 0; p < PLAYER_COUNT; ++p) {
+            grid.Insert(AoiGrid::MakeKey(ENTITY_TYPE_PLAYER, p), players[p].first, players[p].second);
+        }
+        for (int t = 0; t < TIGER_COUNT; ++t) {
+            float distSq;
+            const AoiGrid::Entry* nearest = grid.FindNearest(tigers[t].first, tigers[t].second, CHASE_RADIUS, distSq);
+            gridResult[t] = nearest ? static_cast<int>(nearest->key & 0xFFFFFFFF) : -1;
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    int chasing = 0;
+    for (int t = 0; t < TIGER_COUNT; ++t) {
+        if (bruteResult[t] != gridResult[t]) {
+            std::cout << "[TigerBench] nearest mismatch at tiger " << t << std::endl;
+            return 1;
+        }
+        if (gridResult[t] >= 0) chasing++;
+    }
+    std::cout << "[TigerBench] " << TIGER_COUNT << " tigers x " << PLAYER_COUNT << " players, " << chasing << " within "
+              << CHASE_RADIUS << std::endl;
+    std::cout << "[TigerBench] nearest: scan " << std::chrono::duration<float, std::micro>(middle - start).count() / ITERATIONS
+              << " us/tick, grid (rebuild + query) " << std::chrono::duration<float, std::micro>(end - middle).count() / ITERATIONS
+              << " us/tick" << std::endl;
+
+    // k-최근접: 정렬한 전체 거리와 비교
+    std::vector<AoiGrid::Neighbor> neighbors;
+    std::vector<float> sorted(PLAYER_COUNT);
+    auto kStart = std::chrono::steady_clock::now();
+    size_t found = 0;
+    for (int t = 0; t < TIGER_COUNT; ++t) {
+        grid.FindKNearest(tigers[t].first, tigers[t].second, K, CHASE_RADIUS, neighbors);
+        found += neighbors.size();
+    }
+    auto kEnd = std::chrono::steady_clock::now();
+    for (int t = 0; t < TIGER_COUNT; ++t) {
+        grid.FindKNearest(tigers[t].first, tigers[t].second, K, CHASE_RADIUS, neighbors);
+        for (int p = 0; p < PLAYER_COUNT; ++p) {
+            float dx = players[p].first - tigers[t].first;
+            float dz = players[p].second - tigers[t].second;
+            sorted[p] = dx * dx + dz * dz;
+        }
+        std::sort(sorted.begin(), sorted.end());
+        size_t expected = 0;
+        while (expected < static_cast<size_t>(K) && sorted[expected] <= CHASE_RADIUS * CHASE_RADIUS) expected++;
+        if (neighbors.size() != expected) {
+            std::cout << "[TigerBench] k-nearest count mismatch at tiger " << t << std::endl;
+            return 1;
+        }
+        for (size_t i = 0; i < expected; ++i) {
+            if (neighbors[i].distSq != sorted[i]) {
+                std::cout << "[TigerBench] k-nearest mismatch at tiger " << t << std::endl;
+                return 1;
+            }
+        }
+    }
+    std::cout << "[TigerBench] " << K << "-nearest: " << found << " neighbors, grid "
+              << std::chrono::duration<float, std::micro>(kEnd - kStart).count() << " us/tick" << std::endl;
+    return 0;
+}
+
+int GameServer::RunRoomBenchmark(int roomCount, int ticks, int tickRate, int workers) {
+    // 2인 방 roomCount 개를 가짜 세션으로 채우고 방 틱(UpdateRooms: 시뮬레이션 + 관심 영역 + 스냅샷 전송)만 반복
+    //  - 세션은 UDP 전용처럼 만들어 스냅샷이 실제 sendto 를 거침 (받는 쪽은 읽지 않는 루프백 소켓)
+    //  - 클라이언트는 보낸 스냅샷을 바로 ack 한 것으로 침 (델타 기준점 유지)
+    //  - 끝에 방 일부를 비워 풀로 돌려보낸 뒤 새 세션으로 다시 채워 방이 재사용되는지 확인
+    roomCount = std::clamp(roomCount, 1, MAX_ROOMS);
+    GameServer server;
+    server.SetTickRate(tickRate);
+    server.SetSimWorkers(workers);
+
+#ifdef _WIN32
+    WSADATA wsaData;
+    if (WSAStartup(MAKEWORD(2, 2), &wsaData) != 0) {
+        std::cout << "[Error] WSAStartup failed" << std::endl;
+        return 1;
+    }
+#endif
+    SOCKET sink = socket(AF_INET, SOCK_DGRAM, 0);
+    server.m_udpSocket = socket(AF_INET, SOCK_DGRAM, 0);
+    SOCKADDR_IN sinkAddr{};
+    sinkAddr.sin_family = AF_INET;
+    sinkAddr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    sinkAddr.sin_port = 0;
+#ifdef _WIN32
+    int addrLen = sizeof(sinkAddr);
+#else
+    socklen_t addrLen = sizeof(sinkAddr);
+#endif
+    if (sink == INVALID_SOCKET || server.m_udpSocket == INVALID_SOCKET ||
+        bind(sink, (SOCKADDR*)&sinkAddr, sizeof(sinkAddr)) == SOCKET_ERROR ||
+        getsockname(sink, (SOCKADDR*)&sinkAddr, &addrLen) == SOCKET_ERROR) {
+        std::cout << "[Error] Failed to create loopback UDP sockets" << std::endl;
+        if (sink != INVALID_SOCKET) closesocket(sink);
+        return 1;
+    }
+
+    // 호랑이 근처에서 시작해 달리다 가끔 방향을 바꿈 (추격/공격/관심 영역 진입/이탈이 계속 섞이도록)
+    std::mt19937 random(25);
+    std::uniform_real_distribution<float> coord(350.0f, 650.0f);
+    std::uniform_real_distribution<float> angle(0.0f, TIGER_PI * 2.0f);
+    struct BenchSession { int clientID; float dirX, dirZ; };
+    std::vector<BenchSession> sessions;
+    int nextName = 0;
+    auto addSession = [&]() {
+        ClientInfo newClient;
+        newClient.socket = INVALID_SOCKET;
+        newClient.isLoggedIn = true;
+        newClient.isReady = true;
+        newClient.lastUpdate = MakePacket<PacketPlayerUpdate>();
+        newClient.lastUpdate.x = coord(random);
+        newClient.lastUpdate.z = coord(random);
+        newClient.udpToken = 1;
+        newClient.udpBound = true;
+        newClient.udpAddr = sinkAddr;
+        newClient.reliable = std::make_shared<ReliableChannel>();
+        int clientID = server.m_clients.Allocate(newClient);
+        if (clientID == 0) return false;
+        server.m_clients.Find(clientID)->lastUpdate.clientID = clientID;
+        ClientColdInfo* cold = server.m_clients.FindCold(clientID);
+        cold->username = "bench" + std::to_string(nextName++);
+        cold->snapshotBudget = server.m_snapshotBudget;
+        if (server.JoinRoom(clientID) < 0) {
+            server.m_clients.Free(clientID);
+            return false;
+        }
+        float a = angle(random);
+        sessions.push_back({ clientID, std::cos(a), std::sin(a) });
+        return true;
+    };
+    for (int i = 0; i < roomCount * GameRoom::CAPACITY; ++i) {
+        if (!addSession()) {
+            std::cout << "[RoomBench] Failed to create session " << i << std::endl;
+            closesocket(sink);
+            return 1;
+        }
+    }
+
+    const float deltaTime = 1.0f / tickRate;
+    const float PLAYER_SPEED = TIGER_MOVE_SPEED * 1.5f;
+    auto runTick = [&]() {
+        for (BenchSession& session : sessions) {
+            PacketPlayerUpdate& update = server.m_clients.Find(session.clientID)->lastUpdate;
+            if (random() % 50 == 0) {
+                float a = angle(random);
+                session.dirX = std::cos(a);
+                session.dirZ = std::sin(a);
+            }
+            update.x += session.dirX * PLAYER_SPEED * deltaTime;
+            update.z += session.dirZ * PLAYER_SPEED * deltaTime;
+            if (update.x < 0.0f || update.x > 1000.0f) session.dirX = -session.dirX;   // 월드 경계에서 반사
+            if (update.z < 0.0f || update.z > 1000.0f) session.dirZ = -session.dirZ;
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        server.UpdateRooms(deltaTime);
+        float elapsedUs = std::chrono::duration<float, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+        // 바로 ack, 신뢰 채널에 쌓인 진입/이탈 패킷은 버림 (받는 쪽이 없음)
+        server.m_tickStats.tickCount++;
+        for (const BenchSession& session : sessions) {
+            ClientInfo* client = server.m_clients.Find(session.clientID);
+            client->ackedSnapshotTick = static_cast<uint32_t>(server.m_tickStats.tickCount);
+            if (client->reliable->GetPendingCount() > 0) {
+                client->reliable = std::make_shared<ReliableChannel>();
+            }
+            client->sendBackpressure = false;
+        }
+        return elapsedUs;
+    };
+
+    for (int tick = 0; tick < 20; ++tick) {   // 예열 (가시 집합, 스냅샷 기준점, 방별 비용 추정이 자리 잡도록)
+        runTick();
+    }
+    for (int slot : server.m_openRooms) {
+        server.m_rooms[slot]->TakeCostWindow();
+    }
+
+    // 1. 전체 틱과 방별 비용
+    std::vector<float> tickUs(ticks);
+    for (int tick = 0; tick < ticks; ++tick) {
+        tickUs[tick] = runTick();
+    }
+    std::sort(tickUs.begin(), tickUs.end());
+    std::vector<float> roomUs;
+    float worstRoomTickUs = 0.0f, totalRoomUs = 0.0f;
+    for (int slot : server.m_openRooms) {
+        GameRoom::CostWindow window = server.m_rooms[slot]->TakeCostWindow();
+        roomUs.push_back(window.totalUs / std::max(window.ticks, 1));
+        totalRoomUs += roomUs.back();
+        worstRoomTickUs = std::max(worstRoomTickUs, window.maxUs);
+    }
+    std::sort(roomUs.begin(), roomUs.end());
+
+    const float medianUs = tickUs[ticks / 2];
+    const float budgetUs = 1000000.0f / tickRate;
+    const int hardwareThreads = static_cast<int>(std::max(std::thread::hardware_concurrency(), 1u));
+    const int cores = std::min(server.m_jobs->WorkerCount(), hardwareThreads);
+    const float coreUsPerRoom = medianUs * cores / roomCount;   // 방 하나가 쓰는 코어 시간 (틱당)
+    std::cout << "[RoomBench] " << roomCount << " rooms x " << GameRoom::CAPACITY << " players, " << server.m_jobs->WorkerCount()
+              << " workers, " << hardwareThreads << " hardware threads, " << tickRate << " Hz" << std::endl;
+    std::cout << "[RoomBench] tick: " << medianUs << " us median, " << tickUs.back() << " us worst ("
+              << medianUs / budgetUs * 100.0f << "% of " << budgetUs / 1000.0f << " ms budget)" << std::endl;
+    std::cout << "[RoomBench] per room: " << totalRoomUs / roomUs.size() << " us avg, " << roomUs[roomUs.size() * 99 / 100]
+              << " us p99, " << roomUs.back() << " us max (worst single room tick " << worstRoomTickUs << " us)" << std::endl;
+    std::cout << "[RoomBench] estimate: " << static_cast<int>(budgetUs / coreUsPerRoom) << " rooms per core at "
+              << tickRate << " Hz" << std::endl;
+
+    // 2. 방 재사용: 다섯 방 중 하나를 비움 -> 풀로 -> 같은 수의 새 세션으로 다시 채움
+    const size_t allocated = server.m_rooms.size();
+    std::vector<int> leaving;
+    for (size_t i = 0; i < server.m_openRooms.size(); i += 5) {
+        const std::vector<int>& members = server.m_rooms[server.m_openRooms[i]]->Members();
+        leaving.insert(leaving.end(), members.begin(), members.end());
+    }
+    for (int clientID : leaving) {
+        server.LeaveRoom(clientID);
+        server.m_clients.Free(clientID);
+    }
+    sessions.erase(std::remove_if(sessions.begin(), sessions.end(), [&](const BenchSession& session) {
+        return std::find(leaving.begin(), leaving.end(), session.clientID) != leaving.end();
+    }), sessions.end());
+    const size_t pooled = server.m_freeRooms.size();
+    for (size_t i = 0; i < leaving.size(); ++i) {
+        addSession();
+    }
+    for (int tick = 0; tick < 20; ++tick) {
+        runTick();
+    }
+    const bool reused = server.m_rooms.size() == allocated && server.m_freeRooms.empty() &&
+                        server.m_openRooms.size() == static_cast<size_t>(roomCount);
+    std::cout << "[RoomBench] recycled " << pooled << " rooms through the pool: " << allocated << " rooms allocated before, "
+              << server.m_rooms.size() << " after, " << server.m_openRooms.size() << " open -> "
+              << (reused ? "reused" : "NOT reused") << std::endl;
+    server.LogRoomStats();
+
+    closesocket(sink);
+    return reused ? 0 : 1;
+}
+
+int main(int argc, char* argv[]) {
+    // 사용법: Server [--port <번호>] [--io <iocp|epoll|uring>] [--tick-rate <Hz>] [--snapshot-budget <바이트>]
+    //              [--udp-loss <퍼센트>]   (UDP 송신 손실 주입, 테스트용)
+    //              [--lz-bench]            (압축 처리량만 측정하고 종료)
+    //              [--tiger-bench]         (호랑이 목표 탐색만 측정하고 종료)
+    //              [--sim-workers <수>]    (틱 안의 월드 갱신을 나눌 워커 수, 기본 = 하드웨어 스레드 수)
+    //              [--tiger-sim-bench [수] [플레이어 수]] (호랑이 수(기본 10000), 플레이어 수(기본 500)로 AI 틱만 측정하고 종료)
+    //              [--tiger-scale-bench [수] [플레이어 수]] (같은 AI 틱을 워커 1/2/4/8/16 개로 측정하고 종료)
+    //              [--room-bench [방 수]]  (2인 방(기본 500개)을 가짜 세션으로 채워 방 틱만 측정하고 종료)
+    int port = 5000;
+    int tickRate = 10;
+    int simWorkers = static_cast<int>(std::thread::hardware_concurrency());
+    int snapshotBudget = 0;
+    int udpLoss = 0;
+    std::string ioBackend;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--port" && i + 1 < argc) {
+            port = std::atoi(argv[++i]);
+        } else if (arg == "--io" && i + 1 < argc) {
+            ioBackend = argv[++i];
+        } else if (arg.rfind("--io=", 0) == 0) {
+            ioBackend = arg.substr(5);
+        } else if (arg == "--tick-rate" && i + 1 < argc) {
+            tickRate = std::atoi(argv[++i]);
+        } else if (arg == "--snapshot-budget" && i + 1 < argc) {
+            snapshotBudget = std::atoi(argv[++i]);
+        } else if (arg == "--udp-loss" && i + 1 < argc) {
+            udpLoss = std::atoi(argv[++i]);
+        } else if (arg == "--sim-workers" && i + 1 < argc) {
+            simWorkers = std::atoi(argv[++i]);
+        } else if (arg == "--lz-bench") {
+            return RunLzBenchmark();
+        } else if (arg == "--tiger-bench") {
+            return RunTigerBenchmark();
+        } else if (arg == "--tiger-sim-bench") {
+            int count = (i + 1 < argc) ? std::atoi(argv[i + 1]) : 0;
+            int players = (i + 2 < argc) ? std::atoi(argv[i + 2]) : 0;
+            return GameRoom::RunTigerSimulationBenchmark(count > 0 ? count : 10000, players > 0 ? players : 500, 100, tickRate, simWorkers);
+        } else if (arg == "--tiger-scale-bench") {
+            int count = (i + 1 < argc) ? std::atoi(argv[i + 1]) : 0;
+            int players = (i + 2 < argc) ? std::atoi(argv[i + 2]) : 0;
+            return GameRoom::RunTigerScalingBenchmark(count > 0 ? count : 10000, players > 0 ? players : 500, 100, tickRate);
+        } else if (arg == "--room-bench") {
+            int rooms = (i + 1 < argc) ? std::atoi(argv[i + 1]) : 0;
+            return GameServer::RunRoomBenchmark(rooms > 0 ? rooms : 500, 200, tickRate, simWorkers);
+        }
+    }
 
-int main() {
     GameServer server;
+    server.SetTickRate(tickRate);
+    server.SetSimWorkers(simWorkers);
+    if (snapshotBudget > 0) {
+        server.SetSnapshotBudget(snapshotBudget);
+    }
+    server.SetUdpLoss(udpLoss);
     
-    if (!server.Initialize(5000)) {  // 포트 번호 지정 가능
+    if (!server.Initialize(port, ioBackend)) {  // 포트 번호 지정 가능
         std::cout << "[Error] Server initialization failed" << std::endl;
         return 1;
     }
@@ -1,112 +1,274 @@
 #pragma once
 
-#pragma comment(lib, "ws2_32.lib")
-
-#define NOMINMAX
-#include <winsock2.h>
-#include <windows.h>
-#include <mswsock.h>
+#include "Platform.h"
 #include <unordered_map>
 #include <vector>
 #include <random>
+#include <string>
+#include <thread>
+#include <atomic>
+#include <memory>
+#include <chrono>
+#include <cstdint>
+#include <algorithm>
 #include "Packet.h"
+#include "IOBackend.h"
+#include "MpscRingBuffer.h"
+#include "SessionTable.h"
+#include "AoiGrid.h"
+#include "JobSystem.h"
+#include "GameRoom.h"
 
 class GameServer {
 public:
     GameServer();
     ~GameServer();
 
-    bool Initialize(int port = 5000);
+    bool Initialize(int port = 5000, const std::string& ioBackend = "");
     void Start();
     void Stop();
+    void SetTickRate(int hz) { m_tickRate = hz > 0 ? hz : 10; }
+    // 로그인하는 클라이언트에 적용할 틱당 스냅샷 바이트 예산 (호랑이 항목 하나는 들어가도록 최소값 보장)
+    void SetSnapshotBudget(int bytes) { m_snapshotBudget = std::max(bytes, MIN_SNAPSHOT_BUDGET); }
+    void SetUdpLoss(int percent) { m_udpLossPercent = std::clamp(percent, 0, 100); }
+    // 틱 안의 월드 갱신을 나눠 맡을 워커 수 (시뮬레이션 스레드 포함, Start 전에 호출)
+    void SetSimWorkers(int count);
+    // 가짜 세션으로 2인 방 roomCount 개를 채워 방 틱(시뮬레이션 + 전송)을 측정하고 방 재사용 확인 (--room-bench). 종료 코드 반환
+    static int RunRoomBenchmark(int roomCount, int ticks, int tickRate, int workers);
 
 private:
-    static constexpr int MAX_CLIENTS = 2;
     static constexpr int MAX_PACKET_SIZE = 1024;
-    static constexpr int MAX_TIGERS = 5;   // 성능 개선을 위해 5마리로 줄임
-    static constexpr int MAX_TREES = 289;  // 17x17 나무
+    static constexpr int SLOW_CLIENT_TIMEOUT_SEC = 5;  // 송신이 이만큼 계속 밀리면 연결 종료
+    static constexpr int UDP_SESSION_TIMEOUT_SEC = 10; // UDP 전용 세션이 이만큼 조용하면 연결 종료
+    static constexpr size_t RELIABLE_HIGH_WATER = 256; // 신뢰 채널 미확인 세그먼트가 이보다 많으면 backpressure
+    static constexpr float AOI_ENTER_RADIUS = GameRoom::AOI_ENTER_RADIUS;
+    static constexpr float AOI_LEAVE_RADIUS = GameRoom::AOI_LEAVE_RADIUS;
+    static constexpr int MAX_SIM_WORKERS = 64;
+    static constexpr float ROOM_MIN_COST_US = 1.0f;   // 아직 측정하지 않은 방의 배분용 비용 (새 방들이 한 워커에 몰리지 않도록)
+
+    // 스냅샷 예산 (틱당 바이트, 헤더 포함)
+    static constexpr int DEFAULT_SNAPSHOT_BUDGET = 128;
+    static constexpr int MIN_SNAPSHOT_BUDGET = static_cast<int>(sizeof(PacketTigerSnapshot)) + (SNAPSHOT_ENTRY_MAX_BITS + 7) / 8;
+    // 우선순위 누적 가중치 (바뀐 것이 있는 호랑이가 틱마다 얻는 값)
+    static constexpr float PRIORITY_BASE = 1.0f;             // 밀린 틱마다 기본으로 쌓임
+    static constexpr float PRIORITY_DISTANCE_WEIGHT = 4.0f;  // 가까울수록 (AOI 경계 0 ~ 바로 옆 4)
+    static constexpr float PRIORITY_SPEED_WEIGHT = 0.05f;    // 빠를수록 (달리기 약 60/s -> 3)
+    static constexpr float PRIORITY_CLIP_BONUS = 4.0f;       // 애니메이션이 바뀜
+    static constexpr float PRIORITY_ATTACK_BONUS = 16.0f;    // 공격 시작 / 처음 보임 - 거의 항상 이번 틱에 보냄
 
+    // 세션 필드는 SessionTable에 hot / cold / recv 로 나눠 저장 (키 = 세대 포함 핸들 = clientID)
     struct ClientInfo {
         SOCKET socket;
-        int clientID;
-        std::string username;
         bool isLoggedIn;
-        PacketPlayerUpdate lastUpdate;
+        bool isReady = false;           // CLIENT_READY 수신 후부터 관심 영역 갱신 대상
+        PacketPlayerUpdate lastUpdate;  // 호랑이 AI가 매 틱 읽는 위치
+        bool sendBackpressure = false;  // 이번 틱에 송신 대기열이 high-water를 넘었는지
+        int backpressureTicks = 0;      // high-water를 넘은 상태로 연속된 틱 수
+        uint32_t ackedSnapshotTick = 0; // 클라이언트가 마지막으로 ack한 스냅샷 (델타 기준점, 0 = 없음)
+        uint32_t udpToken = 0;          // LOGIN_RESPONSE로 알려준 세션 토큰 (0 = UDP 없음)
+        bool udpBound = false;          // 이 클라이언트의 데이터그램을 받은 뒤부터 UDP로 송신
+        SOCKADDR_IN udpAddr{};          // 마지막으로 받은 데이터그램의 보낸 주소
+        uint32_t udpSendSequence = 0;
+        SequenceFilter udpRecv;         // 오래된/중복 데이터그램 제거
+        std::shared_ptr<ReliableChannel> reliable;  // UDP 전용 세션의 신뢰 채널 (null = TCP 세션)
+        uint64_t lastDatagramTick = 0;  // 마지막으로 데이터그램을 받은 틱 (UDP 전용 세션 시간 초과 판정)
+        std::shared_ptr<LzStreamEncoder> compressor;  // 큰 패킷 압축 사전 (처음 압축할 때 생성)
+        bool streamBroken = false;      // 압축한 패킷을 보내지 못해 클라이언트 사전과 어긋남 (틱 끝에 연결 종료)
+        int room = -1;                  // 로그인 때 배정된 방 (m_rooms 칸, -1 = 없음)
+    };
+
+    struct EntityPriority {
+        uint32_t entityID;
+        float accumulated;
+    };
+
+    struct SnapshotBudgetStats {
+        uint64_t sentBytes = 0;    // 실제로 보낸 스냅샷 바이트
+        uint64_t budgetBytes = 0;  // 같은 스냅샷들의 예산 합 (채움 비율 = sentBytes / budgetBytes)
+        int peakBytes = 0;
+        uint64_t packets = 0;
+        uint64_t deferred = 0;     // 예산이 모자라 다음 틱으로 밀린 호랑이 갱신 수
+    };
+
+    struct ClientColdInfo {
+        std::string username;
         int sendFailCount = 0; // 송신 실패 횟수
         int connectionErrorCount = 0; // 연결 에러 횟수
-        
-        // 패킷 버퍼링을 위한 추가 필드
-        char packetBuffer[MAX_PACKET_SIZE * 4];  // 여러 패킷을 저장할 수 있는 버퍼
-        int packetBufferSize = 0;  // 현재 버퍼에 저장된 데이터 크기
+        SnapshotHistory snapshots;    // 최근 보낸 스냅샷 링 (슬롯 벡터 재사용, 델타 기준점 조회)
+        std::vector<uint64_t> visible; // 관심 영역 안의 엔티티 (AoiGrid 키 오름차순)
+        int snapshotBudget = DEFAULT_SNAPSHOT_BUDGET;  // 틱당 스냅샷 바이트 예산
+        std::vector<EntityPriority> priorities;        // 예산에 밀린 호랑이의 누적 우선순위 (entityID 오름차순)
+        SnapshotBudgetStats budgetStats;               // 보고 주기 동안의 예산 사용량
+    };
+
+    // 예산 배분 후보 (이번 틱에 바뀐 것이 있는 호랑이)
+    struct Candidate {
+        int tiger;                         // 방의 호랑이 풀 인덱스
+        const QuantizedEntityState* base;  // 기준점 상태 (없으면 새로 보이는 호랑이)
+        float priority;
+        int bits;
     };
 
-    struct TigerInfo {
-        int tigerID;
-        float x, y, z;
-        float rotY;
-        float targetX, targetZ;  // 목표 위치
-        float moveTimer;         // 이동 타이머
-        bool isChasing;         // 플레이어 추적 여부
-        std::string currentAnimation;  // 현재 애니메이션 파일명
-        float animationTime;     // 애니메이션 시간
-        float attackTime;        // 공격 타이머 (원본과 동일)
-        float searchTime;        // 탐색 타이머
-        float elapseTime;        // 애니메이션 경과 시간
-        bool isFired;           // 공격 발사 여부
+    // 클라이언트 -> 서버 패킷 중 가장 큰 크기 (명령 한 칸에 그대로 담음)
+    static constexpr int MAX_COMMAND_SIZE = static_cast<int>(std::max({
+        sizeof(PacketPlayerUpdate), sizeof(PacketLoginRequest), sizeof(PacketPlayerDisconnect),
+        sizeof(PacketClientReady), sizeof(PacketPlayerSpawn), sizeof(PacketTigerSpawn), sizeof(PacketTigerUpdate), sizeof(PacketSnapshotAck) }));
+    static constexpr int COMMAND_DATA_SIZE = std::max(MAX_COMMAND_SIZE, MAX_CLIENT_DATAGRAM_SIZE - static_cast<int>(sizeof(DatagramHeader)));
+    static constexpr size_t COMMAND_QUEUE_SIZE = 8192;
+
+    // I/O 스레드 -> 시뮬레이션 스레드로 전달되는 고정 크기 명령
+    struct InboundCommand {
+        enum Type : uint8_t { PACKET, DATAGRAM, DISCONNECT } type;
+        uint16_t size;      // PACKET: 패킷 크기, DATAGRAM: 본문(청크) 크기
+        int clientID;
+        int error;          // DISCONNECT: 소켓 에러 코드
+        DatagramHeader datagram;  // DATAGRAM: 토큰/시퀀스/ack
+        SOCKADDR_IN from;   // DATAGRAM: 보낸 주소
+        char data[COMMAND_DATA_SIZE];
     };
 
-    struct TreeInfo {
-        int treeID;
-        float x, y, z;
-        float rotY;
-        int treeType;  // 0: long_tree, 1: normal_tree
+    // 큰 패킷 자동 압축 통계 (보고 주기마다 초기화)
+    struct CompressionStats {
+        uint64_t packets = 0;
+        uint64_t rawBytes = 0;
+        uint64_t compressedBytes = 0;
+        float elapsedUs = 0.0f;   // 압축에 쓴 시간
     };
 
-    struct IOContext {
-        OVERLAPPED overlapped;
-        WSABUF wsaBuf;
-        char buffer[MAX_PACKET_SIZE];
-        DWORD flags;
+    // 틱 예산 측정 (보고 주기마다 초기화)
+    struct TickStats {
+        uint64_t tickCount = 0;        // 서버 시작 후 전체 틱 수
+        uint64_t overrunCount = 0;     // 전체 예산 초과 틱 수
+        uint64_t skippedTicks = 0;     // 너무 밀려서 건너뛴 틱 수
+        std::vector<float> windowMs;   // 보고 주기 동안의 틱 소요 시간
+        float windowMaxMs = 0.0f;
+        uint64_t windowOverruns = 0;
     };
 
 private:
     // 멤버 변수
-    HANDLE m_hIOCP;
-    int m_nextClientID;
-    int m_nextTigerID;
-    int m_nextTreeID;
-    std::unordered_map<int, ClientInfo> m_clients;
-    std::unordered_map<int, TigerInfo> m_tigers;
-    std::unordered_map<int, TreeInfo> m_trees;
+    std::unique_ptr<IOBackend> m_io;  // IOCP(Windows) / epoll(Linux)
+    SessionTable<ClientInfo, ClientColdInfo> m_clients;  // 조회 O(1), 재해시 없음
     SOCKET m_listenSocket;
-    std::vector<HANDLE> m_workerThreads;
-    bool m_isRunning;
+    std::vector<std::thread> m_workerThreads;
+    std::thread m_simThread;
+    SOCKET m_udpSocket = INVALID_SOCKET;  // 위치/스냅샷용 UDP (TCP와 같은 포트 번호)
+    std::thread m_udpThread;
+    int m_udpLossPercent = 0;             // 송신 손실 주입 (테스트용)
+    // UDP 통계 (rejected 외에는 시뮬레이션 스레드 전용)
+    uint64_t m_udpSent = 0;
+    uint64_t m_udpReceived = 0;
+    std::atomic<uint64_t> m_udpRejected{0};
+    std::unordered_map<uint64_t, int> m_udpPeers;  // UDP 전용 세션의 주소 -> clientID (로그인 전 데이터그램용)
+    uint64_t m_udpSendErrors = 0;
+    uint64_t m_udpInjectedDrops = 0;
+    uint64_t m_udpNewSessions = 0;        // 로그인 데이터그램으로 만든 UDP 전용 세션 (보고 주기마다 출력 후 0)
+    uint64_t m_udpSessionsFull = 0;       // 세션 테이블이 가득 차 거절한 로그인 데이터그램
+    int m_tickRate;                    // 시뮬레이션 틱 (Hz)
+    TickStats m_tickStats;
+    MpscRingBuffer<InboundCommand, COMMAND_QUEUE_SIZE> m_commandQueue;  // 시뮬레이션 스레드에서 틱마다 한 번에 처리
+    std::atomic<bool> m_isRunning;
     int m_port;
-    float m_tigerUpdateTimer;
     std::mt19937 m_randomEngine;
+    std::unique_ptr<JobSystem> m_jobs;  // 틱 안의 작업 (방 묶음, 방 안의 엔티티 범위)
+    // 방 (칸 = m_rooms 인덱스, 닫힌 방은 m_freeRooms 에 남아 다음 Open 에서 재사용)
+    static constexpr int MAX_ROOMS = SessionTable<ClientInfo, ClientColdInfo>::CAPACITY / GameRoom::CAPACITY;
+    std::vector<std::unique_ptr<GameRoom>> m_rooms;
+    std::vector<int> m_openRooms;        // 열린 방 칸 (오름차순 = 전송 순서)
+    std::vector<int> m_freeRooms;        // 풀 (마지막에 닫힌 방부터 재사용)
+    int m_nextRoomID = 1;
+    std::vector<float> m_roomSimUs;      // 칸별 이번 틱 시뮬레이션 시간 (워커들이 자기 방 칸에만 씀)
+    std::vector<std::vector<int>> m_roomBuckets;   // 워커 묶음별 방 칸 (잡 하나 = 묶음 하나)
+    std::vector<float> m_bucketLoadUs;   // 배분 때 묶음별 추정 비용
+    std::vector<int> m_rebalanceOrder;   // 배분용 (재사용)
+    bool m_roomsChanged = false;         // 방이 열리거나 닫혀 다시 배분해야 함
+    uint64_t m_lastRebalanceTick = 0;
+    std::vector<Candidate> m_priorityScratch;     // 예산 배분용 (틱마다 재사용)
+    std::vector<EntityPriority> m_priorityNext;   // 다음 틱 우선순위 조립용 (cold.priorities 와 맞바꿈)
+    SnapshotEntities m_snapshotScratch;           // 스냅샷 조립용 (SnapshotHistory::Store 와 맞바꿈)
+    std::vector<uint8_t> m_snapshotBits;          // 스냅샷 델타 비트열 (재사용)
+    std::vector<char> m_snapshotPacket;           // 스냅샷 패킷 조립용 (재사용)
+    int m_snapshotBudget = DEFAULT_SNAPSHOT_BUDGET;
+    std::vector<char> m_bootstrapScratch;   // 부트스트랩 패킷 조립용 (재사용)
+    std::vector<char> m_compressScratch;    // 압축 패킷 조립용 (재사용)
+    CompressionStats m_compressStats;
 
     // 내부 메서드
-    static DWORD WINAPI WorkerThreadProc(LPVOID lpParam);
-    DWORD WorkerThread();
+    void WorkerThread();
+    bool InitializeUdp();
+    void UdpReceiveThread();
+    void ProcessDatagram(InboundCommand& cmd);
+    int FindOrCreateUdpSession(const InboundCommand& cmd);
+    void DispatchDatagramPackets(int clientID, const char* data, int size);
+    void SendDatagram(int clientID, ClientInfo& client, char* datagram, int bodySize);
+    void FlushDatagrams();
+    void CheckUdpTimeouts();
+    bool SendReliable(ClientInfo& client, const void* packet, int size);
+    static uint64_t MakeAddressKey(const SOCKADDR_IN& addr) {
+        return (static_cast<uint64_t>(addr.sin_addr.s_addr) << 16) | addr.sin_port;
+    }
+    static bool IsUdpLoginDatagram(const char* data, int size);
+    // TCP 소켓이 살아 있거나 UDP 전용 세션
+    static bool IsConnected(const ClientInfo& client) { return client.socket != INVALID_SOCKET || client.reliable; }
+    // 최신 상태만 의미 있는 패킷 송신 (UDP, 아직 UDP가 연결되지 않았으면 TCP)
+    bool SendUnreliable(int clientID, ClientInfo& client, const void* packet, int size);
+    void LogUdpStats();
+    void LogCompressionStats();
+    void SimulationThread();
+    void ProcessCommands();
+    void RecordTick(float elapsedMs, float budgetMs);
     void Cleanup();
-    void BroadcastPacket(const void* packet, int size, int excludeID = -1);
+    // 같은 방의 로그인한 멤버에게
+    void BroadcastPacket(const GameRoom& room, const void* packet, int size, int excludeID = -1);
+    void BroadcastShared(const GameRoom& room, const BroadcastRef& buffer, int excludeID = -1);
     void ProcessNewClient(SOCKET clientSocket);
-    bool SendPacket(SOCKET socket, const void* packet, int size);
-    bool StartReceive(SOCKET clientSocket, int clientID, IOContext* ioContext);
-    void BroadcastNewPlayer(int newClientID);
-    void HandlePacket(IOContext* ioContext, int clientID, DWORD bytesTransferred);
+    bool SendPacket(ClientInfo& client, const void* packet, int size);
+    bool SendPacket(ClientInfo& client, const BroadcastRef& buffer);
+    bool CheckSendResult(ClientInfo& client, IOBackend::SendResult result);
+    void UpdateSendBackpressure();
+    void SendToObservers(int playerID, const void* packet, int size);
+    int HandlePacket(int clientID, const char* data, int bytesAvailable);
+    void HandleDisconnect(int clientID, int error);
+    void RemoveClient(int clientID, int error);
     void ProcessSinglePacket(char* buffer, int clientID, int packetSize);
+
+    // 패킷 핸들러 (공용 스키마의 핸들러 테이블이 타입 번호로 바로 호출)
+    friend class PacketDispatcher<GameServer, int>;
+    void OnPacket(PacketView<PacketLoginRequest> pkt, int clientID);
+    void OnPacket(PacketView<PacketPlayerDisconnect> pkt, int clientID);
+    void OnPacket(PacketView<PacketPlayerUpdate> pkt, int clientID);
+    void OnPacket(PacketView<PacketPlayerSpawn> pkt, int clientID);
+    void OnPacket(PacketView<PacketTigerSpawn> pkt, int clientID);
+    void OnPacket(PacketView<PacketTigerUpdate> pkt, int clientID);
+    void OnPacket(PacketView<PacketClientReady> pkt, int clientID);
+    void OnPacket(PacketView<PacketSnapshotAck> pkt, int clientID);
+    template<typename T>
+    void OnPacket(PacketView<T> pkt, int clientID);   // 서버가 받지 않는 패킷
     
+    // 방 관련 메서드
+    // 빈자리가 있는 방에 넣음 (없으면 풀에서 꺼내거나 새로 엶). 방 칸 반환, 방을 더 열 수 없으면 -1
+    int JoinRoom(int clientID);
+    // 방에서 뺌. 방이 비어 풀로 돌아갔으면 true
+    bool LeaveRoom(int clientID);
+    GameRoom* FindRoom(const ClientInfo& client) { return client.room >= 0 ? m_rooms[client.room].get() : nullptr; }
+    // 틱마다: 멤버 상태 채움 -> 방 묶음을 워커들이 나눠 시뮬레이션 -> 방 순서대로 관심 영역/스냅샷 전송
+    void UpdateRooms(float deltaTime);
+    // 열린 방을 추정 비용이 큰 순으로 가장 가벼운 워커 묶음에 (LPT)
+    void RebalanceRooms();
+    void LogRoomStats();
+
     // 호랑이 관련 메서드
-    void InitializeTigers();
-    void UpdateTigers(float deltaTime);
-    void BroadcastTigerUpdates();
-    void UpdateTigerBehavior(TigerInfo& tiger, float deltaTime);
-    float GetRandomFloat(float min, float max);
-    bool IsPlayerNearby(const TigerInfo& tiger, float radius);
-    void GetNearestPlayerPosition(const TigerInfo& tiger, float& targetX, float& targetZ);
-    
-    // 나무 관련 메서드
-    void InitializeTrees();
-    void SendTreePositions(int clientID);
+    void BroadcastTigerUpdates(GameRoom& room, uint32_t tick);
+    // 우선순위 순으로 예산 안에 들어가는 호랑이만 현재 상태로 담음. 예상 패킷 바이트 반환
+    int BuildBudgetedSnapshot(const GameRoom& room, const ClientInfo& client, ClientColdInfo& cold, const SnapshotEntities* baseline, SnapshotEntities& out);
+    void LogSnapshotBudgets();
+
+    // 관심 영역(AOI) 관련 메서드
+    void SendInterestChanges(GameRoom& room);
+    void SendEntityEnter(const GameRoom& room, ClientInfo& client, uint64_t key);
+    void SendEntityLeave(ClientInfo& client, uint64_t key);
+    static bool HasPosition(const ClientInfo& client) { return client.lastUpdate.header.type == PACKET_PLAYER_UPDATE; }
+
+    // 접속 부트스트랩 (나무 전체 + 관심 영역 안의 호랑이/플레이어를 패킷 하나로)
+    void SendWorldBootstrap(int clientID, ClientInfo& client, ClientColdInfo& cold);
 }; 
\ No newline at end of file
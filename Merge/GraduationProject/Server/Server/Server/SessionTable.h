@@ -0,0 +1,171 @@
+#pragma once
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <deque>
+#include <chrono>
+#include <cstdint>
+
+// 슬롯 배열 기반 세션 테이블 (unordered_map<int, ClientInfo> 대체)
+//  - 핸들(=clientID) 32bit: [generation 16bit][shard 3bit][slot 10bit]
+//    슬롯이 재사용되면 generation이 바뀌므로 이전 핸들로는 찾을 수 없음
+//  - 필드를 hot / cold 로 나눠 별도 배열에 저장
+//      Hot : 브로드캐스트, AI가 매 틱 순회하는 필드 (소켓, 로그인 여부, 위치)
+//      Cold: 로그인/에러 처리 때만 접근 (사용자명, 에러 카운트)
+//  - 할당(accept 스레드)과 해제(시뮬레이션 스레드)는 샤드별 뮤텍스, 조회/순회는 락 없음
+//  - 스레드 규칙 (슬롯 내용은 동기화하지 않으므로 반드시 지킬 것)
+//      Contains          : 아무 스레드 (원자적 핸들만 읽음 - 세대가 다르면 false, 슬롯 내용은 읽지 않음)
+//      Find/FindCold/ForEach: 시뮬레이션 스레드만 (해제도 시뮬레이션 스레드이므로 틱 안에서는 슬롯이 바뀌지 않음)
+//      Allocate          : 아무 스레드 (샤드 뮤텍스 안에서 슬롯을 채운 뒤 핸들을 공개)
+//      Free              : 시뮬레이션 스레드 (예외: accept 스레드가 백엔드 등록에 실패한 새 세션)
+//  - 해제된 슬롯은 QUARANTINE 동안 재사용하지 않음 (아래 참고)
+// 핸들 비트 배치와 최대 세션 수 (세션 수에 맞춰 크기를 잡는 I/O 백엔드가 템플릿 인자 없이 참조)
+struct SessionTableLayout {
+    static constexpr int SLOT_BITS = 10;
+    static constexpr int SHARD_BITS = 3;
+    static constexpr int SLOTS_PER_SHARD = 1 << SLOT_BITS;
+    static constexpr int SHARD_COUNT = 1 << SHARD_BITS;
+    static constexpr int CAPACITY = SLOTS_PER_SHARD * SHARD_COUNT;
+    static constexpr int INDEX_BITS = SLOT_BITS + SHARD_BITS;
+    static constexpr uint32_t INDEX_MASK = (1u << INDEX_BITS) - 1;
+};
+
+template<typename Hot, typename Cold>
+class SessionTable : public SessionTableLayout {
+public:
+
+    SessionTable()
+        : m_handles(new std::atomic<uint32_t>[CAPACITY])
+        , m_generations(new uint16_t[CAPACITY])
+        , m_hot(new Hot[CAPACITY])
+        , m_cold(new Cold[CAPACITY])
+        , m_nextShard(0)
+        , m_count(0)
+    {
+        for (int i = 0; i < CAPACITY; ++i) {
+            m_handles[i].store(0, std::memory_order_relaxed);
+            m_generations[i] = 0;
+        }
+        for (int s = 0; s < SHARD_COUNT; ++s) {
+            m_shards[s].highWater.store(0, std::memory_order_relaxed);
+            for (int i = 0; i < SLOTS_PER_SHARD; ++i) {
+                m_shards[s].freeSlots.push_back({ s * SLOTS_PER_SHARD + i, Clock::time_point{} });
+            }
+        }
+    }
+
+    SessionTable(const SessionTable&) = delete;
+    SessionTable& operator=(const SessionTable&) = delete;
+
+    // 새 세션 할당. 가득 차면 0 반환
+    int Allocate(const Hot& initial) {
+        int startShard = m_nextShard.fetch_add(1, std::memory_order_relaxed);
+        for (int n = 0; n < SHARD_COUNT; ++n) {
+            Shard& shard = m_shards[(startShard + n) & (SHARD_COUNT - 1)];
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            if (shard.freeSlots.empty() || Clock::now() - shard.freeSlots.front().freedAt < QUARANTINE) {
+                continue;
+            }
+
+            int index = shard.freeSlots.front().index;
+            shard.freeSlots.pop_front();
+
+            uint16_t generation = static_cast<uint16_t>(m_generations[index] + 1);
+            if (generation == 0) generation = 1;  // 핸들 0은 "없음"
+            m_generations[index] = generation;
+
+            m_hot[index] = initial;
+            m_cold[index] = Cold{};
+
+            int localSlot = index & (SLOTS_PER_SHARD - 1);
+            if (localSlot >= shard.highWater.load(std::memory_order_relaxed)) {
+                shard.highWater.store(localSlot + 1, std::memory_order_release);
+            }
+
+            uint32_t handle = (static_cast<uint32_t>(generation) << INDEX_BITS) | static_cast<uint32_t>(index);
+            m_handles[index].store(handle, std::memory_order_release);  // 여기서부터 조회 가능
+            m_count.fetch_add(1, std::memory_order_relaxed);
+            return static_cast<int>(handle);
+        }
+        return 0;
+    }
+
+    // 세션 해제 (시뮬레이션 스레드)
+    void Free(int handle) {
+        uint32_t index = static_cast<uint32_t>(handle) & INDEX_MASK;
+        uint32_t expected = static_cast<uint32_t>(handle);
+        if (!m_handles[index].compare_exchange_strong(expected, 0, std::memory_order_acq_rel)) {
+            return;  // 이미 해제됨
+        }
+        m_count.fetch_sub(1, std::memory_order_relaxed);
+
+        Shard& shard = m_shards[index >> SLOT_BITS];
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        shard.freeSlots.push_back({ static_cast<int>(index), Clock::now() });
+    }
+
+    // 시뮬레이션 스레드 전용. 다른 스레드는 Contains 만 (슬롯이 재할당되는 중일 수 있음)
+    Hot* Find(int handle) {
+        int index = Lookup(handle);
+        return index >= 0 ? &m_hot[index] : nullptr;
+    }
+    Cold* FindCold(int handle) {
+        int index = Lookup(handle);
+        return index >= 0 ? &m_cold[index] : nullptr;
+    }
+    bool Contains(int handle) const { return Lookup(handle) >= 0; }
+
+    // 살아있는 세션 순회: func(int handle, Hot& hot)
+    // 순회 중 다른 스레드에서 세션이 추가되어도 안전 (추가된 세션은 보일 수도, 안 보일 수도 있음)
+    template<typename Func>
+    void ForEach(Func&& func) {
+        for (int s = 0; s < SHARD_COUNT; ++s) {
+            int base = s * SLOTS_PER_SHARD;
+            int highWater = m_shards[s].highWater.load(std::memory_order_acquire);
+            for (int i = 0; i < highWater; ++i) {
+                uint32_t handle = m_handles[base + i].load(std::memory_order_acquire);
+                if (handle != 0) {
+                    func(static_cast<int>(handle), m_hot[base + i]);
+                }
+            }
+        }
+    }
+
+    int Count() const { return m_count.load(std::memory_order_relaxed); }
+
+private:
+    using Clock = std::chrono::steady_clock;
+    // 재사용 전 격리 시간. 안전성은 위의 스레드 규칙이 보장하고, 격리는 그 위의 여유분:
+    //  - accept 스레드가 등록 실패로 바로 Free 한 슬롯을 시뮬레이션 스레드가 같은 틱의 ForEach 에서
+    //    보고 있을 수 있음 -> 틱 하나보다 충분히 긴 동안 Allocate 가 덮어쓰지 않음
+    //  - 16비트 세대가 짧은 시간에 한 바퀴 돌아 오래된 핸들(I/O 완료 키, UDP clientID)이 다시 맞는 것 방지
+    static constexpr std::chrono::seconds QUARANTINE{ 1 };
+
+    struct FreeSlot {
+        int index;
+        Clock::time_point freedAt;
+    };
+
+    struct Shard {
+        std::mutex mutex;
+        std::deque<FreeSlot> freeSlots;    // FIFO: 가장 오래전에 해제된 슬롯부터 재사용
+        std::atomic<int> highWater;        // 이 샤드에서 사용된 적 있는 최대 슬롯 + 1
+    };
+
+    int Lookup(int handle) const {
+        if (handle <= 0) return -1;
+        uint32_t index = static_cast<uint32_t>(handle) & INDEX_MASK;
+        if (m_handles[index].load(std::memory_order_acquire) != static_cast<uint32_t>(handle)) {
+            return -1;
+        }
+        return static_cast<int>(index);
+    }
+
+    std::unique_ptr<std::atomic<uint32_t>[]> m_handles;   // 0 = 빈 슬롯
+    std::unique_ptr<uint16_t[]> m_generations;
+    std::unique_ptr<Hot[]> m_hot;
+    std::unique_ptr<Cold[]> m_cold;
+    Shard m_shards[SHARD_COUNT];
+    std::atomic<int> m_nextShard;
+    std::atomic<int> m_count;
+};
@@ -0,0 +1,213 @@
+#pragma once
+#include <atomic>
+#include <mutex>
+#include <cstdint>
+#include <cstddef>
+#include <iostream>
+
+// 고정 크기 객체 풀 (IOContext, 연결 상태 등 접속/해제마다 new/delete 하던 객체용)
+//  - 객체는 슬랩(SLOTS_PER_SLAB개 묶음) 단위로 한 번에 만들고 프로그램 끝까지 재사용
+//    (반납해도 소멸시키지 않으므로 안의 vector 등도 capacity를 유지 - 받은 쪽에서 상태를 초기화)
+//  - 전역 free list는 lock-free 스택 (인덱스 + ABA 방지 태그를 64bit 하나로 CAS)
+//  - 스레드별 캐시(CACHE_SIZE개)에서 먼저 꺼내고 넣으므로 보통은 원자 연산도 없음
+//  - 슬롯은 캐시 라인(64B) 정렬 - 다른 스레드가 쓰는 이웃 객체와 false sharing 없음
+//  - 슬랩이 모자랄 때만 힙 할당 (Reserve로 미리 만들어 두면 접속 폭주 중에도 힙을 건드리지 않음)
+// 타입별 싱글턴: SlabPool<IOContext>::Instance()
+template<typename T, int SLOTS_PER_SLAB = 256>
+class SlabPool {
+public:
+    struct Stats {
+        uint64_t slabCount;        // 만들어진 슬랩 수
+        uint64_t capacity;         // 전체 슬롯 수
+        int64_t inUse;             // 현재 빌려간 객체 수
+        uint64_t allocations;      // 전체 Allocate 횟수
+        uint64_t cacheMisses;      // 스레드 캐시가 비어 전역 free list를 사용한 횟수
+        uint64_t slabAllocations;  // 힙에서 슬랩을 새로 만든 횟수 (Reserve 이후에도 늘면 예약이 부족)
+    };
+
+    static SlabPool& Instance() {
+        static SlabPool pool;
+        return pool;
+    }
+
+    // 최소 count개의 객체를 미리 만들어 둠
+    void Reserve(size_t count) {
+        while (m_slabCount.load(std::memory_order_acquire) * SLOTS_PER_SLAB < count) {
+            if (!Grow()) break;
+        }
+    }
+
+    T* Allocate() {
+        m_allocations.fetch_add(1, std::memory_order_relaxed);
+        m_inUse.fetch_add(1, std::memory_order_relaxed);
+
+        LocalCache& cache = GetLocalCache();
+        if (cache.count == 0) {
+            m_cacheMisses.fetch_add(1, std::memory_order_relaxed);
+            // 전역에서 캐시 절반만큼 한 번에 가져옴
+            while (cache.count < CACHE_SIZE / 2) {
+                uint32_t index = PopGlobal();
+                if (index == NIL) {
+                    if (cache.count > 0 || !Grow()) break;
+                    continue;
+                }
+                cache.items[cache.count++] = index;
+            }
+            if (cache.count == 0) {
+                m_inUse.fetch_sub(1, std::memory_order_relaxed);
+                return nullptr;
+            }
+        }
+        return &GetSlot(cache.items[--cache.count])->object;
+    }
+
+    void Free(T* object) {
+        if (!object) return;
+        m_inUse.fetch_sub(1, std::memory_order_relaxed);
+
+        Slot* slot = reinterpret_cast<Slot*>(object);   // object는 Slot의 첫 멤버
+        LocalCache& cache = GetLocalCache();
+        if (cache.count == CACHE_SIZE) {
+            // 캐시가 가득 차면 절반을 전역으로 반납 (다른 스레드에서 할당된 객체가 몰리는 경우)
+            while (cache.count > CACHE_SIZE / 2) {
+                PushGlobal(cache.items[--cache.count]);
+            }
+        }
+        cache.items[cache.count++] = slot->index;
+    }
+
+    Stats GetStats() const {
+        Stats stats;
+        stats.slabCount = m_slabCount.load(std::memory_order_relaxed);
+        stats.capacity = stats.slabCount * SLOTS_PER_SLAB;
+        stats.inUse = m_inUse.load(std::memory_order_relaxed);
+        stats.allocations = m_allocations.load(std::memory_order_relaxed);
+        stats.cacheMisses = m_cacheMisses.load(std::memory_order_relaxed);
+        stats.slabAllocations = m_slabAllocations.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+    void LogStats(const char* name) const {
+        Stats stats = GetStats();
+        std::cout << "[Pool] " << name << ": in use " << stats.inUse << "/" << stats.capacity
+                  << ", allocations " << stats.allocations << ", cache misses " << stats.cacheMisses
+                  << ", slabs " << stats.slabCount << " (" << sizeof(Slot) << " B/slot)" << std::endl;
+    }
+
+private:
+    static constexpr size_t CACHE_LINE = 64;
+    static constexpr int CACHE_SIZE = 32;
+    static constexpr int MAX_SLABS = 1024;
+    static constexpr uint32_t NIL = 0xFFFFFFFFu;
+
+    struct alignas(CACHE_LINE) Slot {
+        T object;                       // 반드시 첫 멤버 (Free에서 T* -> Slot*)
+        uint32_t index;
+        std::atomic<uint32_t> next;     // 전역 free list 링크
+    };
+
+    struct LocalCache {
+        uint32_t items[CACHE_SIZE];
+        int count = 0;
+
+        ~LocalCache() {
+            // 스레드 종료 시 남은 객체를 전역으로 반납
+            SlabPool& pool = SlabPool::Instance();
+            while (count > 0) {
+                pool.PushGlobal(items[--count]);
+            }
+        }
+    };
+
+    SlabPool()
+        : m_head(NIL)
+        , m_slabCount(0)
+        , m_inUse(0)
+        , m_allocations(0)
+        , m_cacheMisses(0)
+        , m_slabAllocations(0)
+    {
+        for (int i = 0; i < MAX_SLABS; ++i) {
+            m_slabs[i].store(nullptr, std::memory_order_relaxed);
+        }
+    }
+
+    ~SlabPool() {
+        for (int i = 0; i < MAX_SLABS; ++i) {
+            delete[] m_slabs[i].load(std::memory_order_relaxed);
+        }
+    }
+
+    SlabPool(const SlabPool&) = delete;
+    SlabPool& operator=(const SlabPool&) = delete;
+
+    static LocalCache& GetLocalCache() {
+        thread_local LocalCache cache;
+        return cache;
+    }
+
+    Slot* GetSlot(uint32_t index) const {
+        return &m_slabs[index / SLOTS_PER_SLAB].load(std::memory_order_acquire)[index % SLOTS_PER_SLAB];
+    }
+
+    uint32_t PopGlobal() {
+        uint64_t head = m_head.load(std::memory_order_acquire);
+        for (;;) {
+            uint32_t index = static_cast<uint32_t>(head);
+            if (index == NIL) {
+                return NIL;
+            }
+            uint32_t next = GetSlot(index)->next.load(std::memory_order_relaxed);
+            uint64_t newHead = ((head >> 32) + 1) << 32 | next;
+            if (m_head.compare_exchange_weak(head, newHead, std::memory_order_acq_rel, std::memory_order_acquire)) {
+                return index;
+            }
+        }
+    }
+
+    // first..last 로 이미 연결된 사슬을 한 번에 넣음
+    void PushGlobalChain(uint32_t first, uint32_t last) {
+        uint64_t head = m_head.load(std::memory_order_relaxed);
+        for (;;) {
+            GetSlot(last)->next.store(static_cast<uint32_t>(head), std::memory_order_relaxed);
+            uint64_t newHead = ((head >> 32) + 1) << 32 | first;
+            if (m_head.compare_exchange_weak(head, newHead, std::memory_order_release, std::memory_order_relaxed)) {
+                return;
+            }
+        }
+    }
+
+    void PushGlobal(uint32_t index) { PushGlobalChain(index, index); }
+
+    bool Grow() {
+        std::lock_guard<std::mutex> lock(m_growMutex);
+        uint32_t slabIndex = static_cast<uint32_t>(m_slabCount.load(std::memory_order_relaxed));
+        if (slabIndex >= MAX_SLABS) {
+            std::cout << "[Error] SlabPool exhausted (" << MAX_SLABS * SLOTS_PER_SLAB << " objects)" << std::endl;
+            return false;
+        }
+
+        Slot* slab = new Slot[SLOTS_PER_SLAB];
+        uint32_t base = slabIndex * SLOTS_PER_SLAB;
+        for (int i = 0; i < SLOTS_PER_SLAB; ++i) {
+            slab[i].index = base + i;
+            slab[i].next.store(i + 1 < SLOTS_PER_SLAB ? base + i + 1 : NIL, std::memory_order_relaxed);
+        }
+        m_slabs[slabIndex].store(slab, std::memory_order_release);
+        m_slabCount.store(slabIndex + 1, std::memory_order_release);
+        m_slabAllocations.fetch_add(1, std::memory_order_relaxed);
+
+        PushGlobalChain(base, base + SLOTS_PER_SLAB - 1);
+        return true;
+    }
+
+    alignas(CACHE_LINE) std::atomic<uint64_t> m_head;   // [tag 32bit][index 32bit]
+    std::atomic<Slot*> m_slabs[MAX_SLABS];
+    std::atomic<uint64_t> m_slabCount;
+    std::mutex m_growMutex;
+
+    alignas(CACHE_LINE) std::atomic<int64_t> m_inUse;
+    std::atomic<uint64_t> m_allocations;
+    std::atomic<uint64_t> m_cacheMisses;
+    std::atomic<uint64_t> m_slabAllocations;
+};
@@ -0,0 +1,112 @@
+#pragma once
+#include "Platform.h"
+#include <vector>
+#include <cstdint>
+
+// SOCKET -> 값 (open addressing, 선형 탐사)
+// unordered_map과 달리 삽입마다 노드를 힙에 할당하지 않는다. 용량은 Reserve로 미리 잡고,
+// 사용량이 절반을 넘을 때만 두 배로 재해시한다.
+// 스레드 안전하지 않음 - 백엔드의 락 안에서 사용
+template<typename V>
+class SocketMap {
+public:
+    SocketMap() : m_size(0), m_used(0) { Rehash(64); }
+
+    void Reserve(size_t count) {
+        size_t capacity = m_entries.size();
+        while (capacity < count * 2) capacity *= 2;
+        if (capacity != m_entries.size()) Rehash(capacity);
+    }
+
+    void Insert(SOCKET key, const V& value) {
+        if ((m_used + 1) * 2 > m_entries.size()) {
+            Rehash(m_size * 2 >= m_entries.size() / 2 ? m_entries.size() * 2 : m_entries.size());
+        }
+        size_t mask = m_entries.size() - 1;
+        size_t tombstone = SIZE_MAX;
+        for (size_t i = Hash(key) & mask;; i = (i + 1) & mask) {
+            Entry& entry = m_entries[i];
+            if (entry.state == FULL && entry.key == key) {
+                entry.value = value;
+                return;
+            }
+            if (entry.state == DELETED && tombstone == SIZE_MAX) {
+                tombstone = i;
+            } else if (entry.state == EMPTY) {
+                Entry& target = tombstone != SIZE_MAX ? m_entries[tombstone] : entry;
+                if (&target == &entry) ++m_used;
+                target = { key, value, FULL };
+                ++m_size;
+                return;
+            }
+        }
+    }
+
+    V* Find(SOCKET key) {
+        Entry* entry = FindEntry(key);
+        return entry ? &entry->value : nullptr;
+    }
+
+    bool Erase(SOCKET key) {
+        Entry* entry = FindEntry(key);
+        if (!entry) return false;
+        entry->state = DELETED;
+        entry->value = V();
+        --m_size;
+        return true;
+    }
+
+    template<typename Func>
+    void ForEach(Func&& func) {
+        for (Entry& entry : m_entries) {
+            if (entry.state == FULL) func(entry.key, entry.value);
+        }
+    }
+
+    void Clear() {
+        for (Entry& entry : m_entries) entry = Entry();
+        m_size = 0;
+        m_used = 0;
+    }
+
+    size_t Size() const { return m_size; }
+
+private:
+    enum State : uint8_t { EMPTY, FULL, DELETED };
+
+    struct Entry {
+        SOCKET key = INVALID_SOCKET;
+        V value = V();
+        State state = EMPTY;
+    };
+
+    static size_t Hash(SOCKET key) {
+        // Windows 소켓 핸들은 4의 배수, Linux fd는 작은 연속 정수 - 섞어서 분산
+        uint64_t h = static_cast<uint64_t>(key) * 0x9E3779B97F4A7C15ull;
+        return static_cast<size_t>(h >> 32);
+    }
+
+    Entry* FindEntry(SOCKET key) {
+        size_t mask = m_entries.size() - 1;
+        for (size_t i = Hash(key) & mask;; i = (i + 1) & mask) {
+            Entry& entry = m_entries[i];
+            if (entry.state == EMPTY) return nullptr;
+            if (entry.state == FULL && entry.key == key) return &entry;
+        }
+    }
+
+    void Rehash(size_t capacity) {
+        std::vector<Entry> old;
+        old.swap(m_entries);
+        m_entries.assign(capacity, Entry());
+        m_size = 0;
+        m_used = 0;
+        for (Entry& entry : old) {
+            if (entry.state == FULL) Insert(entry.key, entry.value);
+        }
+    }
+
+    std::vector<Entry> m_entries;   // 크기는 항상 2의 거듭제곱
+    size_t m_size;                  // FULL 개수
+    size_t m_used;                  // FULL + DELETED 개수 (탐사 길이 관리)
+};
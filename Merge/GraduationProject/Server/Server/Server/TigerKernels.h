@@ -0,0 +1,362 @@
+#pragma once
+#include <cmath>
+#include <cstdint>
+#include <cfloat>
+#include <algorithm>
+#include "TigerPool.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define TIGER_SIMD_WIDTH 8
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define TIGER_SIMD_WIDTH 4
+#else
+#define TIGER_SIMD_WIDTH 1
+#endif
+
+// 호랑이 AI 틱의 필드 단위 계산 (TigerPool 배열의 [begin, end) 구간을 한 번에)
+//  - 구간 경계는 TIGER_SIMD_LANES 의 배수 (잡 시스템이 구간을 나눠 워커마다 실행)
+//  - 빌드 옵션에 따라 AVX2(8칸) / SSE2(4칸), 그 밖의 CPU 는 스칼라 참조 구현 (...Scalar)
+//  - SIMD 판도 나눗셈/제곱근을 그대로 쓰고 연산 순서가 같으므로 스칼라 판과 비트 단위로 같은 결과
+//  - 상태 전이/애니메이션/무작위 배회처럼 분기가 많은 부분은 TigerStateMachine 이 상태별로 처리
+
+constexpr float TIGER_MIN_MOVE_DIST = 0.1f;   // 목표까지 이보다 가까우면 멈춤
+
+// atan2(dx, dz) 를 도 단위로 (rotY). Cephes atanf 다항식 - 상대 오차 약 1e-7 로 yaw 양자화 단위(0.0055도)보다 훨씬 작음
+// 분기 대신 선택만 쓰는 형태라 SIMD 판(TigerSimd::YawDegrees)과 같은 순서로 계산
+constexpr float TIGER_TAN_PI_8 = 0.414213562f;
+constexpr float TIGER_PI = 3.14159265f;
+
+inline float TigerYawDegrees(float dx, float dz) {
+    float ax = std::fabs(dx), az = std::fabs(dz);
+    float lo = std::min(ax, az), hi = std::max(ax, az);
+    float a = hi > 0.0f ? lo / hi : 0.0f;
+    bool reduce = a > TIGER_TAN_PI_8;   // tan(pi/8) 보다 크면 atan(a) = pi/4 + atan((a - 1) / (a + 1))
+    float b = reduce ? (a - 1.0f) / (a + 1.0f) : a;
+    float s = b * b;
+    float r = (((8.05374449538e-2f * s - 1.38776856032e-1f) * s + 1.99777106478e-1f) * s - 3.33329491539e-1f) * s * b + b;
+    r = r + (reduce ? TIGER_PI * 0.25f : 0.0f);
+    r = az < ax ? TIGER_PI * 0.5f - r : r;
+    r = dz < 0.0f ? TIGER_PI - r : r;
+    r = dx < 0.0f ? -r : r;
+    return r * (180.0f / TIGER_PI);
+}
+
+// 타이머 진행 (moveTimer 는 줄고 나머지는 늘어남)
+// 반복 재생 클립은 끝을 넘으면 길이만큼 되감아 클라이언트와 같은 구간을 가리킴 (clipDuration = 지난 틱의 클립 길이)
+inline void TigerAdvanceTimersScalar(TigerPool& pool, float deltaTime, int begin, int end) {
+    for (int i = begin; i < end; ++i) {
+        pool.moveTimer[i] -= deltaTime;
+        pool.animationTime[i] += deltaTime;
+        float duration = pool.clipDuration[i];
+        if (duration > 0.0f && pool.animationTime[i] >= duration) {
+            pool.animationTime[i] -= duration;
+        }
+        pool.attackTime[i] += deltaTime;
+        pool.searchTime[i] += deltaTime;
+        pool.elapseTime[i] += deltaTime;
+    }
+}
+
+// 가장 가까운 플레이어 거리 구간을 상태 전이 이벤트로 (TigerBehavior.h)
+static_assert(TIGER_EVENT_NO_TARGET == 0 && TIGER_EVENT_TARGET_IN_CHASE == 1 && TIGER_EVENT_TARGET_IN_ATTACK == 2,
+              "TigerClassifyTargets counts the radii a tiger is inside");
+
+inline void TigerClassifyTargetsScalar(TigerPool& pool, float chaseRadius, float attackRadius, int begin, int end) {
+    const float chaseSq = chaseRadius * chaseRadius;
+    const float attackSq = attackRadius * attackRadius;
+    for (int i = begin; i < end; ++i) {
+        float distSq = pool.playerDistSq[i];
+        pool.event[i] = distSq < attackSq ? TIGER_EVENT_TARGET_IN_ATTACK : (distSq < chaseSq ? TIGER_EVENT_TARGET_IN_CHASE : TIGER_EVENT_NO_TARGET);
+    }
+}
+
+// (steerX, steerZ) 쪽으로 steerSpeed * deltaTime 만큼 이동하고 그쪽을 바라봄 (속도 0 이거나 이미 도착했으면 제자리)
+inline void TigerSteerScalar(TigerPool& pool, float deltaTime, int begin, int end) {
+    for (int i = begin; i < end; ++i) {
+        float dx = pool.steerX[i] - pool.x[i];
+        float dz = pool.steerZ[i] - pool.z[i];
+        float dist = std::sqrt(dx * dx + dz * dz);
+        bool move = pool.steerSpeed[i] > 0.0f && dist > TIGER_MIN_MOVE_DIST;
+        if (move) {
+            pool.x[i] += (dx / dist) * pool.steerSpeed[i] * deltaTime;
+            pool.z[i] += (dz / dist) * pool.steerSpeed[i] * deltaTime;
+            pool.rotY[i] = TigerYawDegrees(dx, dz);   // 이동한 방향을 바라봄
+        }
+        pool.moved[i] = move ? 1 : 0;
+    }
+}
+
+// 위치/방향/애니메이션 시간을 양자화 (QuantizeEntityState 와 같은 값)하고 복원값을 시뮬레이션 상태에 되돌려 씀
+// (다음 틱도 클라이언트가 복원하는 것과 같은 값에서 이어지게). 이동 전 위치와 비교해 이번 틱 속도도 계산
+inline void TigerQuantizeScalar(TigerPool& pool, float deltaTime, int begin, int end) {
+    for (int i = begin; i < end; ++i) {
+        pool.quantX[i] = QuantizePosition(pool.x[i]);
+        pool.quantZ[i] = QuantizePosition(pool.z[i]);
+        pool.quantYaw[i] = QuantizeYaw(pool.rotY[i]);
+        pool.quantAnimTime[i] = QuantizeAnimTime(pool.animationTime[i], pool.clipDuration[i]);
+        pool.x[i] = DequantizePosition(pool.quantX[i]);
+        pool.z[i] = DequantizePosition(pool.quantZ[i]);
+        pool.rotY[i] = DequantizeYaw(pool.quantYaw[i]);
+        pool.animationTime[i] = DequantizeAnimTime(pool.quantAnimTime[i], pool.clipDuration[i]);
+        float dx = pool.x[i] - pool.prevX[i], dz = pool.z[i] - pool.prevZ[i];
+        pool.speed[i] = std::sqrt(dx * dx + dz * dz) / deltaTime;
+    }
+}
+
+// 호랑이 tigerCount 마리 (tigerX, tigerZ: TIGER_SIMD_LANES 배수까지 패딩) 각각에 대해 후보 (candX, candZ: candCount 개) 중 가장 가까운 것
+// outDistSq = 거리 제곱 (후보가 없으면 FLT_MAX), outIndex = 후보 인덱스 (없으면 -1, 거리가 같으면 앞 후보). 패딩 칸 결과는 버림
+inline void TigerNearestCandidatesScalar(const float* tigerX, const float* tigerZ, int tigerCount,
+                                         const float* candX, const float* candZ, int candCount, float* outDistSq, int* outIndex) {
+    for (int t = 0; t < tigerCount; ++t) {
+        float best = FLT_MAX;
+        int bestIndex = -1;
+        for (int c = 0; c < candCount; ++c) {
+            float dx = candX[c] - tigerX[t];
+            float dz = candZ[c] - tigerZ[t];
+            float distSq = dx * dx + dz * dz;
+            if (distSq < best) {
+                best = distSq;
+                bestIndex = c;
+            }
+        }
+        outDistSq[t] = best;
+        outIndex[t] = bestIndex;
+    }
+}
+
+#if TIGER_SIMD_WIDTH > 1
+
+namespace TigerSimd {
+#if TIGER_SIMD_WIDTH == 8
+    using Float = __m256;
+    inline Float Load(const float* p) { return _mm256_loadu_ps(p); }
+    inline void Store(float* p, Float v) { _mm256_storeu_ps(p, v); }
+    inline Float Splat(float v) { return _mm256_set1_ps(v); }
+    inline Float Add(Float a, Float b) { return _mm256_add_ps(a, b); }
+    inline Float Sub(Float a, Float b) { return _mm256_sub_ps(a, b); }
+    inline Float Mul(Float a, Float b) { return _mm256_mul_ps(a, b); }
+    inline Float Div(Float a, Float b) { return _mm256_div_ps(a, b); }
+    inline Float Sqrt(Float a) { return _mm256_sqrt_ps(a); }
+    inline Float Less(Float a, Float b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+    inline Float Greater(Float a, Float b) { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+    inline Float And(Float a, Float b) { return _mm256_and_ps(a, b); }
+    inline Float Or(Float a, Float b) { return _mm256_or_ps(a, b); }
+    inline int Mask(Float a) { return _mm256_movemask_ps(a); }
+    inline Float Min(Float a, Float b) { return _mm256_min_ps(a, b); }
+    inline Float Max(Float a, Float b) { return _mm256_max_ps(a, b); }
+    inline Float Abs(Float a) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a); }
+    inline Float Select(Float mask, Float a, Float b) { return _mm256_blendv_ps(b, a, mask); }
+    using Int = __m256i;
+    inline Int IntSplat(int v) { return _mm256_set1_epi32(v); }
+    inline Int IntAdd(Int a, Int b) { return _mm256_add_epi32(a, b); }
+    inline Int Select(Float mask, Int a, Int b) { return _mm256_blendv_epi8(b, a, _mm256_castps_si256(mask)); }
+    inline void StoreInt(int* p, Int v) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v); }
+    inline Int Truncate(Float a) { return _mm256_cvttps_epi32(a); }
+    inline Float ToFloat(Int a) { return _mm256_cvtepi32_ps(a); }
+    inline Int IntAnd(Int a, Int b) { return _mm256_and_si256(a, b); }
+    inline Float Equal(Float a, Float b) { return _mm256_cmp_ps(a, b, _CMP_EQ_OQ); }
+    inline Float LessEqual(Float a, Float b) { return _mm256_cmp_ps(a, b, _CMP_LE_OQ); }
+    inline Float GreaterEqual(Float a, Float b) { return _mm256_cmp_ps(a, b, _CMP_GE_OQ); }
+#else
+    using Float = __m128;
+    inline Float Load(const float* p) { return _mm_loadu_ps(p); }
+    inline void Store(float* p, Float v) { _mm_storeu_ps(p, v); }
+    inline Float Splat(float v) { return _mm_set1_ps(v); }
+    inline Float Add(Float a, Float b) { return _mm_add_ps(a, b); }
+    inline Float Sub(Float a, Float b) { return _mm_sub_ps(a, b); }
+    inline Float Mul(Float a, Float b) { return _mm_mul_ps(a, b); }
+    inline Float Div(Float a, Float b) { return _mm_div_ps(a, b); }
+    inline Float Sqrt(Float a) { return _mm_sqrt_ps(a); }
+    inline Float Less(Float a, Float b) { return _mm_cmplt_ps(a, b); }
+    inline Float Greater(Float a, Float b) { return _mm_cmpgt_ps(a, b); }
+    inline Float And(Float a, Float b) { return _mm_and_ps(a, b); }
+    inline Float Or(Float a, Float b) { return _mm_or_ps(a, b); }
+    inline int Mask(Float a) { return _mm_movemask_ps(a); }
+    inline Float Min(Float a, Float b) { return _mm_min_ps(a, b); }
+    inline Float Max(Float a, Float b) { return _mm_max_ps(a, b); }
+    inline Float Abs(Float a) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), a); }
+    inline Float Select(Float mask, Float a, Float b) { return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b)); }
+    using Int = __m128i;
+    inline Int IntSplat(int v) { return _mm_set1_epi32(v); }
+    inline Int IntAdd(Int a, Int b) { return _mm_add_epi32(a, b); }
+    inline Int Select(Float mask, Int a, Int b) {
+        __m128i m = _mm_castps_si128(mask);
+        return _mm_or_si128(_mm_and_si128(m, a), _mm_andnot_si128(m, b));
+    }
+    inline void StoreInt(int* p, Int v) { _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v); }
+    inline Int Truncate(Float a) { return _mm_cvttps_epi32(a); }
+    inline Float ToFloat(Int a) { return _mm_cvtepi32_ps(a); }
+    inline Int IntAnd(Int a, Int b) { return _mm_and_si128(a, b); }
+    inline Float Equal(Float a, Float b) { return _mm_cmpeq_ps(a, b); }
+    inline Float LessEqual(Float a, Float b) { return _mm_cmple_ps(a, b); }
+    inline Float GreaterEqual(Float a, Float b) { return _mm_cmpge_ps(a, b); }
+#endif
+    constexpr int WIDTH = TIGER_SIMD_WIDTH;
+    static_assert(TIGER_SIMD_LANES % WIDTH == 0, "Pool padding must be a multiple of the SIMD width");
+
+    // TigerYawDegrees 와 같은 계산
+    inline Float YawDegrees(Float dx, Float dz) {
+        const Float zero = Splat(0.0f);
+        const Float one = Splat(1.0f);
+        Float ax = Abs(dx), az = Abs(dz);
+        Float lo = Min(ax, az), hi = Max(ax, az);
+        Float a = And(Greater(hi, zero), Div(lo, hi));   // hi 가 0 이면 NaN 대신 0
+        Float reduce = Greater(a, Splat(TIGER_TAN_PI_8));
+        Float b = Select(reduce, Div(Sub(a, one), Add(a, one)), a);
+        Float s = Mul(b, b);
+        Float r = Sub(Mul(Splat(8.05374449538e-2f), s), Splat(1.38776856032e-1f));
+        r = Add(Mul(r, s), Splat(1.99777106478e-1f));
+        r = Sub(Mul(r, s), Splat(3.33329491539e-1f));
+        r = Add(Mul(Mul(r, s), b), b);
+        r = Add(r, And(reduce, Splat(TIGER_PI * 0.25f)));
+        r = Select(Less(az, ax), Sub(Splat(TIGER_PI * 0.5f), r), r);
+        r = Select(Less(dz, zero), Sub(Splat(TIGER_PI), r), r);
+        r = Select(Less(dx, zero), Sub(zero, r), r);
+        return Mul(r, Splat(180.0f / TIGER_PI));
+    }
+}
+
+inline void TigerAdvanceTimers(TigerPool& pool, float deltaTime, int begin, int end) {
+    using namespace TigerSimd;
+    const Float dt = Splat(deltaTime);
+    const Float zero = Splat(0.0f);
+    for (int i = begin; i < end; i += WIDTH) {
+        Store(&pool.moveTimer[i], Sub(Load(&pool.moveTimer[i]), dt));
+        Float time = Add(Load(&pool.animationTime[i]), dt);
+        Float duration = Load(&pool.clipDuration[i]);
+        Float wrap = And(Greater(duration, zero), GreaterEqual(time, duration));
+        Store(&pool.animationTime[i], Select(wrap, Sub(time, duration), time));
+        Store(&pool.attackTime[i], Add(Load(&pool.attackTime[i]), dt));
+        Store(&pool.searchTime[i], Add(Load(&pool.searchTime[i]), dt));
+        Store(&pool.elapseTime[i], Add(Load(&pool.elapseTime[i]), dt));
+    }
+}
+
+inline void TigerClassifyTargets(TigerPool& pool, float chaseRadius, float attackRadius, int begin, int end) {
+    using namespace TigerSimd;
+    const Float chaseSq = Splat(chaseRadius * chaseRadius);
+    const Float attackSq = Splat(attackRadius * attackRadius);
+    for (int i = begin; i < end; i += WIDTH) {
+        Float distSq = Load(&pool.playerDistSq[i]);
+        int chase = Mask(Less(distSq, chaseSq));
+        int attack = Mask(Less(distSq, attackSq));
+        for (int lane = 0; lane < WIDTH; ++lane) {
+            pool.event[i + lane] = static_cast<uint8_t>(((chase >> lane) & 1) + ((attack >> lane) & 1));
+        }
+    }
+}
+
+inline void TigerSteer(TigerPool& pool, float deltaTime, int begin, int end) {
+    using namespace TigerSimd;
+    const Float dt = Splat(deltaTime);
+    const Float zero = Splat(0.0f);
+    const Float minDist = Splat(TIGER_MIN_MOVE_DIST);
+    for (int i = begin; i < end; i += WIDTH) {
+        Float x = Load(&pool.x[i]);
+        Float z = Load(&pool.z[i]);
+        Float speed = Load(&pool.steerSpeed[i]);
+        Float dx = Sub(Load(&pool.steerX[i]), x);
+        Float dz = Sub(Load(&pool.steerZ[i]), z);
+        Float dist = Sqrt(Add(Mul(dx, dx), Mul(dz, dz)));
+        Float move = And(Greater(speed, zero), Greater(dist, minDist));
+        // 멈춘 칸은 dist 가 0 일 수 있으므로 (NaN) 마스크로 이동량을 0 으로 만듦
+        Store(&pool.x[i], Add(x, And(move, Mul(Mul(Div(dx, dist), speed), dt))));
+        Store(&pool.z[i], Add(z, And(move, Mul(Mul(Div(dz, dist), speed), dt))));
+        Store(&pool.rotY[i], Select(move, YawDegrees(dx, dz), Load(&pool.rotY[i])));
+        int moved = Mask(move);
+        for (int lane = 0; lane < WIDTH; ++lane) {
+            pool.moved[i + lane] = static_cast<uint8_t>((moved >> lane) & 1);
+        }
+    }
+}
+
+inline void TigerQuantize(TigerPool& pool, float deltaTime, int begin, int end) {
+    // Quantize.h 의 함수와 같은 연산을 같은 순서로 (정수 변환은 모두 양수 범위라 int32 절삭과 같음)
+    using namespace TigerSimd;
+    const Float zero = Splat(0.0f);
+    const Float one = Splat(1.0f);
+    const Float half = Splat(0.5f);
+    const Float positionMax = Splat(static_cast<float>(QuantMask(QUANT_POSITION_BITS)));
+    const Int positionMaxInt = IntSplat(static_cast<int>(QuantMask(QUANT_POSITION_BITS)));
+    const Float yawScale = Splat(QuantMask(QUANT_YAW_BITS) + 1.0f);
+    const Int yawMask = IntSplat(static_cast<int>(QuantMask(QUANT_YAW_BITS)));
+    const Float animScale = Splat(QuantMask(QUANT_ANIM_TIME_BITS) + 1.0f);
+    const Int animMask = IntSplat(static_cast<int>(QuantMask(QUANT_ANIM_TIME_BITS)));
+    const Float dt = Splat(deltaTime);
+
+    auto quantizePosition = [&](Float value) {
+        Float t = Div(Sub(value, Splat(QUANT_WORLD_MIN)), Splat(QUANT_WORLD_MAX - QUANT_WORLD_MIN));
+        Int q = Truncate(Add(Mul(t, positionMax), half));
+        q = Select(GreaterEqual(t, one), positionMaxInt, q);   // 월드 밖은 경계로 고정
+        return Select(LessEqual(t, zero), IntSplat(0), q);
+    };
+    auto dequantizePosition = [&](Int q) {
+        return Add(Splat(QUANT_WORLD_MIN), Mul(ToFloat(q), Splat(QUANT_POSITION_STEP)));
+    };
+
+    for (int i = begin; i < end; i += WIDTH) {
+        Int qx = quantizePosition(Load(&pool.x[i]));
+        Int qz = quantizePosition(Load(&pool.z[i]));
+
+        Float turns = Div(Load(&pool.rotY[i]), Splat(360.0f));
+        turns = Sub(turns, ToFloat(Truncate(turns)));
+        turns = Add(turns, And(Less(turns, zero), one));
+        Int qyaw = IntAnd(Truncate(Add(Mul(turns, yawScale), half)), yawMask);
+
+        Float time = Load(&pool.animationTime[i]);
+        Float duration = Load(&pool.clipDuration[i]);
+        Float ratio = Min(Div(time, duration), one);
+        Int qanim = IntAnd(Truncate(Add(Mul(ratio, animScale), half)), animMask);
+        qanim = Select(Or(LessEqual(duration, zero), LessEqual(time, zero)), IntSplat(0), qanim);
+
+        StoreInt(reinterpret_cast<int*>(&pool.quantX[i]), qx);
+        StoreInt(reinterpret_cast<int*>(&pool.quantZ[i]), qz);
+        StoreInt(reinterpret_cast<int*>(&pool.quantYaw[i]), qyaw);
+        StoreInt(reinterpret_cast<int*>(&pool.quantAnimTime[i]), qanim);
+
+        Float x = dequantizePosition(qx);
+        Float z = dequantizePosition(qz);
+        Store(&pool.x[i], x);
+        Store(&pool.z[i], z);
+        Store(&pool.rotY[i], Mul(ToFloat(qyaw), Splat(QUANT_YAW_STEP)));
+        Store(&pool.animationTime[i], Mul(Mul(ToFloat(qanim), Splat(QUANT_ANIM_TIME_STEP)), duration));
+        Float dx = Sub(x, Load(&pool.prevX[i]));
+        Float dz = Sub(z, Load(&pool.prevZ[i]));
+        Store(&pool.speed[i], Div(Sqrt(Add(Mul(dx, dx), Mul(dz, dz))), dt));
+    }
+}
+
+inline void TigerNearestCandidates(const float* tigerX, const float* tigerZ, int tigerCount,
+                                   const float* candX, const float* candZ, int candCount, float* outDistSq, int* outIndex) {
+    // 호랑이 WIDTH 마리를 한 레지스터에 두고 후보를 하나씩 펼쳐 비교 (칸끼리 비교하는 마무리 없음)
+    using namespace TigerSimd;
+    for (int t = 0; t < tigerCount; t += WIDTH) {
+        const Float x = Load(tigerX + t), z = Load(tigerZ + t);
+        Float best = Splat(FLT_MAX);
+        Int bestIndex = IntSplat(-1);
+        for (int c = 0; c < candCount; ++c) {
+            Float dx = Sub(Splat(candX[c]), x);
+            Float dz = Sub(Splat(candZ[c]), z);
+            Float distSq = Add(Mul(dx, dx), Mul(dz, dz));
+            bestIndex = Select(Less(distSq, best), IntSplat(c), bestIndex);
+            best = Min(distSq, best);
+        }
+        Store(outDistSq + t, best);
+        StoreInt(outIndex + t, bestIndex);
+    }
+}
+
+#else
+
+inline void TigerNearestCandidates(const float* tigerX, const float* tigerZ, int tigerCount,
+                                   const float* candX, const float* candZ, int candCount, float* outDistSq, int* outIndex) {
+    TigerNearestCandidatesScalar(tigerX, tigerZ, tigerCount, candX, candZ, candCount, outDistSq, outIndex);
+}
+inline void TigerAdvanceTimers(TigerPool& pool, float deltaTime, int begin, int end) { TigerAdvanceTimersScalar(pool, deltaTime, begin, end); }
+inline void TigerClassifyTargets(TigerPool& pool, float chaseRadius, float attackRadius, int begin, int end) { TigerClassifyTargetsScalar(pool, chaseRadius, attackRadius, begin, end); }
+inline void TigerSteer(TigerPool& pool, float deltaTime, int begin, int end) { TigerSteerScalar(pool, deltaTime, begin, end); }
+inline void TigerQuantize(TigerPool& pool, float deltaTime, int begin, int end) { TigerQuantizeScalar(pool, deltaTime, begin, end); }
+
+#endif
@@ -0,0 +1,103 @@
+#pragma once
+#include <vector>
+#include <array>
+#include <cstdint>
+#include <algorithm>
+#include <cfloat>
+#include <initializer_list>
+#include "Packet.h"
+#include "../../../Common/TigerBehavior.h"   // 클라이언트와 공용 호랑이 행동 표
+
+// 호랑이 AI 상태 (호랑이 하나 = 구조체가 아니라 필드별 배열에 같은 인덱스로 저장 - SoA)
+//  - 틱마다 모든 호랑이를 훑는 위치/타이머/목표가 각각 연속이라 TigerKernels.h 가 SIMD 로 한 번에 처리
+//  - 인덱스 = 추가 순서 = ID 오름차순 (ID 는 1부터 차례로 발급) -> ID 로 찾기는 이분 탐색
+//  - 배열 길이는 TIGER_SIMD_LANES 의 배수로 패딩 (커널이 나머지 처리 없이 끝까지 돎, 패딩 칸은 움직이지 않음)
+
+constexpr int TIGER_SIMD_LANES = 8;   // AVX2 한 레지스터 (SSE 는 두 번)
+
+struct TigerPool {
+    // 호랑이 상태
+    std::vector<int> id;
+    std::vector<float> x, z;
+    std::vector<float> rotY;
+    std::vector<float> targetX, targetZ;   // 배회 목표 위치
+    std::vector<float> moveTimer;          // 이동 타이머
+    std::vector<float> animationTime;      // 애니메이션 시간
+    std::vector<float> attackTime;         // 공격 타이머 (원본과 동일)
+    std::vector<float> searchTime;         // 탐색 타이머
+    std::vector<float> elapseTime;         // 애니메이션 경과 시간
+    std::vector<float> speed;              // 이번 틱 이동 속도 (우선순위 계산용)
+    std::vector<uint8_t> state;            // TigerState (TigerBehavior.h)
+    std::vector<AnimationClipID> animation;   // 현재 애니메이션 클립 (공용 클립 테이블 ID)
+    std::vector<float> clipDuration;       // 그 클립 길이 (되감기 / 애니메이션 시간 양자화용)
+    std::vector<uint8_t> isFired;          // 공격 발사 여부
+    std::vector<QuantizedEntityState> quantized;   // 이번 틱에 클라이언트로 보내는 양자화 상태
+    std::vector<std::array<uint8_t, QUANT_ENTITY_STATE_BYTES>> encoded;   // quantized 인코딩 (부트스트랩이 그대로 복사)
+
+    // 틱 안에서만 쓰는 값 (단계 사이 전달용)
+    std::vector<float> playerX, playerZ;   // 가장 가까운 플레이어 위치
+    std::vector<float> playerDistSq;       // 그 거리 제곱 (추격 반경 안에 없으면 FLT_MAX)
+    std::vector<uint8_t> event;            // 그 거리 구간 (TigerEvent - 상태 전이 입력)
+    std::vector<float> steerX, steerZ;     // 이번 틱 이동 목표
+    std::vector<float> steerSpeed;         // 이동 속도 (0 = 이동 안 함)
+    std::vector<uint8_t> moved;            // 이번 틱에 이동했는지
+    std::vector<uint8_t> fired;            // 이번 틱에 발사했는지 (--tiger-scale-bench 가 결과 비교에 사용)
+    std::vector<float> prevX, prevZ;       // 이동 전 위치 (속도 계산용)
+    std::vector<uint32_t> quantX, quantZ, quantYaw, quantAnimTime;   // 양자화 결과 (quantized 로 옮겨 인코딩)
+
+    int Size() const { return m_count; }
+    int PaddedSize() const { return static_cast<int>(x.size()); }
+
+    // 새 호랑이 추가 (ID 는 이전 것보다 커야 함), 인덱스 반환
+    int Add(int tigerID, float posX, float posZ, float yaw, float timer, float wanderX, float wanderZ) {
+        int index = m_count++;
+        Resize((m_count + TIGER_SIMD_LANES - 1) / TIGER_SIMD_LANES * TIGER_SIMD_LANES);
+        id[index] = tigerID;
+        x[index] = posX;
+        z[index] = posZ;
+        rotY[index] = yaw;
+        targetX[index] = wanderX;
+        targetZ[index] = wanderZ;
+        moveTimer[index] = timer;
+        animation[index] = ANIM_CLIP_TIGER_IDLE;
+        clipDuration[index] = GetAnimationClipDuration(ANIM_CLIP_TIGER_IDLE);
+        return index;
+    }
+
+    // ID 로 인덱스 찾기 (없으면 -1)
+    int Find(int tigerID) const {
+        auto end = id.begin() + m_count;
+        auto it = std::lower_bound(id.begin(), end, tigerID);
+        return (it != end && *it == tigerID) ? static_cast<int>(it - id.begin()) : -1;
+    }
+
+    void Clear() {
+        m_count = 0;
+        Resize(0);
+    }
+
+private:
+    void Resize(int size) {
+        // 새 칸은 0 (패딩 칸은 이동 속도 0, 플레이어 거리 FLT_MAX 로 아무 일도 일어나지 않음)
+        for (auto* field : { &x, &z, &rotY, &targetX, &targetZ, &moveTimer, &animationTime, &attackTime, &searchTime,
+                             &elapseTime, &speed, &playerX, &playerZ, &steerX, &steerZ, &steerSpeed,
+                             &prevX, &prevZ, &clipDuration }) {
+            field->resize(size, 0.0f);
+        }
+        for (auto* field : { &quantX, &quantZ, &quantYaw, &quantAnimTime }) {
+            field->resize(size, 0);
+        }
+        playerDistSq.resize(size, FLT_MAX);
+        id.resize(size, 0);
+        state.resize(size, TIGER_STATE_SEARCH);
+        event.resize(size, TIGER_EVENT_NO_TARGET);
+        animation.resize(size, ANIM_CLIP_TIGER_IDLE);
+        isFired.resize(size, 0);
+        moved.resize(size, 0);
+        fired.resize(size, 0);
+        quantized.resize(size);
+        encoded.resize(size);
+    }
+
+    int m_count = 0;
+};
@@ -0,0 +1,198 @@
+#pragma once
+#include <cmath>
+#include <random>
+#include <vector>
+#include "TigerPool.h"
+#include "JobSystem.h"
+
+// TigerBehavior.h 의 상태 표로 TigerPool 의 호랑이 전체를 한 틱 진행
+//  - 전이: 상태 = 전이 표[상태][이벤트] (호랑이마다 표 조회 한 번, 분기 없음)
+//  - 같은 상태의 호랑이를 인덱스 묶음으로 모아 상태마다 한 번에 처리 (상태 분기는 묶음마다 한 번, 묶음 안은 인덱스 순서)
+//  - 표가 정하는 부분(쿨다운 대기, 클립 전환, 이동 목표/속도)은 공통 루프, 상태 고유 동작만 훅으로
+//     enter : 이 상태의 동작이 시작될 때 (클립이 이 상태 클립으로 바뀐 호랑이만, 쿨다운 대기 상태는 쿨다운이 끝난 뒤)
+//     update: 이 상태의 모든 호랑이 (이동 목표를 정하기 전)
+//  - 묶음은 TIGER_STATE_JOB_GRAIN 개씩 잘라 잡 워커들이 나눠 처리 (호랑이마다 자기 칸만 쓰므로 결과는 워커 수와 무관)
+//    훅도 구간별로 여러 워커에서 동시에 불림. 난수처럼 순서가 결과를 바꾸는 훅은 ordered 로 표시 (한 스레드에서 인덱스 순서로)
+
+constexpr int TIGER_STATE_JOB_GRAIN = 1024;   // 잡 하나가 맡는 호랑이 수
+
+struct TigerStateContext {
+    float deltaTime;
+    std::mt19937& random;   // 배회 목표용 (ordered 훅에서만 사용 - 호출 순서가 곧 난수 소비 순서)
+};
+
+using TigerStateHook = void (*)(TigerPool& pool, const int* indices, int count, TigerStateContext& context);
+
+struct TigerStateHooks {
+    TigerStateHook enter;    // 없으면 nullptr
+    TigerStateHook update;
+    bool ordered;            // 훅을 나누지 않고 한 번에 인덱스 순서로 호출
+};
+
+// 상태별 훅 (분기 없는 루프 - 조건은 선택으로)
+namespace TigerStateHookImpl {
+    inline void UpdateSearch(TigerPool& t, const int* indices, int count, TigerStateContext& context) {
+        // 일정 시간마다 새 배회 목표 (난수를 쓰는 드문 경우라 분기)
+        for (int k = 0; k < count; ++k) {
+            const int i = indices[k];
+            if (t.searchTime[i] > TIGER_RETARGET_TIME) {
+                t.searchTime[i] = 0.0f;
+                std::uniform_real_distribution<float> angleRange(0.0f, 360.0f);
+                std::uniform_real_distribution<float> distRange(TIGER_WANDER_MIN_DIST, TIGER_WANDER_MAX_DIST);
+                float angle = angleRange(context.random) * (3.141592f / 180.0f);
+                t.targetX[i] = t.x[i] + cos(angle) * distRange(context.random);
+                t.targetZ[i] = t.z[i] + sin(angle) * distRange(context.random);
+            }
+        }
+    }
+
+    inline void EnterAttack(TigerPool& t, const int* indices, int count, TigerStateContext&) {
+        for (int k = 0; k < count; ++k) {
+            const int i = indices[k];
+            t.elapseTime[i] = 0.0f;   // 발사 시점은 공격 애니메이션 시작부터
+            t.isFired[i] = false;
+        }
+    }
+
+    inline void UpdateAttack(TigerPool& t, const int* indices, int count, TigerStateContext&) {
+        for (int k = 0; k < count; ++k) {
+            const int i = indices[k];
+            t.attackTime[i] = t.attackTime[i] >= TIGER_ATTACK_COOLDOWN ? 0.0f : t.attackTime[i];   // 공격하면 쿨다운 다시 시작
+            // 공격 애니메이션 중 발사 시점이 지나면 발사 (fired = 이번 틱에 발사했는지)
+            const bool fire = !t.isFired[i] && t.animation[i] == ANIM_CLIP_TIGER_ATTACK && t.elapseTime[i] >= TIGER_FIRE_DELAY;
+            t.fired[i] = static_cast<uint8_t>(fire);
+            t.isFired[i] |= static_cast<uint8_t>(fire);
+        }
+    }
+}
+
+inline constexpr TigerStateHooks TIGER_STATE_HOOKS[TIGER_STATE_COUNT] = {
+    /* SEARCH */ { nullptr, TigerStateHookImpl::UpdateSearch, true },
+    /* CHASE  */ { nullptr, nullptr, false },
+    /* ATTACK */ { TigerStateHookImpl::EnterAttack, TigerStateHookImpl::UpdateAttack, false },
+};
+
+class TigerStateMachine {
+public:
+    // 전이 -> 상태별 묶음 -> 클립/훅 -> 이동 목표 (이동 자체는 TigerSteer)
+    void Decide(TigerPool& t, TigerStateContext& context, JobSystem& jobs) {
+        const int size = t.Size();
+        m_entered.resize(jobs.WorkerCount());
+        jobs.ParallelFor(size, TIGER_STATE_JOB_GRAIN, [&](int begin, int end) {
+            for (int i = begin; i < end; ++i) {
+                t.state[i] = NextTigerState(t.state[i], t.event[i]);
+                t.fired[i] = 0;
+            }
+        });
+
+        // 상태별 계수 정렬
+        for (int& start : m_stateStart) start = 0;
+        for (int i = 0; i < size; ++i) {
+            m_stateStart[t.state[i] + 1]++;
+        }
+        for (int state = 1; state <= TIGER_STATE_COUNT; ++state) {
+            m_stateStart[state] += m_stateStart[state - 1];
+        }
+        int cursor[TIGER_STATE_COUNT];
+        std::copy(m_stateStart, m_stateStart + TIGER_STATE_COUNT, cursor);
+        m_order.resize(size);
+        for (int i = 0; i < size; ++i) {
+            m_order[cursor[t.state[i]]++] = i;
+        }
+
+        for (int state = 0; state < TIGER_STATE_COUNT; ++state) {
+            const TigerStateInfo& info = TIGER_STATES[state];
+            const TigerStateHooks& hooks = TIGER_STATE_HOOKS[state];
+            const int* indices = m_order.data() + m_stateStart[state];
+            const int count = m_stateStart[state + 1] - m_stateStart[state];
+            if (count == 0) continue;
+
+            if (hooks.ordered) {
+                StartActions(t, info, hooks, indices, count, context);
+                if (hooks.update) hooks.update(t, indices, count, context);
+                jobs.ParallelFor(count, TIGER_STATE_JOB_GRAIN, [&](int begin, int end) {
+                    SetSteering(t, info, indices + begin, end - begin);
+                });
+            } else {
+                jobs.ParallelFor(count, TIGER_STATE_JOB_GRAIN, [&](int begin, int end) {
+                    StartActions(t, info, hooks, indices + begin, end - begin, context);
+                    if (hooks.update) hooks.update(t, indices + begin, end - begin, context);
+                    SetSteering(t, info, indices + begin, end - begin);
+                });
+            }
+        }
+    }
+
+    // 이동 후: 멈췄을 때 클립이 있는 상태의 클립 전환, 다음 틱 되감기/양자화용 클립 길이
+    void FinishMove(TigerPool& t, TigerStateContext& context, JobSystem& jobs) {
+        for (int state = 0; state < TIGER_STATE_COUNT; ++state) {
+            const TigerStateInfo& info = TIGER_STATES[state];
+            const TigerStateHooks& hooks = TIGER_STATE_HOOKS[state];
+            if (info.stopClip == ANIM_CLIP_NONE) continue;
+            const int* indices = m_order.data() + m_stateStart[state];
+            const int count = m_stateStart[state + 1] - m_stateStart[state];
+            auto finish = [&](int begin, int end) {
+                std::vector<int>& entered = m_entered[JobSystem::CurrentWorker()];
+                entered.resize(end - begin);
+                int started = 0;
+                for (int k = begin; k < end; ++k) {
+                    const int i = indices[k];
+                    const AnimationClipID clip = t.moved[i] ? info.clip : info.stopClip;
+                    const bool changed = t.animation[i] != clip;
+                    t.animation[i] = clip;
+                    t.animationTime[i] = changed ? 0.0f : t.animationTime[i];   // 애니메이션 변경 시 시간 리셋
+                    entered[started] = i;
+                    started += changed && clip == info.clip;
+                }
+                if (hooks.enter && started > 0) hooks.enter(t, entered.data(), started, context);
+            };
+            if (hooks.ordered) {
+                finish(0, count);
+            } else {
+                jobs.ParallelFor(count, TIGER_STATE_JOB_GRAIN, finish);
+            }
+        }
+        jobs.ParallelFor(t.Size(), TIGER_STATE_JOB_GRAIN, [&](int begin, int end) {
+            for (int i = begin; i < end; ++i) {
+                t.clipDuration[i] = GetAnimationClipDuration(t.animation[i]);
+            }
+        });
+    }
+
+private:
+    // 쿨다운 대기 / 클립 전환 후 enter 훅 (멈췄을 때 클립이 있는 상태는 이동 결과를 보고 FinishMove 에서)
+    void StartActions(TigerPool& t, const TigerStateInfo& info, const TigerStateHooks& hooks,
+                      const int* indices, int count, TigerStateContext& context) {
+        if (info.stopClip != ANIM_CLIP_NONE) return;
+        std::vector<int>& entered = m_entered[JobSystem::CurrentWorker()];
+        entered.resize(count);
+        int started = 0;
+        for (int k = 0; k < count; ++k) {
+            const int i = indices[k];
+            const bool ready = !info.waitsCooldown || t.attackTime[i] >= TIGER_ATTACK_COOLDOWN;
+            const bool start = ready && t.animation[i] != info.clip;
+            t.animation[i] = ready ? info.clip : t.animation[i];
+            t.animationTime[i] = start ? 0.0f : t.animationTime[i];   // 애니메이션 변경 시 시간 리셋
+            entered[started] = i;
+            started += start;
+        }
+        if (hooks.enter && started > 0) hooks.enter(t, entered.data(), started, context);
+    }
+
+    // 이동 목표와 속도 (쿨다운 대기 중이면 제자리)
+    static void SetSteering(TigerPool& t, const TigerStateInfo& info, const int* indices, int count) {
+        const float speed = TIGER_MOVE_SPEED * info.speedScale;
+        const bool toPlayer = info.steer == TIGER_STEER_PLAYER;
+        for (int k = 0; k < count; ++k) {
+            const int i = indices[k];
+            const bool ready = !info.waitsCooldown || t.attackTime[i] >= TIGER_ATTACK_COOLDOWN;
+            t.steerX[i] = toPlayer ? t.playerX[i] : t.targetX[i];
+            t.steerZ[i] = toPlayer ? t.playerZ[i] : t.targetZ[i];
+            t.steerSpeed[i] = (ready && info.steer != TIGER_STEER_NONE) ? speed : 0.0f;
+        }
+    }
+
+    int m_stateStart[TIGER_STATE_COUNT + 1] = {};
+    std::vector<int> m_order;                  // 상태별로 묶은 호랑이 인덱스
+    std::vector<std::vector<int>> m_entered;   // 워커별: 이번 구간에 동작이 시작된 호랑이 (enter 훅 입력)
+};
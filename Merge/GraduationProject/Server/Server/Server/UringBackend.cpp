@@ -0,0 +1,567 @@
+#ifdef __linux__
+#include "UringBackend.h"
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <csignal>
+#include <chrono>
+#include <thread>
+#include <iostream>
+
+namespace {
+    int SysUringSetup(unsigned entries, io_uring_params* params) {
+        return static_cast<int>(syscall(__NR_io_uring_setup, entries, params));
+    }
+    int SysUringEnter(int fd, unsigned toSubmit, unsigned minComplete, unsigned flags, void* arg, size_t argSize) {
+        return static_cast<int>(syscall(__NR_io_uring_enter, fd, toSubmit, minComplete, flags, arg, argSize));
+    }
+    int SysUringRegister(int fd, unsigned opcode, void* arg, unsigned count) {
+        return static_cast<int>(syscall(__NR_io_uring_register, fd, opcode, arg, count));
+    }
+
+    // user_data: [연결 포인터][op 하위 2bit]
+    // 연결은 64B 정렬된 SlabPool 슬롯이므로 하위 비트가 비어 있음
+    // 진행 중인 요청이 있는 동안은 반납하지 않으므로 완료 시점에도 같은 연결을 가리킴
+    constexpr uint64_t OP_MASK = 0x3;
+    uint64_t PackUserData(uint8_t op, const void* conn) {
+        return reinterpret_cast<uintptr_t>(conn) | op;
+    }
+    uint8_t UserDataOp(uint64_t data) { return static_cast<uint8_t>(data & OP_MASK); }
+    void* UserDataConnection(uint64_t data) { return reinterpret_cast<void*>(static_cast<uintptr_t>(data & ~OP_MASK)); }
+
+    constexpr unsigned SEND_BUFFER_INDEX = 0;
+}
+
+UringBackend::UringBackend()
+    : m_ringFd(-1)
+    , m_sqHead(nullptr)
+    , m_sqTail(nullptr)
+    , m_sqMask(nullptr)
+    , m_sqArray(nullptr)
+    , m_sqes(nullptr)
+    , m_cqHead(nullptr)
+    , m_cqTail(nullptr)
+    , m_cqMask(nullptr)
+    , m_cqes(nullptr)
+    , m_sqRing(MAP_FAILED)
+    , m_sqRingSize(0)
+    , m_cqRing(MAP_FAILED)
+    , m_cqRingSize(0)
+    , m_sqesSize(0)
+    , m_pendingSqes(0)
+    , m_sendRegion(nullptr)
+    , m_overflowSends(0)
+    , m_connectionCount(0)
+{
+}
+
+UringBackend::~UringBackend() {
+    Shutdown();
+}
+
+bool UringBackend::Initialize(ReceiveCallback onReceive, DisconnectCallback onDisconnect) {
+    m_onReceive = std::move(onReceive);
+    m_onDisconnect = std::move(onDisconnect);
+
+    if (!SetupRing()) {
+        Shutdown();
+        return false;
+    }
+
+    // 송신 버퍼 등록 (커널이 매번 페이지를 고정하지 않도록)
+    // 수신은 연결별 RecvRing으로 받으므로 등록하지 않음 (미러 매핑이라 고정 버퍼로 쓸 수 없음)
+    size_t sendBytes = static_cast<size_t>(SEND_SLOTS) * SEND_SLOT_SIZE;
+    void* sendRegion = mmap(nullptr, sendBytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (sendRegion == MAP_FAILED) {
+        std::cout << "[Error] io_uring buffer allocation failed" << std::endl;
+        Shutdown();
+        return false;
+    }
+    m_sendRegion = static_cast<char*>(sendRegion);
+
+    iovec buffers[1];
+    buffers[SEND_BUFFER_INDEX].iov_base = m_sendRegion;
+    buffers[SEND_BUFFER_INDEX].iov_len = sendBytes;
+    if (SysUringRegister(m_ringFd, IORING_REGISTER_BUFFERS, buffers, 1) < 0) {
+        std::cout << "[Error] IORING_REGISTER_BUFFERS failed: " << errno << std::endl;
+        Shutdown();
+        return false;
+    }
+
+    m_freeSendSlots.reserve(SEND_SLOTS);
+    for (int i = SEND_SLOTS - 1; i >= 0; --i) m_freeSendSlots.push_back(i);
+    m_sendLength.assign(SEND_SLOTS, 0);
+    // 접속 폭주 중에 힙 할당이 일어나지 않도록 미리 확보
+    m_connections.assign(MAX_CONNECTIONS, nullptr);
+    m_flushList.reserve(MAX_CONNECTIONS);
+    m_received.reserve(MAX_CONNECTIONS);
+    m_disconnected.reserve(MAX_CONNECTIONS);
+    SlabPool<Connection>::Instance().Reserve(MAX_CONNECTIONS);
+    return true;
+}
+
+bool UringBackend::SetupRing() {
+    io_uring_params params = {};
+    m_ringFd = SysUringSetup(QUEUE_DEPTH, &params);
+    if (m_ringFd < 0) {
+        std::cout << "[Error] io_uring_setup failed: " << errno << std::endl;
+        return false;
+    }
+
+    // 타임아웃 대기(IORING_ENTER_EXT_ARG)가 없는 커널은 지원하지 않음
+    if (!(params.features & IORING_FEAT_EXT_ARG)) {
+        std::cout << "[Error] io_uring lacks IORING_FEAT_EXT_ARG" << std::endl;
+        return false;
+    }
+
+    m_sqRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    m_cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    bool singleMmap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+    if (singleMmap) {
+        m_sqRingSize = m_cqRingSize = std::max(m_sqRingSize, m_cqRingSize);
+    }
+
+    m_sqRing = mmap(nullptr, m_sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_ringFd, IORING_OFF_SQ_RING);
+    if (m_sqRing == MAP_FAILED) return false;
+
+    if (singleMmap) {
+        m_cqRing = m_sqRing;
+    } else {
+        m_cqRing = mmap(nullptr, m_cqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_ringFd, IORING_OFF_CQ_RING);
+        if (m_cqRing == MAP_FAILED) return false;
+    }
+
+    m_sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+    void* sqes = mmap(nullptr, m_sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_ringFd, IORING_OFF_SQES);
+    if (sqes == MAP_FAILED) return false;
+    m_sqes = static_cast<io_uring_sqe*>(sqes);
+
+    char* sq = static_cast<char*>(m_sqRing);
+    m_sqHead = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+    m_sqTail = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+    m_sqMask = reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+    m_sqArray = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+
+    char* cq = static_cast<char*>(m_cqRing);
+    m_cqHead = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+    m_cqTail = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+    m_cqMask = reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+    m_cqes = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+    return true;
+}
+
+void UringBackend::Shutdown() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    // 닫히는 중인 연결은 이미 칸에서 빠져 있고 소켓도 닫혔음
+    for (Connection*& conn : m_connections) {
+        if (!conn) continue;
+        shutdown(conn->socket, SHUT_RDWR);
+        close(conn->socket);
+        SlabPool<Connection>::Instance().Free(conn);
+        conn = nullptr;
+    }
+    m_connectionCount = 0;
+    m_flushList.clear();
+
+    if (m_sqes) {
+        munmap(m_sqes, m_sqesSize);
+        m_sqes = nullptr;
+    }
+    if (m_cqRing != MAP_FAILED && m_cqRing != m_sqRing) {
+        munmap(m_cqRing, m_cqRingSize);
+    }
+    m_cqRing = MAP_FAILED;
+    if (m_sqRing != MAP_FAILED) {
+        munmap(m_sqRing, m_sqRingSize);
+        m_sqRing = MAP_FAILED;
+    }
+    if (m_ringFd >= 0) {
+        close(m_ringFd);
+        m_ringFd = -1;
+    }
+    if (m_sendRegion) {
+        munmap(m_sendRegion, static_cast<size_t>(SEND_SLOTS) * SEND_SLOT_SIZE);
+        m_sendRegion = nullptr;
+    }
+    m_pendingSqes = 0;
+}
+
+io_uring_sqe* UringBackend::GetSqe() {
+    unsigned head = __atomic_load_n(m_sqHead, __ATOMIC_ACQUIRE);
+    unsigned tail = *m_sqTail;
+    if (tail - head >= QUEUE_DEPTH) {
+        // SQ가 가득 참 - 먼저 제출
+        Submit();
+        head = __atomic_load_n(m_sqHead, __ATOMIC_ACQUIRE);
+        if (tail - head >= QUEUE_DEPTH) {
+            return nullptr;
+        }
+    }
+
+    unsigned index = tail & *m_sqMask;
+    io_uring_sqe* sqe = &m_sqes[index];
+    memset(sqe, 0, sizeof(*sqe));
+    m_sqArray[index] = index;
+    __atomic_store_n(m_sqTail, tail + 1, __ATOMIC_RELEASE);
+    ++m_pendingSqes;
+    return sqe;
+}
+
+void UringBackend::Submit() {
+    if (m_pendingSqes == 0) {
+        return;
+    }
+
+    int ret = SysUringEnter(m_ringFd, m_pendingSqes, 0, 0, nullptr, 0);
+    if (ret > 0) {
+        m_pendingSqes -= std::min<unsigned>(static_cast<unsigned>(ret), m_pendingSqes);
+    } else if (ret < 0 && errno != EINTR && errno != EBUSY) {
+        std::cout << "[Error] io_uring_enter failed: " << errno << std::endl;
+    }
+}
+
+void UringBackend::WaitCompletion(int timeoutMs) {
+    __kernel_timespec ts = {};
+    ts.tv_sec = timeoutMs / 1000;
+    ts.tv_nsec = static_cast<long long>(timeoutMs % 1000) * 1000000;
+    io_uring_getevents_arg arg = {};
+    arg.sigmask_sz = _NSIG / 8;
+    arg.ts = reinterpret_cast<uint64_t>(&ts);
+    SysUringEnter(m_ringFd, 0, 1, IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG, &arg, sizeof(arg));
+}
+
+bool UringBackend::AddClient(SOCKET socket, int clientID) {
+    int noDelay = 1;
+    setsockopt(socket, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_connectionCount >= MAX_CONNECTIONS) {
+        std::cout << "[Error] io_uring connection limit reached" << std::endl;
+        close(socket);
+        return false;
+    }
+
+    Connection* conn = SlabPool<Connection>::Instance().Allocate();
+    if (!conn) {
+        close(socket);
+        return false;
+    }
+    if (!conn->recvRing.IsCreated() && !conn->recvRing.Create()) {
+        std::cout << "[Error] Failed to create receive ring" << std::endl;
+        SlabPool<Connection>::Instance().Free(conn);
+        close(socket);
+        return false;
+    }
+    // 풀에서 재사용된 객체 - 상태 초기화
+    conn->socket = socket;
+    conn->clientID = clientID;
+    conn->recvRing.Reset();
+    conn->recvInFlight = false;
+    conn->closing = false;
+    conn->slotHead = 0;
+    conn->slotCount = 0;
+    conn->sendOffset = 0;
+    conn->overflow.Clear();   // capacity는 유지
+    conn->queuedBytes = 0;
+    conn->sendInFlight = false;
+    conn->overflowInFlight = false;
+    conn->flushQueued = false;
+
+    if (static_cast<size_t>(socket) >= m_connections.size()) {
+        m_connections.resize(static_cast<size_t>(socket) * 2, nullptr);
+    }
+    // 같은 fd 번호의 이전 연결은 닫을 때 이미 칸에서 빠졌음 (진행 중인 요청은 연결 포인터로 완료됨)
+    m_connections[socket] = conn;
+    ++m_connectionCount;
+
+    PrepareRecv(*conn);
+    Submit();
+    return true;
+}
+
+void UringBackend::RemoveClient(SOCKET socket, int clientID) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    Connection* conn = FindConnection(socket);
+    if (conn && conn->clientID == clientID) {
+        CloseConnection(conn);
+    }
+}
+
+void UringBackend::CloseConnection(Connection* conn) {
+    conn->closing = true;
+    m_connections[conn->socket] = nullptr;
+
+    // 아직 제출되지 않은 송신 데이터 폐기 (진행 중인 슬롯과 SENDMSG가 보는 overflow는 반납 시 정리)
+    while (conn->slotCount > (conn->sendInFlight && !conn->overflowInFlight ? 1 : 0)) {
+        conn->queuedBytes -= m_sendLength[conn->BackSlot()];
+        m_freeSendSlots.push_back(conn->BackSlot());
+        conn->PopBackSlot();
+    }
+    if (!conn->overflowInFlight) {
+        conn->overflow.Clear();
+    }
+
+    // 진행 중인 수신을 0바이트 완료로 끝내기 위해 shutdown
+    // (io_uring은 파일 참조를 잡고 있으므로 closesocket만으로는 완료되지 않음)
+    // 진행 중인 요청은 파일 참조로 끝까지 같은 소켓을 보므로 fd 번호는 바로 놓아도 됨
+    shutdown(conn->socket, SHUT_RDWR);
+    close(conn->socket);
+
+    if (!conn->recvInFlight && !conn->sendInFlight) {
+        ReleaseConnection(conn);
+    }
+}
+
+void UringBackend::ReleaseConnection(Connection* conn) {
+    while (conn->slotCount > 0) {
+        m_freeSendSlots.push_back(conn->FrontSlot());
+        conn->PopFrontSlot();
+    }
+    conn->overflow.Clear();
+    --m_connectionCount;
+    SlabPool<Connection>::Instance().Free(conn);
+}
+
+IOBackend::SendResult UringBackend::Send(SOCKET socket, const void* data, int size) {
+    if (socket == INVALID_SOCKET) return SEND_FAILED;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    Connection* conn = FindConnection(socket);
+    if (!conn) {
+        return SEND_FAILED;
+    }
+    if (conn->queuedBytes + size > SEND_QUEUE_LIMIT) {
+        std::cout << "[SendPacket] Send queue full, dropping packet (socket: " << socket << ")" << std::endl;
+        return SEND_FAILED;
+    }
+
+    const char* src = static_cast<const char*>(data);
+    int remaining = size;
+    // overflow에 이미 데이터가 있으면 순서를 지키기 위해 슬롯은 건너뜀
+    while (remaining > 0 && conn->overflow.Empty()) {
+        // 진행 중이 아닌 마지막 슬롯에 여유가 있으면 이어서 채움 (소켓별 병합)
+        int slot = -1;
+        bool backInFlight = conn->sendInFlight && !conn->overflowInFlight && conn->slotCount == 1;
+        if (conn->slotCount > 0 && !backInFlight &&
+            m_sendLength[conn->BackSlot()] < SEND_SLOT_SIZE) {
+            slot = conn->BackSlot();
+        } else {
+            if (conn->slotCount == SEND_SLOTS_PER_CONNECTION || m_freeSendSlots.empty()) {
+                break;   // 할당량 또는 공용 슬롯 소진 - 나머지는 복사 대기열로
+            }
+            slot = m_freeSendSlots.back();
+            m_freeSendSlots.pop_back();
+            m_sendLength[slot] = 0;
+            conn->PushSlot(slot);
+        }
+
+        int chunk = std::min(remaining, SEND_SLOT_SIZE - m_sendLength[slot]);
+        memcpy(SendBuffer(slot) + m_sendLength[slot], src, chunk);
+        m_sendLength[slot] += chunk;
+        src += chunk;
+        remaining -= chunk;
+        conn->queuedBytes += chunk;
+    }
+    if (remaining > 0) {
+        conn->overflow.Append(src, remaining, SEND_QUEUE_LIMIT);   // 전체 한도는 위에서 확인함
+        conn->queuedBytes += remaining;
+        m_overflowSends.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    if (!conn->flushQueued) {
+        conn->flushQueued = true;
+        m_flushList.push_back(socket);
+    }
+    return conn->queuedBytes > SEND_HIGH_WATER ? SEND_BACKPRESSURE : SEND_OK;
+}
+
+void UringBackend::Flush() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (SOCKET socket : m_flushList) {
+        Connection* conn = FindConnection(socket);   // 그 사이 닫혔으면 없음
+        if (!conn) continue;
+        conn->flushQueued = false;
+        if (!conn->sendInFlight && conn->HasPendingSend()) {
+            PrepareSend(*conn);
+        }
+    }
+    m_flushList.clear();
+    Submit();
+}
+
+void UringBackend::PrepareRecv(Connection& conn) {
+    io_uring_sqe* sqe = GetSqe();
+    if (!sqe) return;
+    sqe->opcode = IORING_OP_RECV;
+    sqe->fd = conn.socket;
+    sqe->addr = reinterpret_cast<uint64_t>(conn.recvRing.WritePtr());
+    sqe->len = static_cast<unsigned>(conn.recvRing.Writable());
+    sqe->user_data = PackUserData(OP_RECV, &conn);
+    conn.recvInFlight = true;
+}
+
+void UringBackend::PrepareSend(Connection& conn) {
+    io_uring_sqe* sqe = GetSqe();
+    if (!sqe) {
+        // SQ가 비면 다음 Flush에서 재시도
+        if (!conn.flushQueued) {
+            conn.flushQueued = true;
+            m_flushList.push_back(conn.socket);
+        }
+        return;
+    }
+    sqe->fd = conn.socket;
+    sqe->user_data = PackUserData(OP_SEND, &conn);
+    conn.sendInFlight = true;
+
+    if (conn.slotCount > 0) {
+        int slot = conn.FrontSlot();
+        sqe->opcode = IORING_OP_WRITE_FIXED;
+        sqe->addr = reinterpret_cast<uint64_t>(SendBuffer(slot) + conn.sendOffset);
+        sqe->len = m_sendLength[slot] - conn.sendOffset;
+        sqe->buf_index = SEND_BUFFER_INDEX;
+        conn.overflowInFlight = false;
+        return;
+    }
+
+    // 슬롯을 다 보낸 뒤 overflow를 scatter-gather로 (완료될 때까지 구간 주소는 바뀌지 않음)
+    SendQueue::Slice slices[MAX_SEND_SLICES];
+    conn.overflow.BeginWrite();
+    int count = conn.overflow.GetSlices(slices, MAX_SEND_SLICES);
+    for (int i = 0; i < count; ++i) {
+        conn.overflowIov[i].iov_base = const_cast<char*>(slices[i].data);
+        conn.overflowIov[i].iov_len = slices[i].size;
+    }
+    conn.overflowMsg = {};
+    conn.overflowMsg.msg_iov = conn.overflowIov;
+    conn.overflowMsg.msg_iovlen = count;
+    sqe->opcode = IORING_OP_SENDMSG;
+    sqe->addr = reinterpret_cast<uint64_t>(&conn.overflowMsg);
+    sqe->len = 1;
+    sqe->msg_flags = MSG_NOSIGNAL;
+    conn.overflowInFlight = true;
+}
+
+void UringBackend::LogStats() const {
+    SlabPool<Connection>::Instance().LogStats("io_uring connections");
+    std::cout << "[Uring] sends queued past the registered slot quota: "
+              << m_overflowSends.load(std::memory_order_relaxed) << std::endl;
+}
+
+void UringBackend::Poll(int timeoutMs) {
+    // CQ 수확은 한 스레드만 - 다른 워커는 대기 후 복귀
+    std::unique_lock<std::mutex> pollLock(m_pollMutex, std::try_to_lock);
+    if (!pollLock.owns_lock()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(timeoutMs));
+        return;
+    }
+
+    // 완료가 없으면 타임아웃까지 대기 (m_mutex 없이 대기하여 Send를 막지 않음)
+    if (__atomic_load_n(m_cqHead, __ATOMIC_RELAXED) == __atomic_load_n(m_cqTail, __ATOMIC_ACQUIRE)) {
+        WaitCompletion(timeoutMs);
+    }
+
+    m_received.clear();
+    m_disconnected.clear();
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        unsigned head = *m_cqHead;
+        unsigned tail = __atomic_load_n(m_cqTail, __ATOMIC_ACQUIRE);
+        for (; head != tail; ++head) {
+            const io_uring_cqe& cqe = m_cqes[head & *m_cqMask];
+            Connection& conn = *static_cast<Connection*>(UserDataConnection(cqe.user_data));
+
+            if (UserDataOp(cqe.user_data) == OP_RECV) {
+                if (conn.closing) {
+                    conn.recvInFlight = false;   // 이미 제거된 클라이언트
+                } else if (cqe.res > 0) {
+                    // recvInFlight는 콜백이 끝날 때까지 유지 - 그동안 RemoveClient가 연결을 반납하지 않음
+                    conn.recvRing.Commit(static_cast<size_t>(cqe.res));
+                    m_received.push_back({ &conn, conn.clientID, cqe.res });
+                } else {
+                    m_disconnected.push_back({ &conn, conn.clientID, cqe.res == 0 ? 0 : -cqe.res });
+                }
+            } else {
+                conn.sendInFlight = false;
+                bool wasOverflow = conn.overflowInFlight;
+                conn.overflowInFlight = false;
+                if (cqe.res < 0) {
+                    std::cout << "[SendPacket] Send failed (socket: " << conn.socket << ", Error: " << -cqe.res << ")" << std::endl;
+                    while (conn.slotCount > 0) {
+                        m_freeSendSlots.push_back(conn.FrontSlot());
+                        conn.PopFrontSlot();
+                    }
+                    conn.overflow.Clear();
+                    conn.sendOffset = 0;
+                    conn.queuedBytes = 0;
+                } else {
+                    conn.queuedBytes -= cqe.res;
+                    if (wasOverflow) {
+                        conn.overflow.CompleteWrite(cqe.res);
+                    } else {
+                        conn.sendOffset += cqe.res;
+                        if (conn.sendOffset >= m_sendLength[conn.FrontSlot()]) {
+                            m_freeSendSlots.push_back(conn.FrontSlot());
+                            conn.PopFrontSlot();
+                            conn.sendOffset = 0;
+                        }
+                    }
+                    // 남은 데이터(부분 송신, 대기 슬롯, overflow)는 바로 이어서 전송
+                    if (!conn.closing && conn.HasPendingSend()) {
+                        PrepareSend(conn);
+                    }
+                }
+            }
+
+            if (conn.closing && !conn.recvInFlight && !conn.sendInFlight) {
+                ReleaseConnection(&conn);
+            }
+        }
+        __atomic_store_n(m_cqHead, head, __ATOMIC_RELEASE);
+    }
+
+    // 콜백은 락 밖에서 호출 (콜백 안에서 Send/RemoveClient가 호출됨)
+    for (const Completion& c : m_received) {
+        RecvRing& ring = c.conn->recvRing;
+        int consumed = m_onReceive(c.clientID, ring.ReadPtr(), static_cast<int>(ring.Readable()));
+        bool keep = consumed >= 0;
+        if (keep) {
+            ring.Consume(static_cast<size_t>(consumed));
+            if (ring.Writable() == 0) {
+                std::cout << "[Error] Receive ring full for client " << c.clientID << std::endl;
+                m_onDisconnect(c.clientID, ENOBUFS);
+                keep = false;
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        Connection* conn = c.conn;
+        conn->recvInFlight = false;
+        if (keep && !conn->closing) {
+            PrepareRecv(*conn);   // 다음 수신 준비
+        } else if (!conn->closing) {
+            CloseConnection(conn);   // GameServer가 이미 제거한 클라이언트 - RemoveClient가 오지 않음
+        } else if (!conn->sendInFlight) {
+            ReleaseConnection(conn);
+        }
+    }
+    for (const Completion& c : m_disconnected) {
+        m_onDisconnect(c.clientID, c.result);
+
+        // GameServer가 이미 제거한 클라이언트라면 RemoveClient가 호출되지 않으므로 여기서 닫음
+        std::lock_guard<std::mutex> lock(m_mutex);
+        Connection* conn = c.conn;
+        conn->recvInFlight = false;
+        if (!conn->closing) {
+            CloseConnection(conn);
+        } else if (!conn->sendInFlight) {
+            ReleaseConnection(conn);
+        }
+    }
+
+    // 다시 등록한 수신과 이어서 보내는 송신 제출 (새 송신 데이터는 시뮬레이션 틱의 Flush에서)
+    std::lock_guard<std::mutex> lock(m_mutex);
+    Submit();
+}
+#endif
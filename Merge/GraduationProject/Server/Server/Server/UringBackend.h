@@ -0,0 +1,129 @@
+#pragma once
+#ifdef __linux__
+#include "IOBackend.h"
+#include "SendQueue.h"
+#include "SessionTable.h"
+#include "SlabPool.h"
+#include "../../../Common/RecvRing.h"
+#include <linux/io_uring.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <atomic>
+#include <vector>
+#include <mutex>
+
+// Linux io_uring 백엔드 (liburing 없이 시스템 콜 직접 사용)
+//  - 수신은 연결별 RecvRing에 IORING_OP_RECV로 바로 받음 (콜백은 링의 미처리 구간을 그대로 봄)
+//  - 송신 버퍼는 IORING_REGISTER_BUFFERS 로 등록 (WRITE_FIXED)
+//    연결당 SEND_SLOTS_PER_CONNECTION개까지만 쓰고, 할당량이나 공용 슬롯이 모자라면 연결별 SendQueue에
+//    복사해 두었다가 SENDMSG로 보냄 (느린 클라이언트 몇 명이 슬롯을 다 잡아도 다른 세션의 송신은 실패하지 않음)
+//  - Send()는 소켓별 송신 슬롯에 쌓아두기만 하고, Flush()에서 SQE를 한 번에 제출
+//    -> 틱마다 1000명 브로드캐스트가 io_uring_enter 몇 번으로 끝남
+//  - 소켓당 송신은 한 번에 하나만 진행하여 순서를 보장
+//  - 연결 상태는 SlabPool에서 빌리고 fd로 바로 찾음 (epoll과 같음) - 완료 user_data에는 연결 포인터를 담음
+class UringBackend : public IOBackend {
+public:
+    UringBackend();
+    ~UringBackend() override;
+
+    const char* GetName() const override { return "io_uring"; }
+    bool Initialize(ReceiveCallback onReceive, DisconnectCallback onDisconnect) override;
+    void Shutdown() override;
+    bool AddClient(SOCKET socket, int clientID) override;
+    void RemoveClient(SOCKET socket, int clientID) override;
+    SendResult Send(SOCKET socket, const void* data, int size) override;
+    void Flush() override;
+    void Poll(int timeoutMs) override;
+    void LogStats() const override;
+
+private:
+    static constexpr unsigned QUEUE_DEPTH = 4096;
+    static constexpr int MAX_CONNECTIONS = SessionTableLayout::CAPACITY;   // 서버가 받는 세션 수만큼
+    static constexpr int SEND_SLOTS = 1024;
+    static constexpr int SEND_SLOT_SIZE = 4096;
+    static constexpr int SEND_SLOTS_PER_CONNECTION = 4;   // 보통 틱당 1개면 충분 - 넘치면 복사 대기열로
+    static constexpr int MAX_SEND_SLICES = 8;             // SENDMSG 한 번에 넘기는 iovec 수 (전용 바이트라 보통 1개로 합쳐짐)
+
+    enum OpType : uint8_t { OP_RECV = 1, OP_SEND = 2 };
+
+    struct Connection {
+        SOCKET socket = INVALID_SOCKET;
+        int clientID = 0;
+        RecvRing recvRing;              // 처음 빌릴 때 한 번 만들고 재사용 (풀 객체는 소멸하지 않음)
+        bool recvInFlight = false;      // 수신 완료 후 콜백이 끝날 때까지 유지 (그동안 반납하지 않음)
+        bool closing = false;
+        // 송신 대기 슬롯 (고정 크기 원형 배열 - 앞쪽이 진행 중이거나 다음 차례)
+        int sendSlots[SEND_SLOTS_PER_CONNECTION];
+        int slotHead = 0;
+        int slotCount = 0;
+        int sendOffset = 0;          // 앞쪽 슬롯에서 이미 보낸 바이트 수
+        // 슬롯에 못 넣은 데이터 (슬롯 뒤에 이어지는 순서) - 비어 있지 않으면 새 데이터도 여기로
+        SendQueue overflow;
+        msghdr overflowMsg;          // 진행 중인 SENDMSG가 참조 (연결 객체는 그동안 반납되지 않음)
+        iovec overflowIov[MAX_SEND_SLICES];
+        int queuedBytes = 0;         // 아직 송신 완료되지 않은 전체 바이트 수 (슬롯 + overflow, high-water 판정)
+        bool sendInFlight = false;
+        bool overflowInFlight = false;   // 진행 중인 송신이 SENDMSG(overflow)인지
+        bool flushQueued = false;
+
+        int FrontSlot() const { return sendSlots[slotHead]; }
+        int BackSlot() const { return sendSlots[(slotHead + slotCount - 1) % SEND_SLOTS_PER_CONNECTION]; }
+        void PushSlot(int slot) { sendSlots[(slotHead + slotCount++) % SEND_SLOTS_PER_CONNECTION] = slot; }
+        void PopFrontSlot() { slotHead = (slotHead + 1) % SEND_SLOTS_PER_CONNECTION; --slotCount; }
+        void PopBackSlot() { --slotCount; }
+        bool HasPendingSend() const { return slotCount > 0 || !overflow.Empty(); }
+    };
+
+    struct Completion {
+        Connection* conn;
+        int clientID;
+        int result;
+    };
+
+    bool SetupRing();
+    io_uring_sqe* GetSqe();
+    void Submit();
+    void WaitCompletion(int timeoutMs);
+    void PrepareRecv(Connection& conn);
+    void PrepareSend(Connection& conn);
+    Connection* FindConnection(SOCKET socket) const {
+        return socket >= 0 && static_cast<size_t>(socket) < m_connections.size() ? m_connections[socket] : nullptr;
+    }
+    void CloseConnection(Connection* conn);
+    void ReleaseConnection(Connection* conn);
+    char* SendBuffer(int slot) { return m_sendRegion + static_cast<size_t>(slot) * SEND_SLOT_SIZE; }
+
+    int m_ringFd;
+    unsigned* m_sqHead;
+    unsigned* m_sqTail;
+    unsigned* m_sqMask;
+    unsigned* m_sqArray;
+    io_uring_sqe* m_sqes;
+    unsigned* m_cqHead;
+    unsigned* m_cqTail;
+    unsigned* m_cqMask;
+    io_uring_cqe* m_cqes;
+    void* m_sqRing;
+    size_t m_sqRingSize;
+    void* m_cqRing;
+    size_t m_cqRingSize;
+    size_t m_sqesSize;
+    unsigned m_pendingSqes;
+
+    char* m_sendRegion;
+    std::vector<int> m_freeSendSlots;
+    std::vector<int> m_sendLength;   // 슬롯별 채워진 바이트 수
+    std::atomic<uint64_t> m_overflowSends;   // 슬롯 대신 복사 대기열로 간 Send 수 (LogStats)
+
+    std::vector<Connection*> m_connections;   // fd로 바로 찾음 (SlabPool에서 빌린 객체)
+    int m_connectionCount;
+    std::vector<SOCKET> m_flushList;   // 송신 대기 데이터가 있는 소켓
+    std::vector<Completion> m_received;       // Poll에서 재사용 (m_pollMutex 보호)
+    std::vector<Completion> m_disconnected;
+    std::mutex m_mutex;              // 링/연결 상태 보호
+    std::mutex m_pollMutex;          // CQ는 한 스레드만 수확
+
+    ReceiveCallback m_onReceive;
+    DisconnectCallback m_onDisconnect;
+};
+#endif